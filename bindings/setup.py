@@ -12,7 +12,7 @@ src_dir = __root_dir__ / "src"
 subprocess.check_call([ "python3", str(src_dir / "indexer_gen.py"), str(BOARD_SIZE) ])
 
 include_dir = __root_dir__ / "include"
-exclude_patterns = ["main.cpp", "benchmark.cpp", "*_test.cpp", "indexer*.cpp"]
+exclude_patterns = ["main.cpp", "benchmark.cpp", "loadgen.cpp", "sudoku_c.cpp", "*_test.cpp", "indexer*.cpp"]
 cpp_files = [
     str(f) for f in src_dir.glob("*.cpp") 
     if not any(f.match(p) for p in exclude_patterns)
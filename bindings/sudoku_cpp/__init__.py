@@ -1,12 +1,129 @@
+import asyncio
+import atexit
+import concurrent.futures
 from . import sudoku
 
-def solve(puzzle: list[list[int]])->dict:
-    return sudoku.solve(puzzle)
-def generate(n_clues: int, max_retries: int = 1024, parallel_exec = False, verbose = True)->list[list[int]]:
-    return sudoku.generate(n_clues, max_retries, parallel_exec, verbose)
+def solve(puzzle: list[list[int]], timeout: float = 0, check_unique: bool = False)->dict:
+    """
+    Solve within timeout seconds (no limit if 0), 'status' of the result is 'solved', 'unsolved' or 'timeout',
+    'invalid' (conflicting givens) or 'contradiction' (a cell or a value left without option) found before solving,
+    or 'multiple' when check_unique is set and the puzzle has another solution.
+    """
+    return sudoku.solve(puzzle, timeout, check_unique)
+def solve_batch(puzzles: list[list[list[int]]], n_threads: int = 0, timeout: float = 0)->list[dict]:
+    """
+    Solve the puzzles on native threads (all cores if n_threads is 0) without holding the GIL,
+    the results are in the order of the puzzles, as returned by solve(), timeout applies to each puzzle.
+    """
+    return sudoku.solve_batch(puzzles, n_threads, timeout)
+def solve_array(puzzles, n_threads: int = 0, with_candidates: bool = False)->dict:
+    """
+    Solve a NumPy array of uint8 or uint16, of shape (N, N) or (B, N, N), read in place through the buffer protocol.
+    Returns {'data': the solutions with the dtype and shape of the puzzles, 'solved': bool or (B,) bool array},
+    with_candidates adds 'candidates', the final candidate state as a (N, N, N) or (B, N, N, N) bool array,
+    [row, col, value - 1], a view of the solver state for a single puzzle.
+    """
+    return sudoku.solve_array(puzzles, n_threads, with_candidates)
+def generate(n_clues: int, max_retries: int = 1024, parallel_exec = False, verbose = True, timeout: float = 0)->list[list[int]]:
+    """
+    If timeout (seconds) is given, the board with the fewest clues found within the time is returned,
+    check 'exact' and 'n_clues' of the result.
+    """
+    return sudoku.generate(n_clues, max_retries, parallel_exec, verbose, timeout)
+class GenerateFuture:
+    """
+    Handle of a generation running on a native thread, with the interface of concurrent.futures.Future,
+    and awaitable from asyncio.
+    """
+    def __init__(self, task: "sudoku.GenerateTask"):
+        self._task = task
+    def done(self)->bool:
+        return self._task.done()
+    def cancel(self)->bool:
+        """Stop the generation, returns False if it is already done."""
+        if self._task.done():
+            return False
+        self._task.cancel()
+        return True
+    def cancelled(self)->bool:
+        return self._task.cancelled()
+    def result(self, timeout: "float | None" = None)->dict:
+        if not self._task.wait(-1 if timeout is None else timeout):
+            raise concurrent.futures.TimeoutError()
+        if self._task.cancelled():
+            raise concurrent.futures.CancelledError()
+        return self._task.result()
+    def __await__(self):
+        # the generation thread completes an asyncio future through the loop, no thread waits for it
+        loop = asyncio.get_running_loop()
+        done = loop.create_future()
+        def _set_done():
+            if not done.done():
+                done.set_result(None)
+        def _on_done():
+            try:
+                loop.call_soon_threadsafe(_set_done)
+            except RuntimeError:
+                pass    # the loop is closed, nobody is awaiting anymore
+        self._task.add_done_callback(_on_done)
+        try:
+            yield from done.__await__()
+        except asyncio.CancelledError:
+            self._task.cancel()
+            raise
+        return self.result()
+
+def generate_start(n_clues: int, max_retries: int = 1024, parallel_exec = False, timeout: float = 0)->GenerateFuture:
+    """
+    Start generate() on a native thread and return at once, the handle can be polled, waited for, cancelled or awaited.
+    """
+    return GenerateFuture(sudoku.GenerateTask(n_clues, max_retries, parallel_exec, timeout))
+async def generate_async(n_clues: int, max_retries: int = 1024, parallel_exec = False, timeout: float = 0)->dict:
+    """
+    generate() for asyncio, cancelling the awaiting task cancels the generation.
+    """
+    return await generate_start(n_clues, max_retries, parallel_exec, timeout)
+
+def generate_array(n_clues: int, n_puzzles: int = 1, max_retries: int = 1024, n_threads: int = 0):
+    """
+    Generate n_puzzles puzzles into a (n_puzzles, N, N) uint8 NumPy array, on native threads without holding the GIL.
+    """
+    return sudoku.generate_array(n_clues, n_puzzles, max_retries, n_threads)
 def build_config()->dict:
     return sudoku.build_config()
 
+# an interactive board: place(r, c, v) / erase(r, c) update the candidates incrementally,
+# candidates(r, c), next_deduction() and has_conflict() answer in microseconds,
+# is_solvable(timeout=0.1) searches for a completion, None if it is not known within the timeout
+SolverSession = sudoku.SolverSession
+
+def reservoir_start(
+    clue_counts: list[int], low_watermark: int = 4, high_watermark: int = 16, 
+    n_threads: int = 1, persist_path: str = ""
+    )->None:
+    """
+    Keep pools of ready puzzles for the given clue counts, 
+    generate() then pops a puzzle from the pool when one is ready.
+    If persist_path is given, the pools are loaded from it and saved to it on stop.
+    """
+    sudoku.reservoir_start(clue_counts, low_watermark, high_watermark, n_threads, persist_path)
+    atexit.register(sudoku.reservoir_stop)
+def reservoir_stop()->None:
+    sudoku.reservoir_stop()
+def reservoir_stats()->dict:
+    return sudoku.reservoir_stats()
+
+def cache_enable(capacity: int = 65536)->None:
+    """
+    Cache the solutions of solve() in a bounded cache, replacing the current one.
+    Puzzles are keyed by their canonical form, so equivalent puzzles (transposed, permuted, relabeled) share an entry.
+    """
+    sudoku.cache_enable(capacity)
+def cache_disable()->None:
+    sudoku.cache_disable()
+def cache_stats()->dict:
+    return sudoku.cache_stats()
+
 def fmt_board(board: list[list[int]]) -> str:
     board_size = sudoku.build_config()['BOARD_SIZE']
     grid_size = sudoku.build_config()['GRID_SIZE']
@@ -1,4 +1,35 @@
+from typing import Callable
 
-def solve(puzzle: list[list[int]])->dict:...
-def generate(n_clues: int, max_retries: int, parallel_exec: bool, verbose: bool)->list[list[int]]:...
-def build_config()->dict:...
\ No newline at end of file
+def solve(puzzle: list[list[int]], timeout: float, check_unique: bool)->dict:...
+def solve_batch(puzzles: list[list[list[int]]], n_threads: int, timeout: float)->list[dict]:...
+def solve_array(puzzles, n_threads: int, with_candidates: bool)->dict:...
+def generate(n_clues: int, max_retries: int, parallel_exec: bool, verbose: bool, timeout: float)->list[list[int]]:...
+def generate_array(n_clues: int, n_puzzles: int, max_retries: int, n_threads: int):...
+class GenerateTask:
+    def __init__(self, n_clues: int, max_retries: int, parallel_exec: bool, timeout: float)->None:...
+    def done(self)->bool:...
+    def cancelled(self)->bool:...
+    def cancel(self)->None:...
+    def add_done_callback(self, callback: Callable[[], None])->None:...
+    def wait(self, timeout: float)->bool:...
+    def result(self)->dict:...
+class SolverSession:
+    def __init__(self, puzzle: list[list[int]])->None:...
+    def place(self, row: int, col: int, value: int)->None:...
+    def erase(self, row: int, col: int)->None:...
+    def get(self, row: int, col: int)->int:...
+    def is_given(self, row: int, col: int)->bool:...
+    def candidates(self, row: int, col: int)->list[int]:...
+    def has_conflict(self)->bool:...
+    def conflicts(self, row: int, col: int)->bool:...
+    def is_solved(self)->bool:...
+    def is_solvable(self, timeout: float = 0.1)->bool | None:...
+    def next_deduction(self)->dict:...
+    def board(self)->list[list[int]]:...
+def build_config()->dict:...
+def reservoir_start(clue_counts: list[int], low_watermark: int, high_watermark: int, n_threads: int, persist_path: str)->None:...
+def reservoir_stop()->None:...
+def reservoir_stats()->dict:...
+def cache_enable(capacity: int)->None:...
+def cache_disable()->None:...
+def cache_stats()->dict:...
@@ -0,0 +1,192 @@
+#include "batch.h"
+#include "board.h"
+#include "dataset.h"
+#include "solver.h"
+#include "util.h"
+#include "config.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace batch
+{
+    // lines per chunk, large enough to amortize the task dispatch, small enough to keep the threads busy
+    static const unsigned int CHUNK_SIZE = 512;
+    // chunks in flight per thread, bounds the memory when the input is faster than the solver
+    static const unsigned int CHUNKS_PER_THREAD = 4;
+    // lines read ahead of the chunks, for the same reason
+    static const unsigned int MAX_PENDING_LINES = CHUNK_SIZE * 4;
+    // a partial chunk is submitted when no line arrives for this long, so that a slow producer gets its answers
+    static const auto IDLE_FLUSH = std::chrono::milliseconds(10);
+
+    struct Chunk
+    {
+        std::vector<std::string> lines;
+        std::string output;
+        BatchStats stats;
+        bool done = false;
+    };
+
+    static void solve_chunk(Chunk& chunk, cache::SolutionCache* solution_cache, double timeout)
+    {
+        chunk.output.reserve(chunk.lines.size() * (CELL_COUNT + 16));
+        char buffer[Board::max_serialized_size(BoardFormat::COMPACT)];
+        Board board, cached;
+        for (auto& line: chunk.lines){
+            if (line.size() < CELL_COUNT || !CompactDataset::decode(line.data(), board)){
+                chunk.output += line;
+                chunk.output += " invalid\n";
+                chunk.stats.n_invalid++;
+                continue;
+            }
+
+            // the puzzles failing the checks are answered before the cache, which only holds puzzles passing them
+            SolveStatus status = check_puzzle(board);
+            std::unique_ptr<Solver> solver;
+            if (status == SolveStatus::UNSOLVED){
+                bool solved = false;
+                std::unique_ptr<cache::Key> key;
+                if (solution_cache){
+                    key.reset(new cache::Key(board));
+                }
+                if (key && solution_cache->lookup(*key, cached, solved)){
+                    status = solved ? SolveStatus::SOLVED : SolveStatus::UNSOLVED;
+                }
+                else{
+                    // the solver is large on big boards, keep it off the stack
+                    solver.reset(new Solver(board));
+                    try{ status = solver->solve(SolveLimits::within(timeout)); } catch (std::exception&){ status = SolveStatus::UNSOLVED; }
+                    if (status == SolveStatus::SOLVED && !solver->board().is_solved()) status = SolveStatus::UNSOLVED;
+                    // the cache answers solved or unsolved, a timeout or a contradiction is not kept
+                    if (key && (status == SolveStatus::SOLVED || status == SolveStatus::UNSOLVED)){
+                        solution_cache->insert(*key, status == SolveStatus::SOLVED ? solver->board() : board, status == SolveStatus::SOLVED);
+                    }
+                }
+            }
+            bool solved = status == SolveStatus::SOLVED;
+            const Board& result = !solved ? board : (solver ? solver->board() : cached);
+            // the compact format ends with a newline, replaced by the status
+            size_t n = result.serialize(buffer, BoardFormat::COMPACT) - 1;
+            chunk.output.append(buffer, n);
+            chunk.output += ' ';
+            chunk.output += solve_status_name(status);
+            chunk.output += '\n';
+            if (solved) chunk.stats.n_solved++;
+            else if (status == SolveStatus::TIMEOUT) chunk.stats.n_timeout++;
+            else if (status == SolveStatus::INVALID) chunk.stats.n_invalid++;
+            else chunk.stats.n_unsolved++;
+        }
+        chunk.lines.clear();
+    }
+
+    BatchStats solve_stream(std::istream& in, std::ostream& out, unsigned int n_threads, cache::SolutionCache* solution_cache,
+        double timeout)
+    {
+        util::ThreadPool pool(n_threads);
+        const unsigned int max_in_flight = CHUNKS_PER_THREAD * pool.size();
+
+        std::mutex mtx;
+        std::condition_variable cv;
+        std::deque<std::shared_ptr<Chunk>> in_flight;
+        BatchStats stats;
+
+        // write the finished chunks at the front, in the input order
+        auto flush = [&](bool wait_all){
+            while (true){
+                std::shared_ptr<Chunk> front;
+                {
+                    std::unique_lock<std::mutex> lock(mtx);
+                    if (in_flight.empty()) return;
+                    bool must_wait = wait_all || in_flight.size() >= max_in_flight;
+                    if (must_wait) cv.wait(lock, [&](){ return in_flight.front()->done; });
+                    if (!in_flight.front()->done) return;
+                    front = in_flight.front();
+                    in_flight.pop_front();
+                }
+                out.write(front->output.data(), front->output.size());
+                stats.n_solved += front->stats.n_solved;
+                stats.n_unsolved += front->stats.n_unsolved;
+                stats.n_invalid += front->stats.n_invalid;
+                stats.n_timeout += front->stats.n_timeout;
+            }
+        };
+
+        auto submit = [&](std::shared_ptr<Chunk> chunk){
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                in_flight.push_back(chunk);
+            }
+            pool.submit([chunk, solution_cache, timeout, &mtx, &cv](){
+                solve_chunk(*chunk, solution_cache, timeout);
+                std::lock_guard<std::mutex> lock(mtx);
+                chunk->done = true;
+                cv.notify_all();
+            });
+            flush(false);
+        };
+
+        // the input is read on a thread of its own, so that a read waiting for a slow producer
+        // does not hold back the lines already read
+        std::mutex read_mtx;
+        std::condition_variable read_cv;
+        std::vector<std::string> pending;
+        bool end_of_input = false;
+        std::thread reader([&](){
+            for (std::string line; std::getline(in, line);){
+                if (!line.empty() && line.back() == '\r') line.pop_back();
+                if (line.empty()) continue;
+                std::unique_lock<std::mutex> lock(read_mtx);
+                read_cv.wait(lock, [&](){ return pending.size() < MAX_PENDING_LINES; });
+                pending.push_back(std::move(line));
+                read_cv.notify_all();
+            }
+            std::lock_guard<std::mutex> lock(read_mtx);
+            end_of_input = true;
+            read_cv.notify_all();
+        });
+
+        auto chunk = std::make_shared<Chunk>();
+        chunk->lines.reserve(CHUNK_SIZE);
+        std::vector<std::string> lines;
+        while (true){
+            bool done;
+            {
+                std::unique_lock<std::mutex> lock(read_mtx);
+                read_cv.wait_for(lock, IDLE_FLUSH, [&](){ return !pending.empty() || end_of_input; });
+                std::swap(lines, pending);
+                done = end_of_input && lines.empty();
+                read_cv.notify_all();
+            }
+            if (done) break;
+            if (lines.empty()){
+                // the producer is idle: solve what was read so far and write the finished chunks
+                if (!chunk->lines.empty()){
+                    submit(chunk);
+                    chunk = std::make_shared<Chunk>();
+                    chunk->lines.reserve(CHUNK_SIZE);
+                }
+                flush(false);
+                out.flush();
+                continue;
+            }
+            for (auto& line: lines){
+                chunk->lines.push_back(std::move(line));
+                if (chunk->lines.size() >= CHUNK_SIZE){
+                    submit(chunk);
+                    chunk = std::make_shared<Chunk>();
+                    chunk->lines.reserve(CHUNK_SIZE);
+                }
+            }
+            lines.clear();
+        }
+        reader.join();
+        if (!chunk->lines.empty()) submit(chunk);
+        flush(true);
+        out.flush();
+        return stats;
+    }
+}
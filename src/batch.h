@@ -0,0 +1,36 @@
+/*
+Batch solving of a stream of puzzles, one per line in the compact format.
+The lines are grouped into chunks and solved on a pool of threads,
+the output is written chunk by chunk in the input order, each line as:
+    <board in the compact format> <status>
+where the status is the name of the SolveStatus of the puzzle: "solved" (the solution is written),
+"unsolved", "contradiction", "invalid" or "timeout" (the input board is written).
+A line that can not be read as a board is written as is, followed by "invalid".
+As the rest of a line is ignored by the dataset reader,
+the output can be read back as a dataset.
+The input is read on a thread of its own: when no line arrives for a short while,
+the partial chunk is solved and the output flushed, so that a producer writing a few lines
+and waiting for their answers (as through a pipe) is not held until the end of the input.
+With a solution cache, repeated and equivalent puzzles are answered from the cache.
+*/
+
+#pragma once
+#include "solution_cache.h"
+#include <iostream>
+#include <string>
+
+namespace batch
+{
+    struct BatchStats
+    {
+        unsigned long n_solved = 0;
+        unsigned long n_unsolved = 0;
+        unsigned long n_invalid = 0;
+        unsigned long n_timeout = 0;
+    };
+
+    // solve until the end of the input, empty lines are skipped.
+    // each puzzle is given timeout seconds, 0 for no limit
+    BatchStats solve_stream(std::istream& in, std::ostream& out, unsigned int n_threads, cache::SolutionCache* solution_cache = nullptr,
+        double timeout = 0);
+}
@@ -0,0 +1,164 @@
+#include "batch.h"
+#include "generate.h"
+#include "config.h"
+#include "testing.h"
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <streambuf>
+#include <thread>
+#include <vector>
+
+// an input fed line by line by the test, a read waits for the next line or the end, as on a pipe
+class SlowInput : public std::streambuf
+{
+public:
+    void feed(const std::string& text){
+        std::lock_guard<std::mutex> lock(m_mtx);
+        m_queue += text;
+        m_cv.notify_all();
+    }
+    void close(){
+        std::lock_guard<std::mutex> lock(m_mtx);
+        m_closed = true;
+        m_cv.notify_all();
+    }
+protected:
+    int_type underflow() override {
+        std::unique_lock<std::mutex> lock(m_mtx);
+        m_cv.wait(lock, [&](){ return !m_queue.empty() || m_closed; });
+        if (m_queue.empty()) return traits_type::eof();
+        m_buffer.swap(m_queue);
+        m_queue.clear();
+        setg(&m_buffer[0], &m_buffer[0], &m_buffer[0] + m_buffer.size());
+        return traits_type::to_int_type(m_buffer[0]);
+    }
+private:
+    std::mutex m_mtx;
+    std::condition_variable m_cv;
+    std::string m_queue, m_buffer;
+    bool m_closed = false;
+};
+
+// an output read by the test while it is written
+class SharedOutput : public std::streambuf
+{
+public:
+    std::string str(){
+        std::lock_guard<std::mutex> lock(m_mtx);
+        return m_text;
+    }
+protected:
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        m_text.append(s, n);
+        return n;
+    }
+    int_type overflow(int_type c) override {
+        if (!traits_type::eq_int_type(c, traits_type::eof())){
+            char ch = traits_type::to_char_type(c);
+            xsputn(&ch, 1);
+        }
+        return traits_type::not_eof(c);
+    }
+private:
+    std::mutex m_mtx;
+    std::string m_text;
+};
+
+int main(){
+    // enough lines for several chunks, with an invalid one in between
+    const unsigned int n_puzzles = 1200;
+    std::vector<Board> solutions(n_puzzles);
+    std::stringstream in;
+    for (unsigned int i = 0; i < n_puzzles; i++){
+        gen::fill_valid_board(solutions[i], gen::FillStrategy::RANDOM);
+        Board puzzle(solutions[i]);
+        for (unsigned int j = i % 11; j < CELL_COUNT; j += 11) puzzle.set(j, 0);
+        in << puzzle.to_string(BoardFormat::COMPACT);
+        if (i == 700) in << "not a puzzle\n\n";
+    }
+
+    std::stringstream out;
+    auto stats = batch::solve_stream(in, out, 3);
+    ASSERT_TRUE(stats.n_solved == n_puzzles && stats.n_invalid == 1 && stats.n_unsolved == 0);
+
+    // the output keeps the input order
+    bool ordered = true;
+    unsigned int i = 0;
+    for (std::string line; std::getline(out, line);){
+        if (line == "not a puzzle invalid") continue;
+        Board expected(solutions[i++]);
+        ordered = ordered && line == expected.to_string(BoardFormat::COMPACT).substr(0, CELL_COUNT) + " solved";
+    }
+    ASSERT_TRUE(ordered && i == n_puzzles);
+
+    // with a cache, equivalent puzzles are solved once, and the output is the same
+    std::stringstream repeated;
+    std::mt19937 rng(3);
+    for (unsigned int k = 0; k < 1000; k++){
+        Board puzzle(solutions[k % 10]), transformed;
+        for (unsigned int j = k % 10; j < CELL_COUNT; j += 11) puzzle.set(j, 0);
+        canonical::Transform::random(rng).apply(puzzle, transformed);
+        repeated << transformed.to_string(BoardFormat::COMPACT);
+    }
+    std::stringstream out_plain, out_cached, repeated_copy(repeated.str());
+    cache::SolutionCache solution_cache(100);
+    batch::solve_stream(repeated, out_plain, 2);
+    stats = batch::solve_stream(repeated_copy, out_cached, 2, &solution_cache);
+    auto cache_stats = solution_cache.stats();
+    ASSERT_TRUE(stats.n_solved == 1000 && out_cached.str() == out_plain.str());
+    ASSERT_TRUE(cache_stats.n_hits + cache_stats.n_misses == 1000 && cache_stats.n_hits >= 1000 - 10 * 2);
+
+    // each line gets the status of its solve, and the time limit applies to each puzzle
+    {
+        Board empty, conflicting, contradiction;
+        empty.clear(0);
+        conflicting.clear(0);
+        conflicting.set(0, 0, 1);
+        conflicting.set(0, 1, 1);
+        contradiction.clear(0);
+        for (unsigned int c = 0; c + 1 < BOARD_SIZE; c++) contradiction.set(0, c, c + 1);
+        contradiction.set(CELL_COUNT - 1, BOARD_SIZE);
+        std::stringstream checked_in, checked_out, timed_in, timed_out;
+        checked_in << conflicting.to_string(BoardFormat::COMPACT) << contradiction.to_string(BoardFormat::COMPACT);
+        auto checked_stats = batch::solve_stream(checked_in, checked_out, 1);
+        std::string line;
+        std::getline(checked_out, line);
+        ASSERT_TRUE(line == conflicting.to_string(BoardFormat::COMPACT).substr(0, CELL_COUNT) + " invalid");
+        std::getline(checked_out, line);
+        ASSERT_TRUE(line == contradiction.to_string(BoardFormat::COMPACT).substr(0, CELL_COUNT) + " contradiction");
+        ASSERT_TRUE(checked_stats.n_invalid == 1 && checked_stats.n_unsolved == 1);
+
+        timed_in << empty.to_string(BoardFormat::COMPACT);
+        auto timed_stats = batch::solve_stream(timed_in, timed_out, 1, nullptr, 1e-9);
+        ASSERT_TRUE(timed_out.str() == empty.to_string(BoardFormat::COMPACT).substr(0, CELL_COUNT) + " timeout\n");
+        ASSERT_TRUE(timed_stats.n_timeout == 1 && timed_stats.n_solved == 0);
+    }
+
+    // a partial chunk is answered while the input stays open
+    {
+        SlowInput slow_input;
+        SharedOutput shared_output;
+        std::istream slow_in(&slow_input);
+        std::ostream shared_out(&shared_output);
+        batch::BatchStats slow_stats;
+        std::thread solver([&](){ slow_stats = batch::solve_stream(slow_in, shared_out, 2); });
+        Board puzzle(solutions[0]);
+        puzzle.set(0, 0);
+        slow_input.feed(puzzle.to_string(BoardFormat::COMPACT));
+        bool answered = false;
+        for (unsigned int t = 0; t < 500 && !answered; t++){
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            answered = shared_output.str().find(" solved\n") != std::string::npos;
+        }
+        slow_input.feed(puzzle.to_string(BoardFormat::COMPACT));
+        slow_input.close();
+        solver.join();
+        ASSERT_TRUE(answered && slow_stats.n_solved == 2);
+    }
+    return testing::exit_code();
+}
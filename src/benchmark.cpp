@@ -1,5 +1,10 @@
 #include "config.h"
 #include "solver.h"
+#include "generate.h"
+#include "parser.hpp"
+#include "dataset.h"
+#include "packed.h"
+#include "canonical.h"
 
 #include <chrono>
 #include <cstdlib>
@@ -9,45 +14,13 @@
 #include <array>
 
 
-/*
-most of the dataset are stored compactly in a single line, 
-with each character representing a cell in the sudoku board.
-this function will do:
-- read the first CELL_COUNT characters
-- replace a-z with 10-35 (for 16x16 and 25x25 sudoku)
-- replace A-Z with 10-35 (case insensitive)
-- replace . with 0
-- format the line to a CELL_COUNT array
-*/
-std::array<val_t, CELL_COUNT> data_from_compact_line(std::string line){
-    if (line.size() < CELL_COUNT){
-        throw std::runtime_error("Invalid line size");
-    }
-
-    std::string valid_str = line.substr(0, CELL_COUNT);
-    std::array<val_t, CELL_COUNT> board_data;
-
-    for (unsigned int i=0; i<CELL_COUNT; i++){
-        char& c = valid_str[i];
-        if (c >= 'a' && c <= 'z'){
-            board_data[i] = c - 'a' + 10;
-        } else if (c >= 'A' && c <= 'Z'){
-            board_data[i] = c - 'A' + 10;
-        } else if (c == '.'){
-            board_data[i] = 0;
-        } else {
-            board_data[i] = std::stoi(std::string(1, c));
-        }
-    }
-
-    return board_data;
-}
-
 struct CaseResult
 {
     std::chrono::duration<double> time;
     bool solved;
+    SolveStatus status;
     unsigned int n_guesses;
+    unsigned int max_depth;
 };
 
 template <typename T>
@@ -58,13 +31,15 @@ CaseResult solve_for(T content)
 
     auto start = std::chrono::high_resolution_clock::now();
     Solver solver(board);
-    bool ret = solver.solve();
+    SolveStatus status = solver.solve(SolveLimits());
     auto end = std::chrono::high_resolution_clock::now();
 
     CaseResult res;
     res.time = end - start;
-    res.solved = ret;
+    res.solved = status == SolveStatus::SOLVED;
+    res.status = status;
     res.n_guesses = solver.iteration_counter().n_guesses;
+    res.max_depth = solver.iteration_counter().max_depth;
 
     return res;
 }
@@ -102,21 +77,35 @@ int run_default_test(){
 }
 
 int run_test_on_file(const std::string& filename){
-    std::ifstream file(filename);
-    if (!file.is_open()){
-        return 1;
-    }
-
-    std::string line_content;
     std::vector<CaseResult> results;
-    while (std::getline(file, line_content)){
-        if (line_content.size() < CELL_COUNT){
-            continue;
+    std::chrono::duration<double> parse_time = std::chrono::duration<double>::zero();
+    try{
+        Board board;
+        if (packed::is_packed_file(filename)){
+            packed::Reader reader(filename);
+            for (uint64_t i = 0; i < reader.size(); i++){
+                auto start = std::chrono::high_resolution_clock::now();
+                reader.load(i, board);
+                parse_time += std::chrono::high_resolution_clock::now() - start;
+                results.push_back(solve_for(board));
+            }
+        }
+        else{
+            CompactDataset dataset(filename);
+            while (true){
+                auto start = std::chrono::high_resolution_clock::now();
+                bool has_next = dataset.next(board);
+                parse_time += std::chrono::high_resolution_clock::now() - start;
+                if (!has_next) break;
+                results.push_back(solve_for(board));
+            }
         }
-        auto data = data_from_compact_line(line_content);
-        auto data_vector = std::vector<val_t>(data.begin(), data.end());
-        auto res = solve_for(data_vector);
-        results.push_back(res);
+    } catch (std::runtime_error& e){
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    if (results.empty()){
+        return 1;
     }
 
     // print statistics
@@ -160,9 +149,15 @@ int run_test_on_file(const std::string& filename){
         return max;
     })();
 
+    unsigned int max_depth = 0;
+    for (auto& res : results){
+        if (res.max_depth > max_depth) max_depth = res.max_depth;
+    }
+
     std::cout << "Finished on " << n << " cases" << std::endl;
     std::cout << "Success rate: " << success_rate * 100 << "%" << std::endl;
     std::cout << "Mean time: " << total_time_us / n << " [us]" << std::endl;
+    std::cout << "Mean parse time: " << std::chrono::duration_cast<std::chrono::nanoseconds>(parse_time).count() / n << " [ns]" << std::endl;
     std::cout << "Median time: " << median_time_us << " [us]" << std::endl;
     std::cout << "Max time: " << max_time_us << " [us]" << std::endl;
     std::cout << "1st quartile time: " << one_quartile_time_us << " [us]" << std::endl;
@@ -170,12 +165,89 @@ int run_test_on_file(const std::string& filename){
     std::cout << "Average guesses: " << average_guesses << std::endl;
     std::cout << "Median guesses: " << median_guesses << std::endl;
     std::cout << "Max guesses: " << max_guesses << std::endl;
+    std::cout << "Max guess depth: " << max_depth << std::endl;
+
+    // the cases not solved, by the reason they failed
+    const SolveStatus failures[] = {SolveStatus::UNSOLVED, SolveStatus::INVALID, SolveStatus::CONTRADICTION};
+    for (SolveStatus status : failures){
+        unsigned int count = 0;
+        for (auto& res : results){
+            count += res.status == status;
+        }
+        if (count > 0) std::cout << "Status " << solve_status_name(status) << ": " << count << std::endl;
+    }
 
     return 0;
 };
 
+int run_fill_test(unsigned int n_grids){
+    std::cout << "Filling " << n_grids << " grids (" << BOARD_SIZE << "x" << BOARD_SIZE << ")..." << std::endl;
+    Board board;
+    unsigned int n_valid = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (unsigned int i = 0; i < n_grids; i++){
+        gen::fill_valid_board(board, gen::FillStrategy::RANDOM);
+        n_valid += board.is_solved();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    double total_s = std::chrono::duration<double>(end - start).count();
+    std::cout << "Valid grids: " << n_valid << "/" << n_grids << std::endl;
+    std::cout << "Mean time: " << static_cast<unsigned long>(total_s * 1e6 / n_grids) << " [us]" << std::endl;
+    std::cout << "Throughput: " << static_cast<unsigned long>(n_grids / total_s) << " [grids/s]" << std::endl;
+    return n_valid == n_grids ? 0 : 1;
+}
+
+int run_canon_test(const std::string& filename, unsigned int n_boards){
+    std::vector<Board> boards;
+    if (filename.empty()){
+        for (unsigned int i = 0; i < 9; i++){
+            boards.emplace_back();
+            boards.back().load_from_file("puzzles/" + std::to_string(i+1) + ".txt");
+        }
+    } else {
+        CompactDataset dataset(filename);
+        Board board;
+        while (dataset.next(board)) boards.emplace_back(board);
+    }
+    if (boards.empty()){
+        throw std::runtime_error("No board in: " + filename);
+    }
+    std::vector<Board> canonical_boards(boards.size());
+    for (size_t i = 0; i < boards.size(); i++){
+        canonical::minlex(boards[i], canonical_boards[i]);
+    }
+
+    // canonicalise random equivalents of the boards, which must give the same forms
+    std::cout << "Canonicalising " << n_boards << " boards..." << std::endl;
+    std::mt19937 rng(0);
+    Board shuffled, canonical_board;
+    unsigned int n_mismatches = 0;
+    std::chrono::duration<double> total_time = std::chrono::duration<double>::zero();
+    for (unsigned int i = 0; i < n_boards; i++){
+        canonical::Transform::random(rng).apply(boards[i % boards.size()], shuffled);
+        auto start = std::chrono::high_resolution_clock::now();
+        canonical::minlex(shuffled, canonical_board);
+        total_time += std::chrono::high_resolution_clock::now() - start;
+        n_mismatches += !(canonical_board == canonical_boards[i % boards.size()]);
+    }
+
+    double total_s = total_time.count();
+    std::cout << "Mismatches: " << n_mismatches << "/" << n_boards << std::endl;
+    std::cout << "Mean time: " << static_cast<unsigned long>(total_s * 1e6 / n_boards) << " [us]" << std::endl;
+    std::cout << "Throughput: " << static_cast<unsigned long>(n_boards / total_s) << " [boards/s]" << std::endl;
+    return n_mismatches == 0 ? 0 : 1;
+}
+
 int main(int argc, char* argv[])
 {
+    auto parser = parser::CommandlineParser(argc, argv);
+    if (parser.has_subparser("fill")){
+        exit(run_fill_test(parser.parse_arg<unsigned int>("-n", 10000)));
+    }
+    if (parser.has_subparser("canon")){
+        exit(run_canon_test(parser.parse_arg<std::string>("-i", ""), parser.parse_arg<unsigned int>("-n", 10000)));
+    }
 
     if (argc == 1){
         exit(run_default_test());
@@ -185,6 +257,6 @@ int main(int argc, char* argv[])
         exit(run_test_on_file(argv[1]));
     }
 
-    std::cout << "Usage: " << argv[0] << " [filename]" << std::endl;
+    std::cout << "Usage: " << argv[0] << " [filename] | fill [-n <n_grids>] | canon [-i <dataset>] [-n <n_boards>]" << std::endl;
 
 }
@@ -1,15 +1,35 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>       // for automatic conversion of std::vector
+#include <pybind11/numpy.h>
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include <chrono>
 
 #include "config.h"
 #include "solver.h"
+#include "bit_search.h"
 #include "board.h"
 #include "generate.h"
+#include "reservoir.h"
+#include "solution_cache.h"
+#include "session.h"
+#include "util.h"
 
 namespace py = pybind11;
 
+// opt-in pool of ready puzzles, used by generate when running, shared so that a generation
+// running without the GIL keeps the reservoir it started with when reservoir_start replaces it
+static std::shared_ptr<gen::Reservoir> g_reservoir;
+// opt-in cache of solutions, used by solve when enabled, shared so that a solve running
+// without the GIL keeps the cache it started with when it is dropped or replaced meanwhile
+static std::shared_ptr<cache::SolutionCache> g_cache;
+
 std::vector<std::vector<val_t>> board_to_vector(Board& b){
     std::vector<std::vector<val_t>> data;
     val_t* raw_data = b.data();
@@ -23,26 +43,248 @@ std::vector<std::vector<val_t>> board_to_vector(Board& b){
     return data;
 }
 
+// the result of a solve, filled without touching Python objects so that it can run on native threads
+struct SolveOutcome
+{
+    bool solved = false;
+    SolveStatus status = SolveStatus::UNSOLVED;
+    unsigned long iterations = 0;
+    unsigned long n_guesses = 0;
+    unsigned int max_depth = 0;
+    long time_us = 0;
+    bool from_cache = false;
+    Board board;
+};
+
+// timeout in seconds, none if not positive, check_unique reports a solved puzzle with another solution as MULTIPLE,
+// solution_cache is a snapshot of g_cache taken with the GIL held, null when the cache is disabled
+void solve_native(const Board& puzzle, SolveOutcome& outcome, cache::SolutionCache* solution_cache,
+                  double timeout = 0, bool check_unique = false){
+    auto start_time = std::chrono::high_resolution_clock::now();
+    std::unique_ptr<cache::Key> key;
+    if (solution_cache){
+        key.reset(new cache::Key(puzzle));
+        outcome.from_cache = solution_cache->lookup(*key, outcome.board, outcome.solved);
+    }
+    if (!outcome.from_cache){
+        // the solver is large on big boards, keep it off the stack
+        auto solver = std::unique_ptr<Solver>(new Solver(puzzle));
+        outcome.status = solver->solve(SolveLimits::within(timeout));
+        outcome.solved = outcome.status == SolveStatus::SOLVED;
+        outcome.iterations = solver->iteration_counter().current;
+        outcome.n_guesses = solver->iteration_counter().n_guesses;
+        outcome.max_depth = solver->iteration_counter().max_depth;
+        outcome.board.load_data(solver->board());
+        // a timed out solve says nothing about the puzzle
+        if (key && outcome.status != SolveStatus::TIMEOUT) solution_cache->insert(*key, outcome.board, outcome.solved);
+    }
+    else{
+        // the reason of a cached failure is found again by the precheck, which is cheap
+        outcome.status = outcome.solved ? SolveStatus::SOLVED : check_puzzle(puzzle);
+    }
+    if (check_unique && outcome.solved && BitSearch().count(puzzle, 2) > 1){
+        outcome.status = SolveStatus::MULTIPLE;
+    }
+    auto end_time = std::chrono::high_resolution_clock::now();
+    outcome.time_us = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time).count();
+}
+
+py::dict outcome_to_dict(SolveOutcome& outcome){
+    py::dict result;
+    result["solved"] = outcome.solved;
+    result["status"] = solve_status_name(outcome.status);
+    result["iterations"] = outcome.iterations;
+    result["iteration_limit"] = static_cast<unsigned long>(MAX_ITER);
+    result["n_guesses"] = outcome.n_guesses;
+    result["max_depth"] = outcome.max_depth;
+    result["data"] = board_to_vector(outcome.board);
+    result["time_us"] = outcome.time_us;
+    result["from_cache"] = outcome.from_cache;
+    return result;
+}
+
 py::dict solve(
-    std::vector<std::vector<val_t>> input
+    std::vector<std::vector<val_t>> input,
+    double timeout,
+    bool check_unique
 ){
     Board b;
     b.load_data(input);
+    SolveOutcome outcome;
+    solve_native(b, outcome, g_cache.get(), timeout, check_unique);
+    return outcome_to_dict(outcome);
+}
 
-    auto start_time = std::chrono::high_resolution_clock::now();
-    Solver solver(b);
-    bool solved = solver.solve();
-    auto end_time = std::chrono::high_resolution_clock::now();
+// run task(i) for i in [0, n) on native threads, the caller holds the GIL which is released meanwhile,
+// the signals are checked once per millisecond while waiting, an interrupt skips the tasks not started yet
+void run_parallel(size_t n, unsigned int n_threads, const std::function<void(size_t)>& task){
+    bool interrupted = false;
+    {
+        py::gil_scoped_release release;
+        util::ThreadPool pool(n_threads > 0 ? n_threads : std::max(std::thread::hardware_concurrency(), 1u));
+        std::atomic_bool stop_flag(false);
+        std::atomic_size_t n_done(0);
+        std::mutex mtx;
+        std::condition_variable cv;
+        for (size_t i = 0; i < n; i++){
+            pool.submit([&, i](){
+                try{
+                    if (!stop_flag) task(i);
+                } catch (std::exception&){}
+                std::lock_guard<std::mutex> lock(mtx);
+                n_done++;
+                cv.notify_all();
+            });
+        }
+
+        std::unique_lock<std::mutex> lock(mtx);
+        while (n_done < n){
+            cv.wait_for(lock, std::chrono::milliseconds(1), [&](){ return n_done == n; });
+            if (n_done == n || stop_flag) continue;
+            lock.unlock();
+            {
+                py::gil_scoped_acquire acquire;
+                interrupted = PyErr_CheckSignals() != 0;
+            }
+            lock.lock();
+            if (interrupted) stop_flag = true;
+        }
+        lock.unlock();
+        pool.wait();
+    }
+    if (interrupted){
+        throw py::error_already_set();
+    }
+}
+
+py::list solve_batch(
+    std::vector<std::vector<std::vector<val_t>>> inputs,
+    unsigned int n_threads,
+    double timeout
+){
+    size_t n = inputs.size();
+    std::vector<Board> puzzles(n);
+    for (size_t i = 0; i < n; i++){
+        puzzles[i].load_data(inputs[i]);
+    }
+    std::vector<SolveOutcome> outcomes(n);
+    // held until the tasks are done, cache_disable may run while the GIL is released
+    std::shared_ptr<cache::SolutionCache> solution_cache = g_cache;
+    run_parallel(n, n_threads, [&](size_t i){ solve_native(puzzles[i], outcomes[i], solution_cache.get(), timeout); });
+
+    py::list results;
+    for (auto& outcome: outcomes){
+        results.append(outcome_to_dict(outcome));
+    }
+    return results;
+}
+
+// a (N, N) board or a (B, N, N) stack of boards of uint8 or uint16, read and written in place through its strides
+struct BoardArray
+{
+    py::buffer_info info;
+    size_t n_boards;
+    bool stacked;
+
+    BoardArray(py::array& array, bool writable): info(array.request(writable))
+    {
+        if (info.itemsize != 1 && info.itemsize != 2){
+            throw py::value_error("The boards should be an array of uint8 or uint16");
+        }
+        if (info.format != py::format_descriptor<uint8_t>::format() && info.format != py::format_descriptor<uint16_t>::format()){
+            throw py::value_error("The boards should be an array of unsigned integers");
+        }
+        stacked = info.ndim == 3;
+        if ((info.ndim != 2 && info.ndim != 3) || info.shape[info.ndim - 1] != BOARD_SIZE || info.shape[info.ndim - 2] != BOARD_SIZE){
+            throw py::value_error("The boards should have the shape (N, N) or (B, N, N), with N = " + std::to_string(BOARD_SIZE));
+        }
+        n_boards = stacked ? info.shape[0] : 1;
+    }
 
-    auto data = board_to_vector(solver.board());
+    char* cell(size_t b, unsigned int row, unsigned int col) const
+    {
+        char* ptr = static_cast<char*>(info.ptr) + row * info.strides[info.ndim - 2] + col * info.strides[info.ndim - 1];
+        return stacked ? ptr + b * info.strides[0] : ptr;
+    }
+
+    void load(size_t b, Board& board) const
+    {
+        val_t* data = board.data();
+        for (unsigned int i = 0; i < BOARD_SIZE; i++){
+            for (unsigned int j = 0; j < BOARD_SIZE; j++){
+                const char* ptr = cell(b, i, j);
+                data[i * BOARD_SIZE + j] = info.itemsize == 1 ? *reinterpret_cast<const uint8_t*>(ptr) : *reinterpret_cast<const uint16_t*>(ptr);
+            }
+        }
+    }
+
+    void store(size_t b, const Board& board) const
+    {
+        const val_t* data = board.data();
+        for (unsigned int i = 0; i < BOARD_SIZE; i++){
+            for (unsigned int j = 0; j < BOARD_SIZE; j++){
+                char* ptr = cell(b, i, j);
+                if (info.itemsize == 1) *reinterpret_cast<uint8_t*>(ptr) = static_cast<uint8_t>(data[i * BOARD_SIZE + j]);
+                else *reinterpret_cast<uint16_t*>(ptr) = data[i * BOARD_SIZE + j];
+            }
+        }
+    }
+};
+
+py::dict solve_array(
+    py::array puzzles,
+    unsigned int n_threads,
+    bool with_candidates
+){
+    BoardArray input(puzzles, false);
+    // the solutions have the dtype and the shape of the puzzles
+    py::array solutions(puzzles.dtype(), input.info.shape);
+    BoardArray output(solutions, true);
+    py::array_t<bool> solved(std::vector<ssize_t>{static_cast<ssize_t>(input.n_boards)});
+    bool* solved_data = solved.mutable_data();
+
+    const size_t n_cells = CELL_COUNT * CANDIDATE_SIZE;
+    std::vector<ssize_t> candidates_shape = {BOARD_SIZE, BOARD_SIZE, CANDIDATE_SIZE};
+    if (input.stacked) candidates_shape.insert(candidates_shape.begin(), input.n_boards);
+    py::array_t<bool> candidates;
+    bool* candidates_data = nullptr;
+    if (with_candidates && input.stacked){
+        candidates = py::array_t<bool>(candidates_shape);
+        candidates_data = candidates.mutable_data();
+    }
+
+    // a single puzzle keeps its solver, so that the candidates are a view of its state
+    std::unique_ptr<Solver> kept_solver;
+    run_parallel(input.n_boards, input.stacked ? n_threads : 1, [&](size_t b){
+        Board board;
+        input.load(b, board);
+        auto solver = std::unique_ptr<Solver>(new Solver(board));
+        solved_data[b] = solver->solve();
+        output.store(b, solver->board());
+        if (candidates_data){
+            std::memcpy(candidates_data + b * n_cells, solver->candidates().data(), n_cells);
+        }
+        if (!input.stacked) kept_solver = std::move(solver);
+    });
 
     py::dict result;
-    result["solved"] = solved;
-    result["iterations"] = solver.iteration_counter().current;
-    result["iteration_limit"] = solver.iteration_counter().limit;
-    result["n_guesses"] = solver.iteration_counter().n_guesses;
-    result["data"] = data;
-    result["time_us"] = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time).count();
+    result["data"] = solutions;
+    if (input.stacked){
+        result["solved"] = solved;
+    }
+    else{
+        result["solved"] = solved_data[0];
+    }
+    if (with_candidates && !input.stacked && kept_solver){
+        static_assert(sizeof(bool_) == sizeof(bool), "the candidates are viewed as a bool array");
+        const bool* data = reinterpret_cast<const bool*>(kept_solver->candidates().data());
+        Solver* owner = kept_solver.release();
+        py::capsule base(owner, [](void* ptr){ delete static_cast<Solver*>(ptr); });
+        result["candidates"] = py::array_t<bool>(candidates_shape, data, base);
+    }
+    else if (with_candidates){
+        result["candidates"] = candidates;
+    }
     return result;
 }
 
@@ -50,14 +292,26 @@ py::dict generate(
     unsigned int n_clues_remain, 
     unsigned int max_retries, 
     bool parallel_exec, 
-    bool verbose
+    bool verbose,
+    double timeout
 ){
     Board b;
     auto start_time = std::chrono::high_resolution_clock::now();
-    auto [generated, board] = gen::generate_board(n_clues_remain, max_retries, parallel_exec, verbose);
+    if (g_reservoir && g_reservoir->running() && g_reservoir->pop(n_clues_remain, b)){
+        auto end_time = std::chrono::high_resolution_clock::now();
+        py::dict result;
+        result["data"] = board_to_vector(b);
+        result["time_us"] = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time).count();
+        result["n_clues"] = n_clues_remain;
+        result["exact"] = true;
+        result["from_reservoir"] = true;
+        return result;
+    }
+    auto [generated, board, n_clues] = gen::generate_board(n_clues_remain, max_retries, parallel_exec, verbose, timeout);
     auto end_time = std::chrono::high_resolution_clock::now();
 
-    if (!generated){
+    // with a time limit, the best board found is returned instead
+    if (!generated && (timeout <= 0 || n_clues == 0)){
         throw std::runtime_error("Failed to generate a board with " + std::to_string(n_clues_remain) + " clues remaining");
     }
 
@@ -66,6 +320,278 @@ py::dict generate(
     py::dict result;
     result["data"] = data;
     result["time_us"] = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time).count();
+    result["n_clues"] = n_clues;
+    result["exact"] = generated;
+    result["from_reservoir"] = false;
+    return result;
+}
+
+// a generation running on its own native thread, so that the caller is not blocked,
+// it can be polled, waited for with the GIL released, or cancelled through the stop flag of the generator,
+// the done callbacks are called on that thread, with the GIL, once the generation is done
+class GenerateTask
+{
+public:
+    GenerateTask(unsigned int n_clues_remain, unsigned int max_retries, bool parallel_exec, double timeout):
+        m_n_clues_remain(n_clues_remain), m_stop_flag(false), m_cancelled(false), m_done(false),
+        m_generated(false), m_n_clues(0), m_from_reservoir(false), m_time_us(0)
+    {
+        // taken with the GIL held, the thread runs without it
+        std::shared_ptr<gen::Reservoir> reservoir = g_reservoir;
+        m_thread = std::thread([this, reservoir, max_retries, parallel_exec, timeout](){
+            auto start_time = std::chrono::high_resolution_clock::now();
+            try{
+                if (reservoir && reservoir->running() && reservoir->pop(m_n_clues_remain, m_board)){
+                    m_generated = true;
+                    m_n_clues = m_n_clues_remain;
+                    m_from_reservoir = true;
+                }
+                else{
+                    auto [generated, board, n_clues] = gen::generate_board(
+                        m_n_clues_remain, max_retries, parallel_exec, false, timeout, &m_stop_flag);
+                    m_board.load_data(board);
+                    m_generated = generated;
+                    m_n_clues = n_clues;
+                }
+            } catch (std::exception& e){
+                m_error = e.what();
+            }
+            auto end_time = std::chrono::high_resolution_clock::now();
+            m_time_us = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time).count();
+            std::vector<py::function> callbacks;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_done = true;
+                callbacks.swap(m_callbacks);
+                m_cv.notify_all();
+            }
+            if (!callbacks.empty()){
+                py::gil_scoped_acquire acquire;
+                for (auto& callback: callbacks){
+                    try{
+                        callback();
+                    } catch (py::error_already_set& e){
+                        e.discard_as_unraisable("GenerateTask done callback");
+                    }
+                }
+                callbacks.clear();
+            }
+        });
+    }
+
+    ~GenerateTask()
+    {
+        cancel();
+        // the last reference may be dropped by a done callback, on the thread itself
+        if (m_thread.get_id() == std::this_thread::get_id()){
+            m_thread.detach();
+            return;
+        }
+        py::gil_scoped_release release;
+        m_thread.join();
+    }
+
+    bool done() const { return m_done; }
+    bool cancelled() const { return m_cancelled; }
+
+    // callback() is called once the generation is done, on the generation thread, or at once if it is already done
+    void add_done_callback(py::function callback)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_done){
+                m_callbacks.push_back(std::move(callback));
+                return;
+            }
+        }
+        callback();
+    }
+    void cancel()
+    {
+        if (m_done) return;
+        m_cancelled = true;
+        m_stop_flag = true;
+    }
+
+    // wait up to timeout seconds (forever if negative), returns if the generation is done
+    bool wait(double timeout)
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(std::max(timeout, 0.0)));
+        bool interrupted = false;
+        {
+            py::gil_scoped_release release;
+            std::unique_lock<std::mutex> lock(m_mutex);
+            // check the signals once per millisecond while waiting
+            while (!m_done && (timeout < 0 || std::chrono::steady_clock::now() < deadline)){
+                m_cv.wait_for(lock, std::chrono::milliseconds(1));
+                if (m_done) break;
+                lock.unlock();
+                {
+                    py::gil_scoped_acquire acquire;
+                    interrupted = PyErr_CheckSignals() != 0;
+                }
+                lock.lock();
+                if (interrupted) break;
+            }
+        }
+        if (interrupted){
+            throw py::error_already_set();
+        }
+        return m_done;
+    }
+
+    // the result, as returned by generate, blocks until the generation is done,
+    // a cancelled generation returns the best board found before the cancellation
+    py::dict result()
+    {
+        wait(-1);
+        if (!m_error.empty()){
+            throw std::runtime_error(m_error);
+        }
+        if (!m_generated && m_n_clues == 0){
+            throw std::runtime_error("Failed to generate a board with " + std::to_string(m_n_clues_remain) + " clues remaining");
+        }
+        py::dict result;
+        result["data"] = board_to_vector(m_board);
+        result["time_us"] = m_time_us;
+        result["n_clues"] = m_n_clues;
+        result["exact"] = m_generated;
+        result["from_reservoir"] = m_from_reservoir;
+        return result;
+    }
+
+private:
+    unsigned int m_n_clues_remain;
+    std::atomic_bool m_stop_flag;
+    std::atomic_bool m_cancelled;
+    std::atomic_bool m_done;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::thread m_thread;
+    // guarded by m_mutex, taken by the thread when it sets m_done
+    std::vector<py::function> m_callbacks;
+
+    // written by the thread before m_done is set
+    Board m_board;
+    bool m_generated;
+    unsigned int m_n_clues;
+    bool m_from_reservoir;
+    long m_time_us;
+    std::string m_error;
+};
+
+py::array_t<uint8_t> generate_array(
+    unsigned int n_clues_remain,
+    unsigned int n_puzzles,
+    unsigned int max_retries,
+    unsigned int n_threads
+){
+    static_assert(CANDIDATE_SIZE <= 255, "the values are stored as uint8");
+    py::array_t<uint8_t> boards(std::vector<ssize_t>{static_cast<ssize_t>(n_puzzles), BOARD_SIZE, BOARD_SIZE});
+    uint8_t* data = boards.mutable_data();
+    std::vector<char> generated(n_puzzles, 0);
+    // held until the tasks are done, reservoir_start may replace g_reservoir while the GIL is released
+    std::shared_ptr<gen::Reservoir> reservoir = g_reservoir;
+    run_parallel(n_puzzles, n_threads, [&](size_t i){
+        Board board;
+        bool from_reservoir = reservoir && reservoir->running() && reservoir->pop(n_clues_remain, board);
+        if (!from_reservoir){
+            auto [ok, generated_board, n_clues] = gen::generate_board(n_clues_remain, max_retries, false, false, 0);
+            if (!ok) return;
+            board.load_data(generated_board);
+        }
+        const val_t* cells = board.data();
+        for (unsigned int k = 0; k < CELL_COUNT; k++){
+            data[i * CELL_COUNT + k] = static_cast<uint8_t>(cells[k]);
+        }
+        generated[i] = 1;
+    });
+    if (std::find(generated.begin(), generated.end(), 0) != generated.end()){
+        throw std::runtime_error("Failed to generate a board with " + std::to_string(n_clues_remain) + " clues remaining");
+    }
+    return boards;
+}
+
+void reservoir_start(
+    std::vector<unsigned int> clue_counts, 
+    unsigned int low_watermark, 
+    unsigned int high_watermark, 
+    unsigned int n_threads, 
+    std::string persist_path
+){
+    // the previous reservoir is stopped without the GIL, another thread may replace g_reservoir meanwhile
+    if (std::shared_ptr<gen::Reservoir> previous = g_reservoir){
+        py::gil_scoped_release release;
+        previous->stop();
+    }
+    gen::ReservoirConfig config;
+    config.clue_counts = clue_counts;
+    config.low_watermark = low_watermark;
+    config.high_watermark = high_watermark;
+    config.n_threads = n_threads;
+    config.persist_path = persist_path;
+    auto reservoir = std::make_shared<gen::Reservoir>(config);
+    reservoir->start();
+    g_reservoir = reservoir;
+}
+
+void reservoir_stop(){
+    std::shared_ptr<gen::Reservoir> reservoir = g_reservoir;
+    if (!reservoir) return;
+    py::gil_scoped_release release;
+    reservoir->stop();
+}
+
+py::dict reservoir_stats(){
+    py::dict result;
+    if (!g_reservoir) return result;
+    auto stats = g_reservoir->stats();
+    result["running"] = g_reservoir->running();
+    result["n_hits"] = stats.n_hits;
+    result["n_misses"] = stats.n_misses;
+    result["n_generated"] = stats.n_generated;
+    result["hit_rate"] = stats.hit_rate;
+    result["refill_rate"] = stats.refill_rate;
+    result["pool_sizes"] = stats.pool_sizes;
+    return result;
+}
+
+void cache_enable(unsigned long capacity){
+    g_cache = std::make_shared<cache::SolutionCache>(capacity);
+}
+
+void cache_disable(){
+    g_cache.reset();
+}
+
+py::dict cache_stats(){
+    py::dict result;
+    if (!g_cache) return result;
+    auto stats = g_cache->stats();
+    result["n_hits"] = stats.n_hits;
+    result["n_misses"] = stats.n_misses;
+    result["n_evictions"] = stats.n_evictions;
+    result["size"] = stats.size;
+    result["capacity"] = stats.capacity;
+    result["hit_rate"] = stats.hit_rate;
+    return result;
+}
+
+std::vector<val_t> mask_to_values(mask_t mask){
+    std::vector<val_t> values;
+    for (val_t v = 1; v <= CANDIDATE_SIZE; v++){
+        if (mask & (mask_t(1) << (v - 1))) values.push_back(v);
+    }
+    return values;
+}
+
+py::dict hint_to_dict(const Hint& hint){
+    py::dict result;
+    result["type"] = std::string(hint_name(hint.type));
+    result["row"] = hint.row;
+    result["col"] = hint.col;
+    result["value"] = hint.value;
     return result;
 }
 
@@ -80,6 +606,52 @@ py::dict build_config(){
 PYBIND11_MODULE(sudoku, m) {
     m.doc() = "Sudoku solver"; // optional module docstring
     m.def("solve", &solve, "Solve a sudoku puzzle");
+    m.def("solve_batch", &solve_batch, "Solve a list of puzzles on native threads, without holding the GIL");
+    m.def("solve_array", &solve_array, "Solve a (N, N) or (B, N, N) uint8 / uint16 array of puzzles");
     m.def("generate", &generate, "Generate a sudoku puzzle");
+    m.def("generate_array", &generate_array, "Generate puzzles into a (B, N, N) uint8 array");
+    py::class_<GenerateTask>(m, "GenerateTask", "A generation running on a native thread")
+        .def(py::init<unsigned int, unsigned int, bool, double>())
+        .def("done", &GenerateTask::done)
+        .def("cancelled", &GenerateTask::cancelled)
+        .def("cancel", &GenerateTask::cancel)
+        .def("add_done_callback", &GenerateTask::add_done_callback, "Call callback() on the generation thread once done, at once if already done")
+        .def("wait", &GenerateTask::wait, "Wait up to timeout seconds, forever if negative, returns if done")
+        .def("result", &GenerateTask::result, "The result as returned by generate, waits until done");
+    py::class_<SolverSession>(m, "SolverSession", "A board changed one move at a time, with incremental candidates and hints")
+        .def(py::init([](std::vector<std::vector<val_t>> input){
+            Board b;
+            b.load_data(input);
+            return new SolverSession(b);
+        }))
+        .def("place", &SolverSession::place, "Set the value of a cell, 0 to erase it")
+        .def("erase", &SolverSession::erase)
+        .def("get", &SolverSession::get)
+        .def("is_given", &SolverSession::is_given)
+        .def("candidates", [](const SolverSession& session, unsigned int row, unsigned int col){
+            return mask_to_values(session.candidates(row, col));
+        }, "The values allowed by the units of an empty cell")
+        .def("has_conflict", &SolverSession::has_conflict)
+        .def("conflicts", &SolverSession::conflicts, "The value of the cell is also in one of its units")
+        .def("is_solved", &SolverSession::is_solved)
+        .def("is_solvable", [](SolverSession& session, double timeout) -> py::object {
+            Solvability solvability = session.is_solvable(timeout);
+            if (solvability == Solvability::UNKNOWN) return py::none();
+            return py::bool_(solvability == Solvability::SOLVABLE);
+        }, py::arg("timeout") = 0.1, "The board can still be completed, None if not known within timeout seconds (no limit if 0)")
+        .def("next_deduction", [](const SolverSession& session){
+            return hint_to_dict(session.next_deduction());
+        }, "The next single, as {'type', 'row', 'col', 'value'}, type 'none' if a guess is needed")
+        .def("board", [](const SolverSession& session){
+            Board b;
+            session.to_board(b);
+            return board_to_vector(b);
+        });
     m.def("build_config", &build_config, "Build config");
+    m.def("reservoir_start", &reservoir_start, "Start refilling pools of ready puzzles in the background");
+    m.def("reservoir_stop", &reservoir_stop, "Stop the background refilling, and save the pools if persisted");
+    m.def("reservoir_stats", &reservoir_stats, "Reservoir metrics");
+    m.def("cache_enable", &cache_enable, "Cache the solutions of solve, shared by equivalent puzzles");
+    m.def("cache_disable", &cache_disable, "Drop the solution cache");
+    m.def("cache_stats", &cache_stats, "Solution cache metrics");
 }
\ No newline at end of file
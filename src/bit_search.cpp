@@ -0,0 +1,217 @@
+#include "bit_search.h"
+#include "board.h"
+#include "config.h"
+#include "util.h"
+#include <algorithm>
+
+// the budget of the first attempt when filling a board,
+// a randomized search may get lost in a hopeless branch, so it restarts with a doubled budget
+#define FILL_INITIAL_NODE_BUDGET (8 * CELL_COUNT)
+// a power of 2, a node takes a few nanoseconds so the hook is asked every few microseconds
+#define STOP_CHECK_NODES 1024
+
+BitSearch::BitSearch()
+{
+    for (unsigned int i = 0; i < CELL_COUNT; i++){
+        unsigned int row = i / BOARD_SIZE;
+        unsigned int col = i % BOARD_SIZE;
+        m_grid_of[i] = (row / GRID_SIZE) * GRID_SIZE + col / GRID_SIZE;
+    }
+}
+
+mask_t BitSearch::candidates(unsigned int offset) const
+{
+    return FULL_MASK & ~(m_row[offset / BOARD_SIZE] | m_col[offset % BOARD_SIZE] | m_grid[m_grid_of[offset]]);
+}
+
+void BitSearch::place(unsigned int offset, val_t value)
+{
+    mask_t bit = mask_t(1) << (value - 1);
+    m_cells[offset] = value;
+    m_row[offset / BOARD_SIZE] |= bit;
+    m_col[offset % BOARD_SIZE] |= bit;
+    m_grid[m_grid_of[offset]] |= bit;
+}
+
+void BitSearch::unplace(unsigned int offset, val_t value)
+{
+    mask_t bit = ~(mask_t(1) << (value - 1));
+    m_cells[offset] = 0;
+    m_row[offset / BOARD_SIZE] &= bit;
+    m_col[offset % BOARD_SIZE] &= bit;
+    m_grid[m_grid_of[offset]] &= bit;
+}
+
+bool BitSearch::load(const Board& board)
+{
+    for (unsigned int i = 0; i < BOARD_SIZE; i++){
+        m_row[i] = 0;
+        m_col[i] = 0;
+        m_grid[i] = 0;
+    }
+    m_n_empty = 0;
+    m_valid = true;
+    for (unsigned int i = 0; i < CELL_COUNT; i++){
+        val_t value = board.get(i / BOARD_SIZE, i % BOARD_SIZE);
+        if (value == 0){
+            m_cells[i] = 0;
+            m_empty[m_n_empty++] = i;
+            continue;
+        }
+        if (value > CANDIDATE_SIZE){ m_valid = false; continue; }
+        mask_t bit = mask_t(1) << (value - 1);
+        if ((m_row[i / BOARD_SIZE] | m_col[i % BOARD_SIZE] | m_grid[m_grid_of[i]]) & bit){
+            m_valid = false;
+        }
+        place(i, value);
+    }
+    return m_valid;
+}
+
+/*
+Choose the next cell to branch on and push it to the stack:
+1. a value that fits in only one cell of a unit (hidden single) is forced;
+2. otherwise the empty cell with the fewest candidates.
+Returns false if some empty cell has no candidate, or some value has no place in a unit.
+*/
+bool BitSearch::select(unsigned int depth)
+{
+    unsigned int best_pos = 0;
+    unsigned int best_count = CANDIDATE_SIZE + 1;
+    mask_t best_mask = 0;
+
+    // candidates seen at least once / at least twice in each unit
+    mask_t row_once[BOARD_SIZE] = {0}, row_twice[BOARD_SIZE] = {0};
+    mask_t col_once[BOARD_SIZE] = {0}, col_twice[BOARD_SIZE] = {0};
+    mask_t grid_once[BOARD_SIZE] = {0}, grid_twice[BOARD_SIZE] = {0};
+
+    for (unsigned int i = 0; i < m_n_empty; i++){
+        unsigned int offset = m_empty[i];
+        mask_t mask = candidates(offset);
+        unsigned int count = util::popcount(mask);
+        if (count < best_count){
+            if (count == 0) return false;
+            best_count = count;
+            best_mask = mask;
+            best_pos = i;
+        }
+        unsigned int r = offset / BOARD_SIZE, c = offset % BOARD_SIZE, g = m_grid_of[offset];
+        row_twice[r] |= row_once[r] & mask; row_once[r] |= mask;
+        col_twice[c] |= col_once[c] & mask; col_once[c] |= mask;
+        grid_twice[g] |= grid_once[g] & mask; grid_once[g] |= mask;
+    }
+
+    if (best_count > 1){
+        // look for a hidden single, the unit masks tell which value it is
+        mask_t hidden = 0;
+        for (unsigned int u = 0; u < BOARD_SIZE && !hidden; u++){
+            if ((row_once[u] | m_row[u]) != FULL_MASK) return false;
+            if ((col_once[u] | m_col[u]) != FULL_MASK) return false;
+            if ((grid_once[u] | m_grid[u]) != FULL_MASK) return false;
+            hidden = (row_once[u] & ~row_twice[u]) | (col_once[u] & ~col_twice[u]) | (grid_once[u] & ~grid_twice[u]);
+        }
+        if (hidden){
+            mask_t bit = hidden & (~hidden + 1);
+            for (unsigned int i = 0; i < m_n_empty; i++){
+                mask_t mask = candidates(m_empty[i]);
+                if (!(mask & bit)) continue;
+                // the cell must hold the value if it is the only place in one of it's units
+                unsigned int offset = m_empty[i];
+                unsigned int r = offset / BOARD_SIZE, c = offset % BOARD_SIZE, g = m_grid_of[offset];
+                if ((row_once[r] & ~row_twice[r] & bit) || (col_once[c] & ~col_twice[c] & bit) || (grid_once[g] & ~grid_twice[g] & bit)){
+                    best_pos = i;
+                    best_mask = bit;
+                    break;
+                }
+            }
+        }
+    }
+
+    unsigned int offset = m_empty[best_pos];
+    m_empty[best_pos] = m_empty[m_n_empty - 1];
+    m_empty[m_n_empty - 1] = offset;
+    m_n_empty--;
+
+    m_stack[depth] = {offset, best_mask, 0};
+    return true;
+}
+
+unsigned long BitSearch::run(unsigned long limit, std::mt19937* rng, unsigned long max_nodes, const std::function<bool()>* should_stop)
+{
+    m_nodes = 0;
+    m_budget_exhausted = false;
+    if (!m_valid) return 0;
+    if (m_n_empty == 0){
+        std::copy(m_cells, m_cells + CELL_COUNT, m_solution);
+        return 1;
+    }
+
+    unsigned long found = 0;
+    unsigned int depth = 0;
+    if (!select(depth)) return 0;
+
+    while (true){
+        Frame& frame = m_stack[depth];
+        if (frame.value){
+            unplace(frame.offset, frame.value);
+            frame.value = 0;
+        }
+        if (frame.remaining == 0){
+            // all candidates are tried, give the cell back to the empty list
+            m_n_empty++;
+            if (depth == 0) return found;
+            depth--;
+            continue;
+        }
+
+        mask_t remaining = frame.remaining;
+        if (rng){
+            std::uniform_int_distribution<unsigned int> dist(0, util::popcount(remaining) - 1);
+            for (unsigned int k = dist(*rng); k > 0; k--){
+                remaining &= remaining - 1;
+            }
+        }
+        mask_t bit = remaining & (~remaining + 1);
+        frame.remaining &= ~bit;
+        frame.value = static_cast<val_t>(util::count_trailing_zeros(bit) + 1);
+        place(frame.offset, frame.value);
+
+        if (++m_nodes > max_nodes || (should_stop && (m_nodes & (STOP_CHECK_NODES - 1)) == 0 && (*should_stop)())){
+            m_budget_exhausted = true;
+            return found;
+        }
+
+        if (m_n_empty == 0){
+            if (found == 0){
+                std::copy(m_cells, m_cells + CELL_COUNT, m_solution);
+            }
+            found++;
+            if (found >= limit) return found;
+            continue;
+        }
+
+        // on a dead end, stay on the current frame and try the next candidate
+        if (select(depth + 1)) depth++;
+    }
+}
+
+bool BitSearch::fill_random(Board& board, std::mt19937& rng)
+{
+    unsigned long budget = FILL_INITIAL_NODE_BUDGET;
+    while (true){
+        if (!load(board)) return false;
+        if (run(1, &rng, budget) == 1){
+            std::copy(m_solution, m_solution + CELL_COUNT, board.data());
+            return true;
+        }
+        if (!m_budget_exhausted) return false;
+        budget *= 2;
+    }
+}
+
+unsigned long BitSearch::count(const Board& board, unsigned long limit, const std::function<bool()>& should_stop)
+{
+    m_budget_exhausted = false;
+    if (!load(board)) return 0;
+    return run(limit, nullptr, static_cast<unsigned long>(-1), should_stop ? &should_stop : nullptr);
+}
@@ -0,0 +1,68 @@
+/*
+A light-weight depth-first search over bitmask candidates.
+Each unit keeps a mask of the used values, the candidates of a cell are the values
+missing from all of it's units, and the search always branches on the most
+constrained cell (a cell with a single candidate is filled without a real branch).
+It is used where the full Solver is too heavy, e.g. filling empty boards or counting solutions.
+*/
+
+#pragma once
+#include "board.h"
+#include "config.h"
+#include <functional>
+#include <random>
+
+class BitSearch
+{
+public:
+    BitSearch();
+
+    // fill the empty cells of a board with a random solution, returns false if there is none.
+    // values are tried in random order so that every solution can be reached
+    bool fill_random(Board& board, std::mt19937& rng);
+
+    // count the solutions of a board, stops when limit is reached,
+    // or early when should_stop returns true, asked every 1024 nodes (see interrupted())
+    unsigned long count(const Board& board, unsigned long limit, const std::function<bool()>& should_stop = nullptr);
+
+    // whether the last search was stopped before it finished, by its node budget or should_stop
+    bool interrupted() const { return m_budget_exhausted; }
+
+    // number of nodes visited in the last search
+    unsigned long n_nodes() const { return m_nodes; }
+
+private:
+    struct Frame
+    {
+        unsigned int offset;
+        mask_t remaining;       // candidates not tried yet
+        val_t value;            // currently placed value, 0 if none
+    };
+
+    val_t m_cells[CELL_COUNT];
+    mask_t m_row[BOARD_SIZE];
+    mask_t m_col[BOARD_SIZE];
+    mask_t m_grid[BOARD_SIZE];
+    unsigned int m_grid_of[CELL_COUNT];
+
+    // empty cells are kept in the front [0, m_n_empty),
+    // a selected cell is swapped to the back and restored by increasing the counter
+    unsigned int m_empty[CELL_COUNT];
+    unsigned int m_n_empty;
+    Frame m_stack[CELL_COUNT];
+    bool m_valid;
+    bool m_budget_exhausted;
+    unsigned long m_nodes;
+
+    // load the givens of a board, returns false if the givens already conflict
+    bool load(const Board& board);
+    inline mask_t candidates(unsigned int offset) const;
+    inline void place(unsigned int offset, val_t value);
+    inline void unplace(unsigned int offset, val_t value);
+    bool select(unsigned int depth);
+
+    // run the search from the loaded state, stops after limit solutions or max_nodes nodes,
+    // or when should_stop returns true, the first solution is written to m_solution
+    unsigned long run(unsigned long limit, std::mt19937* rng, unsigned long max_nodes, const std::function<bool()>* should_stop = nullptr);
+    val_t m_solution[CELL_COUNT];
+};
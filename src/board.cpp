@@ -1,9 +1,9 @@
 #include "board.h"
 #include "config.h"
 #include "util.h"
+#include <algorithm>
 #include <sstream>
 #include <fstream>
-#include <memory>
 #include <vector>
 #include <cstring>
 
@@ -54,55 +54,60 @@ bool Board::is_filled() const
     return true;
 };
 
-bool Board::is_valid(bool check_filled)
+// the bit of a value in the unit masks, none for an empty cell or a value out of range
+static inline mask_t value_bit(val_t value)
 {
-    auto check_validity = [this, check_filled](
-        const unsigned int * offsets, unsigned int size
-    )->bool{
-        auto found = std::unique_ptr<bool[]>(new bool[size]{false});
-        for (unsigned int i = 0; i < BOARD_SIZE; i++){
-            const unsigned int offset = offsets[i];
-            val_t v = this->get(offset);
-            if (check_filled && v == 0){ // not filled
-                // std::cout << "not filled" << std::endl;
-                return false;
-            }
-            if (v > BOARD_SIZE){ // invalid value
-                // std::cout << "invalid value" << std::endl;
-                return false;
-            }
+    unsigned int v_idx = static_cast<unsigned int>(value) - 1u;
+    return v_idx < CANDIDATE_SIZE ? mask_t(1) << v_idx : mask_t(0);
+}
 
-            if (v==0) continue;
-            if (found[v - 1]){ // duplicate
-                // std::cout << "duplicate" << std::endl;
-                return false;
-            }
-            found[v - 1] = true;
-        }
-        return true;
-    };
+bool Board::is_valid(bool check_filled) const
+{
+    if (check_filled) return is_solved();
+    mask_t rows[BOARD_SIZE], cols[BOARD_SIZE], grids[BOARD_SIZE];
+    return unit_masks(rows, cols, grids);
+};
 
-    for (unsigned int i = 0; i < BOARD_SIZE; i++){
-        if (!check_validity(
-            indexer.row_index[i], BOARD_SIZE
-        )) return false;
-    }
-    for (unsigned int i = 0; i < BOARD_SIZE; i++){
-        if (!check_validity(
-            indexer.col_index[i], BOARD_SIZE
-        )) return false;
-    }
-    for (unsigned int i = 0; i < GRID_SIZE; i++){
-        for (unsigned int j = 0; j < GRID_SIZE; j++){
-            if (!check_validity(
-                indexer.grid_index[i][j], GRID_SIZE*GRID_SIZE
-            )) return false;
+bool Board::unit_masks(mask_t* rows, mask_t* cols, mask_t* grids) const
+{
+    std::fill(rows, rows + BOARD_SIZE, mask_t(0));
+    std::fill(cols, cols + BOARD_SIZE, mask_t(0));
+    std::fill(grids, grids + BOARD_SIZE, mask_t(0));
+    for (unsigned int row = 0; row < BOARD_SIZE; row++){
+        for (unsigned int col = 0; col < BOARD_SIZE; col++){
+            val_t value = m_board[row][col];
+            if (value == 0) continue;
+            mask_t bit = value_bit(value);
+            unsigned int grid = (row / GRID_SIZE) * GRID_SIZE + col / GRID_SIZE;
+            // out of range, or a duplicate in one of the units
+            if (bit == 0 || ((rows[row] | cols[col] | grids[grid]) & bit)) return false;
+            rows[row] |= bit;
+            cols[col] |= bit;
+            grids[grid] |= bit;
         }
     }
     return true;
 };
 
-bool Board::is_solved(){ return is_valid(true); };
+bool Board::is_solved() const
+{
+    // a unit of N cells holds all the N values only if none is empty, out of range or repeated,
+    // so the masks are OR-accumulated without a branch and compared at the end
+    mask_t rows[BOARD_SIZE] = {0}, cols[BOARD_SIZE] = {0}, grids[BOARD_SIZE] = {0};
+    for (unsigned int row = 0; row < BOARD_SIZE; row++){
+        for (unsigned int col = 0; col < BOARD_SIZE; col++){
+            mask_t bit = value_bit(m_board[row][col]);
+            rows[row] |= bit;
+            cols[col] |= bit;
+            grids[(row / GRID_SIZE) * GRID_SIZE + col / GRID_SIZE] |= bit;
+        }
+    }
+    mask_t all = FULL_MASK;
+    for (unsigned int unit = 0; unit < BOARD_SIZE; unit++){
+        all &= rows[unit] & cols[unit] & grids[unit];
+    }
+    return all == FULL_MASK;
+};
 
 void Board::load_from_file(const std::string& filename)
 {
@@ -122,7 +127,7 @@ void Board::save_to_file(const std::string& filename) const
     {
         throw std::runtime_error("Failed to open file: " + filename);
     }
-    file << to_string_raw();
+    file << *this;
     file.close();
 }
 
@@ -134,6 +139,9 @@ std::string Board::to_string() const
 val_t* Board::data(){
     return &m_board[0][0];
 }
+const val_t* Board::data() const{
+    return &m_board[0][0];
+}
 void Board::load_data(const std::vector<std::vector<val_t>> data){
     ASSERT(data.size() == BOARD_SIZE, "invalid data row size");
     for (unsigned int i = 0; i < BOARD_SIZE; i++){
@@ -153,37 +161,156 @@ void Board::load_data(const std::vector<val_t> data){
     }
 }
 
-void Board::load_data(const std::string& str_data){
-    std::vector<std::string> elements;
+std::string ParseError::message() const
+{
+    std::string position = " at line " + std::to_string(line) + ", column " + std::to_string(column);
+    switch (code){
+        case INVALID_CHARACTER: return "invalid character" + position;
+        case VALUE_OUT_OF_RANGE: return "value out of range" + position;
+        case TOO_FEW_CELLS:
+        case TOO_MANY_CELLS:
+            return "invalid data size, the board is supposed to be " + std::to_string(BOARD_SIZE) + "x" + std::to_string(BOARD_SIZE) + 
+                (code == TOO_FEW_CELLS ? ", got " + std::to_string(n_cells) + " cells" : ", too many cells" + position);
+        default: return "";
+    }
+}
+
+namespace {
+    /*
+    Consumes the grid text chunk by chunk, so that a stream can be parsed without holding it.
+    A token is a decimal number, '.' or a letter; whitespace separates the numbers.
+    */
+    class GridTokenizer
+    {
+    public:
+        GridTokenizer(val_t* cells): m_cells(cells) {}
+
+        // returns false once an error is found
+        bool feed(const char* text, size_t size)
+        {
+            for (size_t i = 0; i < size; i++){
+                char c = text[i];
+                m_column++;
+                if (c == ' ' || c == '\t' || c == '\r' || c == '\n'){
+                    if (m_in_number && !end_number()) return false;
+                    if (c == '\n'){ m_line++; m_column = 0; }
+                    continue;
+                }
+
+                if (c >= '0' && c <= '9'){
+                    if (CANDIDATE_SIZE < 10){
+                        if (!emit(c - '0', m_line, m_column)) return false;
+                        continue;
+                    }
+                    if (!m_in_number){
+                        m_in_number = true;
+                        m_value = 0;
+                        m_token_line = m_line;
+                        m_token_column = m_column;
+                    }
+                    m_value = m_value * 10 + (c - '0');
+                    // stop early, before the value can overflow
+                    if (m_value > CANDIDATE_SIZE) return fail(ParseError::VALUE_OUT_OF_RANGE, m_token_line, m_token_column);
+                    continue;
+                }
+
+                if (m_in_number && !end_number()) return false;
+                if (c == '.'){
+                    if (!emit(0, m_line, m_column)) return false;
+                }
+                else if (c >= 'a' && c <= 'z'){
+                    if (!emit(c - 'a' + 10, m_line, m_column)) return false;
+                }
+                else if (c >= 'A' && c <= 'Z'){
+                    if (!emit(c - 'A' + 10, m_line, m_column)) return false;
+                }
+                else{
+                    return fail(ParseError::INVALID_CHARACTER, m_line, m_column);
+                }
+            }
+            return true;
+        }
 
-    auto split_lines = util::split_string(str_data, "\n");
-    for (auto line: split_lines){
-        auto line_sp = util::split_string(line, " ");
-        for (auto s: line_sp){
-            if (s != ""){ elements.push_back(s); }
+        ParseError finish()
+        {
+            if (!m_error && m_in_number) end_number();
+            if (!m_error && m_n_cells < CELL_COUNT) fail(ParseError::TOO_FEW_CELLS, m_line, m_column);
+            m_error.n_cells = m_n_cells;
+            return m_error;
         }
-    }
 
-    if (elements.size() != BOARD_SIZE * BOARD_SIZE){
-        throw std::runtime_error("invalid data size, the board is supposed to be " + std::to_string(BOARD_SIZE) + "x" + std::to_string(BOARD_SIZE));
-    }
+    private:
+        val_t* m_cells;
+        unsigned int m_n_cells = 0;
+        unsigned int m_value = 0;
+        bool m_in_number = false;
+        unsigned int m_line = 1, m_column = 0;
+        unsigned int m_token_line = 0, m_token_column = 0;
+        ParseError m_error;
 
-    for (unsigned int i = 0; i < BOARD_SIZE; i++){
-        for (unsigned int j = 0; j < BOARD_SIZE; j++){
-            m_board[i][j] = static_cast<val_t>(std::stoi(elements[i * BOARD_SIZE + j]));
+        bool fail(ParseError::Code code, unsigned int line, unsigned int column)
+        {
+            m_error.code = code;
+            m_error.line = line;
+            m_error.column = column;
+            return false;
+        }
+
+        bool end_number()
+        {
+            m_in_number = false;
+            return emit(m_value, m_token_line, m_token_column);
+        }
+
+        bool emit(unsigned int value, unsigned int line, unsigned int column)
+        {
+            if (value > CANDIDATE_SIZE) return fail(ParseError::VALUE_OUT_OF_RANGE, line, column);
+            if (m_n_cells >= CELL_COUNT) return fail(ParseError::TOO_MANY_CELLS, line, column);
+            m_cells[m_n_cells++] = static_cast<val_t>(value);
+            return true;
         }
+    };
+}
+
+ParseError Board::parse(const char* text, size_t size)
+{
+    val_t cells[CELL_COUNT];
+    GridTokenizer tokenizer(cells);
+    tokenizer.feed(text, size);
+    ParseError error = tokenizer.finish();
+    if (!error) std::memcpy(m_board, cells, sizeof(m_board));
+    return error;
+}
+
+ParseError Board::parse(std::istream& is)
+{
+    val_t cells[CELL_COUNT];
+    GridTokenizer tokenizer(cells);
+    char buffer[4096];
+    while (true){
+        is.read(buffer, sizeof(buffer));
+        std::streamsize n = is.gcount();
+        if (n > 0 && !tokenizer.feed(buffer, n)) break;
+        if (n < static_cast<std::streamsize>(sizeof(buffer))) break;
     }
+    ParseError error = tokenizer.finish();
+    if (!error) std::memcpy(m_board, cells, sizeof(m_board));
+    return error;
+}
 
+void Board::load_data(const std::string& str_data){
+    ParseError error = parse(str_data.data(), str_data.size());
+    if (error){
+        throw std::runtime_error(error.message());
+    }
 }
 
 void Board::load_data(std::istream& is)
 {
-    std::string content;
-    for (std::string line; std::getline(is, line);)
-    {
-        content += line + "\n";
+    ParseError error = parse(is);
+    if (error){
+        throw std::runtime_error(error.message());
     }
-    load_data(content);
 }
 
 void Board::load_data(const Board& board)
@@ -197,22 +324,105 @@ void Board::load_data(const Board& board)
     }
 }
 
-std::string Board::to_string_raw() const
-{
-    std::string result;
-    for (unsigned int i = 0; i < BOARD_SIZE; i++)
+namespace {
+    // precomputed text of each value, so that serializing is a copy per cell
+    struct DigitTable
     {
-        for (unsigned int j = 0; j < BOARD_SIZE; j++)
+        char decimal[CANDIDATE_SIZE + 1][2];
+        unsigned char length[CANDIDATE_SIZE + 1];
+        char compact[CANDIDATE_SIZE + 1];
+
+        constexpr DigitTable(): decimal(), length(), compact()
         {
-            result += std::to_string(m_board[i][j]);
-            if (j < BOARD_SIZE - 1)
-            {
-                result += " ";
+            for (unsigned int v = 0; v <= CANDIDATE_SIZE; v++){
+                if (v < 10){
+                    decimal[v][0] = static_cast<char>('0' + v);
+                    length[v] = 1;
+                }
+                else{
+                    decimal[v][0] = static_cast<char>('0' + v / 10);
+                    decimal[v][1] = static_cast<char>('0' + v % 10);
+                    length[v] = 2;
+                }
+                compact[v] = (v == 0) ? '.' : (v < 10) ? static_cast<char>('0' + v) : static_cast<char>('A' + v - 10);
             }
         }
-        result += "\n";
+    };
+    constexpr DigitTable DIGITS;
+
+    char* write_pretty_border(char* out, size_t width)
+    {
+        for (unsigned int g = 0; g < GRID_SIZE; g++){
+            *out++ = '+';
+            std::memset(out, '-', 1 + GRID_SIZE * (width + 1));
+            out += 1 + GRID_SIZE * (width + 1);
+        }
+        *out++ = '+';
+        *out++ = '\n';
+        return out;
+    }
+}
+
+size_t Board::serialize(char* buffer, BoardFormat format) const
+{
+    const val_t* cells = data();
+    char* out = buffer;
+    switch (format){
+        case BoardFormat::COMPACT:
+            for (unsigned int i = 0; i < CELL_COUNT; i++){
+                *out++ = DIGITS.compact[cells[i]];
+            }
+            *out++ = '\n';
+            break;
+
+        case BoardFormat::PRETTY: {
+            constexpr size_t width = (CANDIDATE_SIZE >= 10) ? 2 : 1;
+            for (unsigned int i = 0; i < BOARD_SIZE; i++){
+                if (i % GRID_SIZE == 0) out = write_pretty_border(out, width);
+                for (unsigned int j = 0; j < BOARD_SIZE; j++){
+                    if (j % GRID_SIZE == 0){ *out++ = '|'; *out++ = ' '; }
+                    val_t v = cells[i * BOARD_SIZE + j];
+                    if (v == 0){
+                        if (width == 2) *out++ = ' ';
+                        *out++ = '.';
+                    }
+                    else{
+                        if (DIGITS.length[v] < width) *out++ = ' ';
+                        std::memcpy(out, DIGITS.decimal[v], DIGITS.length[v]);
+                        out += DIGITS.length[v];
+                    }
+                    *out++ = ' ';
+                }
+                *out++ = '|';
+                *out++ = '\n';
+            }
+            out = write_pretty_border(out, width);
+            break;
+        }
+
+        default:
+            for (unsigned int i = 0; i < BOARD_SIZE; i++){
+                for (unsigned int j = 0; j < BOARD_SIZE; j++){
+                    val_t v = cells[i * BOARD_SIZE + j];
+                    std::memcpy(out, DIGITS.decimal[v], DIGITS.length[v]);
+                    out += DIGITS.length[v];
+                    *out++ = (j < BOARD_SIZE - 1) ? ' ' : '\n';
+                }
+            }
+            break;
     }
-    return result;
+    return out - buffer;
+}
+
+std::string Board::to_string(BoardFormat format) const
+{
+    char buffer[max_serialized_size(BoardFormat::PRETTY)];
+    return std::string(buffer, serialize(buffer, format));
+}
+
+std::string Board::to_string_raw() const
+{
+    return to_string(BoardFormat::SPACED);
 }
 
 void BoardEquivalenceTransform::swap_row(Board& board, unsigned int row1, unsigned int row2)
@@ -373,6 +583,7 @@ bool Board::operator==(const Board& other) const
 }
 std::ostream& operator<<(std::ostream& os, const Board& board)
 {
-    os << board.to_string_raw();
+    char buffer[Board::max_serialized_size(BoardFormat::SPACED)];
+    os.write(buffer, board.serialize(buffer));
     return os;
 }
\ No newline at end of file
@@ -20,6 +20,26 @@ providing methods to read / dump the board state.
     ASSERT(static_cast<unsigned int>(value) <= CANDIDATE_SIZE, "value out of bounds: " + std::to_string(value)); // value is 1-based, but we allow 0 to indicate empty
 
 
+// the outcome of parsing a grid text, see Board::parse
+struct ParseError
+{
+    enum Code { NONE, INVALID_CHARACTER, VALUE_OUT_OF_RANGE, TOO_FEW_CELLS, TOO_MANY_CELLS };
+    Code code = NONE;
+    unsigned int line = 0;          // 1-based position of the offending token
+    unsigned int column = 0;
+    unsigned int n_cells = 0;       // number of cells read before the error
+    explicit operator bool() const { return code != NONE; }
+    std::string message() const;
+};
+
+// text formats written by Board::serialize
+enum class BoardFormat
+{
+    SPACED,     // the values separated by spaces, one row per line, as read by load_data
+    COMPACT,    // one line, '.' for an empty cell and letters from 10, as in the datasets
+    PRETTY      // the spaced grid with '.' for empty cells, boxed along the grids
+};
+
 struct Coord
 {
     int row;
@@ -47,22 +67,46 @@ public:
     void set(int row, int col, val_t value);
     void set(const Coord& coord, val_t value);
 
-    // check if the board is valid, 
-    // the board should be all filled with valid values
-    bool is_valid(bool check_filled = false);
-    bool is_solved();           // equal to is_valid(true)
+    // check if the board is valid: the values in range and none twice in a unit,
+    // and all the cells filled if check_filled is set
+    bool is_valid(bool check_filled = false) const;
+    bool is_solved() const;     // equal to is_valid(true)
+    // the check of is_valid, also giving the values in each row, column and grid as bitmasks (BOARD_SIZE each)
+    bool unit_masks(mask_t* rows, mask_t* cols, mask_t* grids) const;
     bool is_filled() const;     // check if the board is filled, i.e. no empty cells
 
     // val_t(*data())[BOARD_SIZE];
     val_t* data();                      // return a pointer to the raw data
+    const val_t* data() const;
     void load_data(const std::vector<std::vector<val_t>> data);
     void load_data(const std::vector<val_t> data);
     void load_data(std::istream& is);
     void load_data(const Board& board);
-    void load_data(const std::string& str_data);
+    void load_data(const std::string& str_data);        // throws std::runtime_error with the parse error
+    // parse the whitespace separated grid text in a single pass without allocation:
+    // '.' or '0' is an empty cell, a-z / A-Z are the values from 10,
+    // below 10x10 values each character is a cell, so compact rows are accepted too.
+    // the board is left unchanged on error
+    ParseError parse(const char* text, size_t size);
+    ParseError parse(std::istream& is);
     void load_from_file(const std::string& filename);
     void save_to_file(const std::string& filename) const;
     std::string to_string() const;
+    std::string to_string(BoardFormat format) const;
+
+    // write the board into the buffer without allocation, returns the number of characters written,
+    // the buffer should hold at least max_serialized_size(format) characters, no null terminator is added
+    size_t serialize(char* buffer, BoardFormat format = BoardFormat::SPACED) const;
+    static constexpr size_t max_serialized_size(BoardFormat format)
+    {
+        constexpr size_t width = (CANDIDATE_SIZE >= 10) ? 2 : 1;
+        constexpr size_t pretty_line = GRID_SIZE * (2 + GRID_SIZE * (width + 1)) + 2;
+        switch (format){
+            case BoardFormat::COMPACT: return CELL_COUNT + 1;
+            case BoardFormat::PRETTY: return pretty_line * (BOARD_SIZE + GRID_SIZE + 1);
+            default: return CELL_COUNT * (width + 1);
+        }
+    }
 
     val_t operator[](Coord coord);
     bool operator==(const Board& other) const;
@@ -141,6 +185,8 @@ public:
     inline bool_* get(int idx);
 
     void load(const CandidateBoard& board);
+    // the one-hot candidates, [row][col][value - 1]
+    const bool_* data() const { return &m_candidates[0][0][0]; }
 
     void reset();
     unsigned int count(int row, int col) const;
@@ -57,5 +57,55 @@ int main()
     board.save_to_file("./output/2.txt");
     std::cout << board << std::endl;
 
+    // the parser accepts '.' for blanks and compact rows, and reports where it fails
+    Board parsed;
+    std::string dotted = valid_board_str;
+    dotted[0] = '.';
+    dotted.erase(1, 1);     // "8 9" -> ". 9" -> ".9", a compact pair
+    ParseError error = parsed.parse(dotted.data(), dotted.size());
+    std::cout << "Parse blanks: " << (!error && parsed.get(0, 0) == 0 && parsed.get(0, 1) == 9 ? "PASS" : "FAIL") << std::endl;
+
+    std::string invalid = valid_board_str;
+    invalid[20] = '#';
+    error = parsed.parse(invalid.data(), invalid.size());
+    std::cout << "Parse invalid character: " << (error.code == ParseError::INVALID_CHARACTER && error.line == 2 && error.column == 3 ? "PASS" : "FAIL") << std::endl;
+    std::cout << "Board unchanged on error: " << (parsed.get(0, 0) == 0 ? "PASS" : "FAIL") << std::endl;
+
+    error = parsed.parse(valid_board_str.data(), valid_board_str.size() - 4);
+    std::cout << "Parse too few cells: " << (error.code == ParseError::TOO_FEW_CELLS && error.n_cells == CELL_COUNT - 2 ? "PASS" : "FAIL") << std::endl;
+
+    std::string extra = valid_board_str + "1\n";
+    error = parsed.parse(extra.data(), extra.size());
+    std::cout << "Parse too many cells: " << (error.code == ParseError::TOO_MANY_CELLS && error.line == BOARD_SIZE + 1 ? "PASS" : "FAIL") << std::endl;
+
+    // serializer formats, the spaced and compact ones load back to the same board
+    Board solved;
+    solved.load_data(valid_board_str);
+    std::cout << "Serialize spaced: " << (solved.to_string() == valid_board_str ? "PASS" : "FAIL") << std::endl;
+    solved.set(0, 0, 0);
+    char buffer[Board::max_serialized_size(BoardFormat::PRETTY)];
+    size_t n = solved.serialize(buffer, BoardFormat::COMPACT);
+    std::cout << "Serialize compact: " << (n == CELL_COUNT + 1 && buffer[0] == '.' && !parsed.parse(buffer, n) && parsed == solved ? "PASS" : "FAIL") << std::endl;
+    n = solved.serialize(buffer, BoardFormat::PRETTY);
+    std::cout << "Serialize pretty: " << (n == Board::max_serialized_size(BoardFormat::PRETTY) ? "PASS" : "FAIL") << std::endl;
+    std::cout << std::string(buffer, n);
+
+    // validity with the unit masks: an empty cell, a value out of range, a duplicate in a row, a column or a grid only
+    Board checked;
+    checked.load_data(valid_board_str);
+    bool valid = checked.is_valid() && checked.is_solved() && checked.is_valid(true);
+    checked.set(4, 4, 0);
+    valid = valid && checked.is_valid() && !checked.is_solved();
+    checked.get_(4, 4) = BOARD_SIZE + 1;       // set() refuses it
+    valid = valid && !checked.is_valid() && !checked.is_solved();
+    checked.load_data(valid_board_str);
+    std::swap(checked.get_(0, 0), checked.get_(0, BOARD_SIZE - 1));     // the rows stay full, the columns do not
+    valid = valid && !checked.is_valid() && !checked.is_solved();
+    for (unsigned int r = 0; r < BOARD_SIZE; r++){
+        for (unsigned int c = 0; c < BOARD_SIZE; c++) checked.set(r, c, (r + c) % BOARD_SIZE + 1);
+    }
+    valid = valid && !checked.is_valid() && !checked.is_solved();   // a latin square, the grids repeat values
+    std::cout << "Validity: " << (valid ? "PASS" : "FAIL") << std::endl;
+
     return 0;
 };
@@ -0,0 +1,623 @@
+#include "canonical.h"
+#include "config.h"
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+namespace canonical
+{
+    void Transform::apply(const Board& in, Board& out) const
+    {
+        ASSERT(&in != &out, "the transform can not be applied in place");
+        const val_t* src = in.data();
+        val_t* dst = out.data();
+        for (unsigned int i = 0; i < BOARD_SIZE; i++){
+            for (unsigned int j = 0; j < BOARD_SIZE; j++){
+                unsigned int r = row[i], c = col[j];
+                val_t v = transpose ? src[c * BOARD_SIZE + r] : src[r * BOARD_SIZE + c];
+                dst[i * BOARD_SIZE + j] = value[v];
+            }
+        }
+    }
+
+    Transform Transform::inverse() const
+    {
+        Transform inv;
+        uint8_t row_inv[BOARD_SIZE], col_inv[BOARD_SIZE];
+        for (unsigned int i = 0; i < BOARD_SIZE; i++){
+            row_inv[row[i]] = i;
+            col_inv[col[i]] = i;
+        }
+        // a transposed board is permuted after the transposition, so the inverse swaps the roles
+        inv.transpose = transpose;
+        for (unsigned int i = 0; i < BOARD_SIZE; i++){
+            inv.row[i] = transpose ? col_inv[i] : row_inv[i];
+            inv.col[i] = transpose ? row_inv[i] : col_inv[i];
+        }
+        for (unsigned int v = 0; v <= CANDIDATE_SIZE; v++){
+            inv.value[value[v]] = v;
+        }
+        return inv;
+    }
+
+    Transform Transform::identity()
+    {
+        Transform t;
+        t.transpose = false;
+        for (unsigned int i = 0; i < BOARD_SIZE; i++){
+            t.row[i] = i;
+            t.col[i] = i;
+        }
+        for (unsigned int v = 0; v <= CANDIDATE_SIZE; v++){
+            t.value[v] = v;
+        }
+        return t;
+    }
+
+    Transform Transform::random(std::mt19937& rng)
+    {
+        Transform t = identity();
+        t.transpose = rng() & 1;
+        // permute the bands / stacks, then the lines within each of them
+        for (uint8_t* lines: {t.row, t.col}){
+            uint8_t order[GRID_SIZE];
+            for (unsigned int i = 0; i < GRID_SIZE; i++) order[i] = i;
+            std::shuffle(order, order + GRID_SIZE, rng);
+            for (unsigned int b = 0; b < GRID_SIZE; b++){
+                uint8_t inner[GRID_SIZE];
+                for (unsigned int i = 0; i < GRID_SIZE; i++) inner[i] = i;
+                std::shuffle(inner, inner + GRID_SIZE, rng);
+                for (unsigned int i = 0; i < GRID_SIZE; i++){
+                    lines[b * GRID_SIZE + i] = order[b] * GRID_SIZE + inner[i];
+                }
+            }
+        }
+        std::shuffle(t.value + 1, t.value + CANDIDATE_SIZE + 1, rng);
+        return t;
+    }
+
+    namespace
+    {
+        // the key of a value that has no label yet, larger than all the labels
+        const val_t UNLABELED = CANDIDATE_SIZE + 1;
+        // the orders of the new values of a row are all tried up to this many,
+        // beyond they are ordered by a signature of their columns (see split_runs)
+        const size_t MAX_EXACT_ORDERS = 4096;
+        // a hard bound of the states kept from one row to the next
+        const size_t MAX_STATES = size_t(1) << 16;
+
+        // a partial canonical form: the rows chosen so far, and the order of the columns,
+        // where the tied columns / stacks are still interchangeable (empty in all the chosen rows)
+        struct State
+        {
+            bool transpose;
+            unsigned int n_rows;
+            uint64_t used_rows;
+            uint8_t rows[BOARD_SIZE];
+            uint8_t cols[BOARD_SIZE];
+            bool col_tied[BOARD_SIZE];      // tied with the previous position, within a stack
+            bool stack_tied[GRID_SIZE];     // tied with the previous stack position
+            val_t labels[CANDIDATE_SIZE + 1];
+            val_t next_label;
+        };
+
+        // the minimal arrangement of one row under a state
+        struct Arrangement
+        {
+            uint8_t cols[BOARD_SIZE];
+            val_t keys[BOARD_SIZE];         // by position
+            bool col_tied[BOARD_SIZE];
+            bool stack_tied[GRID_SIZE];
+            // runs of positions whose order is free for this row, but matters for the labels
+            struct Run { unsigned int start; unsigned int length; bool stacks; };
+            std::vector<Run> runs;
+        };
+
+        bool block_less(const val_t* a, const val_t* b)
+        {
+            return std::lexicographical_compare(a, a + GRID_SIZE, b, b + GRID_SIZE);
+        }
+
+        bool block_zero(const val_t* a)
+        {
+            for (unsigned int i = 0; i < GRID_SIZE; i++){
+                if (a[i]) return false;
+            }
+            return true;
+        }
+
+        void arrange(const State& s, const val_t* row_values, Arrangement& a, bool with_runs)
+        {
+            std::memcpy(a.cols, s.cols, sizeof(a.cols));
+            for (unsigned int p = 0; p < BOARD_SIZE; p++){
+                val_t v = row_values[a.cols[p]];
+                a.keys[p] = (v == 0) ? 0 : (s.labels[v] ? s.labels[v] : UNLABELED);
+            }
+
+            // sort each group of tied columns by key, insertion sort as the groups are tiny
+            for (unsigned int p = 1; p < BOARD_SIZE; p++){
+                for (unsigned int q = p; q > 0 && s.col_tied[q] && a.keys[q] < a.keys[q - 1]; q--){
+                    std::swap(a.keys[q], a.keys[q - 1]);
+                    std::swap(a.cols[q], a.cols[q - 1]);
+                }
+            }
+            // sort each group of tied stacks by their blocks of keys
+            for (unsigned int sp = 1; sp < GRID_SIZE; sp++){
+                for (unsigned int q = sp; q > 0 && s.stack_tied[q] && block_less(a.keys + q * GRID_SIZE, a.keys + (q - 1) * GRID_SIZE); q--){
+                    std::swap_ranges(a.keys + q * GRID_SIZE, a.keys + (q + 1) * GRID_SIZE, a.keys + (q - 1) * GRID_SIZE);
+                    std::swap_ranges(a.cols + q * GRID_SIZE, a.cols + (q + 1) * GRID_SIZE, a.cols + (q - 1) * GRID_SIZE);
+                }
+            }
+
+            // the columns / stacks stay tied only if they are empty in this row too
+            a.col_tied[0] = false;
+            for (unsigned int p = 1; p < BOARD_SIZE; p++){
+                a.col_tied[p] = s.col_tied[p] && a.keys[p] == 0 && a.keys[p - 1] == 0;
+            }
+            a.stack_tied[0] = false;
+            for (unsigned int sp = 1; sp < GRID_SIZE; sp++){
+                a.stack_tied[sp] = s.stack_tied[sp] && block_zero(a.keys + sp * GRID_SIZE) && block_zero(a.keys + (sp - 1) * GRID_SIZE);
+            }
+            if (!with_runs) return;
+
+            // distinct new values in tied columns, or tied stacks with the same keys, can be in any order
+            a.runs.clear();
+            for (unsigned int p = 0; p < BOARD_SIZE;){
+                unsigned int end = p + 1;
+                while (end < BOARD_SIZE && s.col_tied[end]) end++;
+                unsigned int start = p;
+                while (start < end && a.keys[start] != UNLABELED) start++;
+                if (end - start > 1) a.runs.push_back({start, end - start, false});
+                p = end;
+            }
+            for (unsigned int sp = 0; sp < GRID_SIZE;){
+                unsigned int end = sp + 1;
+                while (end < GRID_SIZE && s.stack_tied[end] &&
+                       std::equal(a.keys + end * GRID_SIZE, a.keys + (end + 1) * GRID_SIZE, a.keys + sp * GRID_SIZE)){
+                    end++;
+                }
+                if (end - sp > 1 && !block_zero(a.keys + sp * GRID_SIZE)) a.runs.push_back({sp, end - sp, true});
+                sp = end;
+            }
+        }
+
+        // the number of the orders of the runs, saturated at limit + 1
+        size_t count_orders(const Arrangement& a, size_t limit)
+        {
+            size_t n = 1;
+            for (auto& run: a.runs){
+                for (unsigned int i = 2; i <= run.length; i++){
+                    n *= i;
+                    if (n > limit) return limit + 1;
+                }
+            }
+            return n;
+        }
+
+        // the rank of each item in the sorted set of the items, equal items have equal ranks
+        template <typename T>
+        void rank(const std::vector<T>& items, unsigned int* ranks)
+        {
+            std::vector<T> sorted(items);
+            std::sort(sorted.begin(), sorted.end());
+            sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+            for (size_t i = 0; i < items.size(); i++){
+                ranks[i] = std::lower_bound(sorted.begin(), sorted.end(), items[i]) - sorted.begin();
+            }
+        }
+
+        /*
+        Order the columns of the runs by a signature, and keep as runs only the columns with equal signatures,
+        when the row has too many orders to try them all. The signatures of the columns and of the rows not chosen
+        yet are refined together, from the places of the columns (the first of the positions a column can be
+        swapped with) and the bands of the rows: a column by the signatures of the rows and its cells in them,
+        a row by the signatures of the columns and its cells in them, each with the signatures of the other
+        columns of its stack / rows of its band. A cell is seen as empty, the label of a labeled value,
+        or the signature of the column holding the value in the chosen row and whether it is in the same stack.
+        Like the keys, the signatures do not depend on the order of the tied rows, columns and values,
+        so the orders kept are the same for equivalent boards.
+        */
+        void split_runs(const State& s, unsigned int row, const val_t* values, Arrangement& a)
+        {
+            const val_t* row_values = values + row * BOARD_SIZE;
+            // the place of a column: its position, or the first of the positions it can be swapped with
+            unsigned int place[BOARD_SIZE];
+            for (unsigned int p = 0; p < BOARD_SIZE; p++) place[p] = p;
+            bool stack_free[GRID_SIZE];
+            std::memcpy(stack_free, a.stack_tied, sizeof(stack_free));
+            for (auto& run: a.runs){
+                if (run.stacks) std::fill(stack_free + run.start + 1, stack_free + run.start + run.length, true);
+            }
+            for (unsigned int sp = 1; sp < GRID_SIZE; sp++){
+                if (!stack_free[sp]) continue;
+                for (unsigned int i = 0; i < GRID_SIZE; i++) place[sp * GRID_SIZE + i] = place[(sp - 1) * GRID_SIZE + i];
+            }
+            bool col_free[BOARD_SIZE];
+            std::memcpy(col_free, a.col_tied, sizeof(col_free));
+            for (auto& run: a.runs){
+                if (!run.stacks) std::fill(col_free + run.start + 1, col_free + run.start + run.length, true);
+            }
+            for (unsigned int p = 1; p < BOARD_SIZE; p++){
+                if (col_free[p]) place[p] = place[p - 1];
+            }
+
+            // the signatures of the columns and of the rows left, refined together until they split no further
+            int col_of_value[CANDIDATE_SIZE + 1];
+            std::fill(col_of_value, col_of_value + CANDIDATE_SIZE + 1, -1);
+            unsigned int color[BOARD_SIZE], row_color[BOARD_SIZE];
+            for (unsigned int p = 0; p < BOARD_SIZE; p++){
+                color[a.cols[p]] = place[p];
+                if (row_values[a.cols[p]]) col_of_value[row_values[a.cols[p]]] = a.cols[p];
+            }
+            std::vector<unsigned int> left;
+            for (unsigned int r = 0; r < BOARD_SIZE; r++){
+                if (r == row || (s.used_rows & (uint64_t(1) << r))) continue;
+                left.push_back(r);
+                row_color[r] = r / GRID_SIZE == row / GRID_SIZE;
+            }
+            // empty, a label, the column of the value in the row and whether it is in the same stack, or a value not in the row
+            auto cell = [&](unsigned int r, unsigned int c)->uint64_t{
+                val_t v = values[r * BOARD_SIZE + c];
+                if (v == 0) return 0;
+                if (s.labels[v]) return (1u << 16) | s.labels[v];
+                if (col_of_value[v] < 0) return 3u << 16;
+                unsigned int other = col_of_value[v];
+                return (2u << 16) | (color[other] << 1) | (other / GRID_SIZE == c / GRID_SIZE);
+            };
+            std::vector<std::vector<uint64_t>> col_signatures(BOARD_SIZE), row_signatures(left.size());
+            unsigned int n_colors = 0;
+            while (true){
+                for (unsigned int c = 0; c < BOARD_SIZE; c++){
+                    auto& sig = col_signatures[c];
+                    sig.assign(1, color[c]);
+                    for (unsigned int r: left) sig.push_back((uint64_t(row_color[r]) << 32) | cell(r, c));
+                    std::sort(sig.begin() + 1, sig.end());
+                    size_t mates = sig.size();
+                    for (unsigned int d = (c / GRID_SIZE) * GRID_SIZE; d < (c / GRID_SIZE + 1) * GRID_SIZE; d++) sig.push_back(color[d]);
+                    std::sort(sig.begin() + mates, sig.end());
+                }
+                for (size_t i = 0; i < left.size(); i++){
+                    unsigned int r = left[i];
+                    auto& sig = row_signatures[i];
+                    sig.assign(1, row_color[r]);
+                    for (unsigned int c = 0; c < BOARD_SIZE; c++) sig.push_back((uint64_t(color[c]) << 32) | cell(r, c));
+                    std::sort(sig.begin() + 1, sig.end());
+                    size_t mates = sig.size();
+                    for (unsigned int other: left){
+                        if (other / GRID_SIZE == r / GRID_SIZE) sig.push_back(row_color[other]);
+                    }
+                    std::sort(sig.begin() + mates, sig.end());
+                }
+                unsigned int refined[BOARD_SIZE], refined_rows[BOARD_SIZE];
+                rank(col_signatures, refined);
+                rank(row_signatures, refined_rows);
+                std::copy(refined, refined + BOARD_SIZE, color);
+                for (size_t i = 0; i < left.size(); i++) row_color[left[i]] = refined_rows[i];
+                unsigned int n_refined = *std::max_element(refined, refined + BOARD_SIZE) + 1;
+                if (!left.empty()) n_refined += *std::max_element(refined_rows, refined_rows + left.size()) + 1;
+                if (n_refined == n_colors) break;
+                n_colors = n_refined;
+            }
+
+            // the columns of each run in the order of their signatures, then the stacks of each stack run
+            auto by_color = [&color](uint8_t x, uint8_t y){ return color[x] < color[y]; };
+            for (auto& run: a.runs){
+                if (!run.stacks) std::stable_sort(a.cols + run.start, a.cols + run.start + run.length, by_color);
+            }
+            std::vector<std::vector<unsigned int>> stack_colors(GRID_SIZE);
+            for (unsigned int sp = 0; sp < GRID_SIZE; sp++){
+                for (unsigned int i = 0; i < GRID_SIZE; i++) stack_colors[sp].push_back(color[a.cols[sp * GRID_SIZE + i]]);
+                std::sort(stack_colors[sp].begin(), stack_colors[sp].end());
+            }
+            for (auto& run: a.runs){
+                if (!run.stacks) continue;
+                unsigned int order[GRID_SIZE];
+                for (unsigned int i = 0; i < run.length; i++) order[i] = run.start + i;
+                std::stable_sort(order, order + run.length, [&](unsigned int x, unsigned int y){ return stack_colors[x] < stack_colors[y]; });
+                uint8_t moved[BOARD_SIZE];
+                std::memcpy(moved, a.cols, sizeof(moved));
+                std::vector<std::vector<unsigned int>> moved_colors(stack_colors);
+                for (unsigned int i = 0; i < run.length; i++){
+                    std::memcpy(a.cols + (run.start + i) * GRID_SIZE, moved + order[i] * GRID_SIZE, GRID_SIZE);
+                    stack_colors[run.start + i] = moved_colors[order[i]];
+                }
+            }
+
+            // the runs of equal signatures
+            std::vector<Arrangement::Run> runs;
+            for (auto& run: a.runs){
+                for (unsigned int i = 0; i < run.length;){
+                    unsigned int end = i + 1;
+                    while (end < run.length && (run.stacks ? stack_colors[run.start + end] == stack_colors[run.start + i] :
+                                                             color[a.cols[run.start + end]] == color[a.cols[run.start + i]])){
+                        end++;
+                    }
+                    if (end - i > 1) runs.push_back({run.start + i, end - i, run.stacks});
+                    i = end;
+                }
+            }
+            a.runs.swap(runs);
+        }
+
+        // the row as it appears in the canonical form, the new values labeled in order
+        void row_string(const State& s, const Arrangement& a, val_t* out)
+        {
+            val_t next_label = s.next_label;
+            for (unsigned int p = 0; p < BOARD_SIZE; p++){
+                out[p] = (a.keys[p] == UNLABELED) ? next_label++ : a.keys[p];
+            }
+        }
+
+        // all the states from choosing the row, one per order of the runs, until there are max_states
+        void expand(const State& s, unsigned int row, const val_t* values, Arrangement& a, std::vector<State>& out, size_t max_states)
+        {
+            const val_t* row_values = values + row * BOARD_SIZE;
+            arrange(s, row_values, a, true);
+            if (count_orders(a, MAX_EXACT_ORDERS) > MAX_EXACT_ORDERS) split_runs(s, row, values, a);
+            std::vector<std::vector<uint8_t>> perms(a.runs.size());
+            for (size_t k = 0; k < a.runs.size(); k++){
+                perms[k].resize(a.runs[k].length);
+                for (unsigned int i = 0; i < a.runs[k].length; i++) perms[k][i] = i;
+            }
+
+            while (true){
+                State next = s;
+                next.rows[next.n_rows++] = row;
+                next.used_rows |= uint64_t(1) << row;
+                std::memcpy(next.col_tied, a.col_tied, sizeof(next.col_tied));
+                std::memcpy(next.stack_tied, a.stack_tied, sizeof(next.stack_tied));
+                std::memcpy(next.cols, a.cols, sizeof(next.cols));
+                // the column runs first, on the positions before the stacks are moved
+                for (size_t k = 0; k < a.runs.size(); k++){
+                    if (a.runs[k].stacks) continue;
+                    for (unsigned int i = 0; i < a.runs[k].length; i++){
+                        next.cols[a.runs[k].start + i] = a.cols[a.runs[k].start + perms[k][i]];
+                    }
+                }
+                for (size_t k = 0; k < a.runs.size(); k++){
+                    if (!a.runs[k].stacks) continue;
+                    uint8_t moved[BOARD_SIZE];
+                    std::memcpy(moved, next.cols, sizeof(moved));
+                    for (unsigned int i = 0; i < a.runs[k].length; i++){
+                        std::memcpy(next.cols + (a.runs[k].start + i) * GRID_SIZE, moved + (a.runs[k].start + perms[k][i]) * GRID_SIZE, GRID_SIZE);
+                    }
+                }
+                for (unsigned int p = 0; p < BOARD_SIZE; p++){
+                    val_t v = row_values[next.cols[p]];
+                    if (v && !next.labels[v]) next.labels[v] = next.next_label++;
+                }
+                out.push_back(next);
+                if (out.size() >= max_states) break;
+
+                // next combination of the run orders, like an odometer
+                size_t k = 0;
+                while (k < perms.size() && !std::next_permutation(perms[k].begin(), perms[k].end())) k++;
+                if (k == perms.size()) break;
+            }
+        }
+
+        // a row as seen from the state: the labels, and the other values kept as they are after them
+        void row_view(const State& s, const val_t* row_values, val_t* out)
+        {
+            for (unsigned int p = 0; p < BOARD_SIZE; p++){
+                val_t v = row_values[s.cols[p]];
+                out[p] = v == 0 ? 0 : (s.labels[v] ? s.labels[v] : UNLABELED + v);
+            }
+        }
+
+        // whether choosing one row or the other leads to the same completions:
+        // the rows are seen the same, and so are their bands when they start a band
+        bool same_choice(const State& s, const val_t* values, unsigned int r1, unsigned int r2)
+        {
+            val_t view1[BOARD_SIZE], view2[BOARD_SIZE];
+            row_view(s, values + r1 * BOARD_SIZE, view1);
+            row_view(s, values + r2 * BOARD_SIZE, view2);
+            if (!std::equal(view1, view1 + BOARD_SIZE, view2)) return false;
+            unsigned int band1 = r1 / GRID_SIZE, band2 = r2 / GRID_SIZE;
+            if (band1 == band2) return true;
+            std::vector<std::vector<val_t>> rows1(GRID_SIZE, std::vector<val_t>(BOARD_SIZE)), rows2(rows1);
+            for (unsigned int i = 0; i < GRID_SIZE; i++){
+                row_view(s, values + (band1 * GRID_SIZE + i) * BOARD_SIZE, rows1[i].data());
+                row_view(s, values + (band2 * GRID_SIZE + i) * BOARD_SIZE, rows2[i].data());
+            }
+            std::sort(rows1.begin(), rows1.end());
+            std::sort(rows2.begin(), rows2.end());
+            return rows1 == rows2;
+        }
+
+        // the length of a view: the next label, the ties, then the rows left to choose
+        const size_t VIEW_SIZE = 1 + BOARD_SIZE + GRID_SIZE + CELL_COUNT;
+
+        // the rows left to choose as seen from the state: two states with the same view
+        // (the labels and the other values kept as they are) have the same completions.
+        // The rows of a band can be chosen in any order, and so can the bands,
+        // so the rows are sorted within their band, and the bands not started are sorted
+        void view(const State& s, const val_t* values, val_t* out)
+        {
+            std::fill(out, out + VIEW_SIZE, 0);
+            *out++ = s.next_label;
+            for (unsigned int p = 0; p < BOARD_SIZE; p++) *out++ = s.col_tied[p];
+            for (unsigned int sp = 0; sp < GRID_SIZE; sp++) *out++ = s.stack_tied[sp];
+
+            val_t rows[CELL_COUNT];
+            auto row_less = [&rows](unsigned int x, unsigned int y){
+                return std::lexicographical_compare(rows + x * BOARD_SIZE, rows + (x + 1) * BOARD_SIZE, rows + y * BOARD_SIZE, rows + (y + 1) * BOARD_SIZE);
+            };
+            // the rows left in each band, sorted
+            unsigned int band_rows[BOARD_SIZE], band_size[GRID_SIZE];
+            for (unsigned int band = 0; band < GRID_SIZE; band++){
+                band_size[band] = 0;
+                unsigned int* left = band_rows + band * GRID_SIZE;
+                for (unsigned int r = band * GRID_SIZE; r < (band + 1) * GRID_SIZE; r++){
+                    if (s.used_rows & (uint64_t(1) << r)) continue;
+                    row_view(s, values + r * BOARD_SIZE, rows + r * BOARD_SIZE);
+                    left[band_size[band]++] = r;
+                }
+                std::sort(left, left + band_size[band], row_less);
+            }
+            // the current band first, then the bands not started
+            unsigned int bands[GRID_SIZE], n_bands = 0;
+            int current = s.n_rows % GRID_SIZE != 0 ? s.rows[s.n_rows - 1] / GRID_SIZE : -1;
+            for (unsigned int band = 0; band < GRID_SIZE; band++){
+                if (static_cast<int>(band) != current && band_size[band] == GRID_SIZE) bands[n_bands++] = band;
+            }
+            std::sort(bands, bands + n_bands, [&](unsigned int x, unsigned int y){
+                return std::lexicographical_compare(band_rows + x * GRID_SIZE, band_rows + (x + 1) * GRID_SIZE,
+                                                    band_rows + y * GRID_SIZE, band_rows + (y + 1) * GRID_SIZE, row_less);
+            });
+            auto write_band = [&](unsigned int band){
+                for (unsigned int i = 0; i < band_size[band]; i++){
+                    unsigned int r = band_rows[band * GRID_SIZE + i];
+                    out = std::copy(rows + r * BOARD_SIZE, rows + (r + 1) * BOARD_SIZE, out);
+                }
+            };
+            if (current >= 0) write_band(current);
+            for (unsigned int i = 0; i < n_bands; i++) write_band(bands[i]);
+        }
+
+        // the views met so far, looked up by their hash and compared in full
+        class ViewSet
+        {
+        public:
+            void clear()
+            {
+                m_views.clear();
+                m_index.clear();
+            }
+
+            // returns false if the view is already in the set
+            bool insert(const val_t* view)
+            {
+                // FNV-1a
+                uint64_t h = 14695981039346656037ull;
+                for (size_t i = 0; i < VIEW_SIZE; i++) h = (h ^ view[i]) * 1099511628211ull;
+                auto range = m_index.equal_range(h);
+                for (auto it = range.first; it != range.second; ++it){
+                    if (std::equal(view, view + VIEW_SIZE, m_views.data() + it->second * VIEW_SIZE)) return false;
+                }
+                m_index.emplace(h, m_views.size() / VIEW_SIZE);
+                m_views.insert(m_views.end(), view, view + VIEW_SIZE);
+                return true;
+            }
+
+        private:
+            std::vector<val_t> m_views;
+            std::unordered_multimap<uint64_t, size_t> m_index;
+        };
+    }
+
+    void minlex(const Board& board, Board& canonical_board, Transform* transform)
+    {
+        static_assert(BOARD_SIZE <= 64, "the used rows are stored as a 64 bits mask");
+        // the board as it is and transposed
+        val_t src[2][CELL_COUNT];
+        const val_t* data = board.data();
+        for (unsigned int r = 0; r < BOARD_SIZE; r++){
+            for (unsigned int c = 0; c < BOARD_SIZE; c++){
+                src[0][r * BOARD_SIZE + c] = data[r * BOARD_SIZE + c];
+                src[1][r * BOARD_SIZE + c] = data[c * BOARD_SIZE + r];
+            }
+        }
+
+        std::vector<State> states, next_states;
+        for (bool transpose: {false, true}){
+            State s;
+            std::memset(&s, 0, sizeof(s));
+            s.transpose = transpose;
+            s.next_label = 1;
+            for (unsigned int p = 0; p < BOARD_SIZE; p++){
+                s.cols[p] = p;
+                s.col_tied[p] = p % GRID_SIZE != 0;
+            }
+            for (unsigned int sp = 0; sp < GRID_SIZE; sp++){
+                s.stack_tied[sp] = sp != 0;
+            }
+            states.push_back(s);
+        }
+
+        Arrangement a;
+        ViewSet views;
+        val_t key[VIEW_SIZE];
+        val_t best[BOARD_SIZE], current[BOARD_SIZE];
+        std::vector<std::pair<size_t, unsigned int>> candidates;
+        for (unsigned int level = 0; level < BOARD_SIZE; level++){
+            // keep the (state, row) pairs giving the minimal next row,
+            // a row of the state that is seen the same as one already kept is skipped (as in an empty board)
+            candidates.clear();
+            for (size_t i = 0; i < states.size(); i++){
+                const State& s = states[i];
+                size_t first_of_state = candidates.size();
+                // a new band starts with any row of an unused band, otherwise the rows of the current band
+                unsigned int first = 0, last = BOARD_SIZE;
+                if (level % GRID_SIZE != 0){
+                    first = (s.rows[level - 1] / GRID_SIZE) * GRID_SIZE;
+                    last = first + GRID_SIZE;
+                }
+                for (unsigned int r = first; r < last; r++){
+                    if (s.used_rows & (uint64_t(1) << r)) continue;
+                    arrange(s, src[s.transpose] + r * BOARD_SIZE, a, false);
+                    row_string(s, a, current);
+                    int cmp = -1;
+                    if (!candidates.empty()){
+                        auto diff = std::mismatch(current, current + BOARD_SIZE, best);
+                        cmp = (diff.first == current + BOARD_SIZE) ? 0 : (*diff.first < *diff.second ? -1 : 1);
+                    }
+                    if (cmp < 0){
+                        candidates.clear();
+                        first_of_state = 0;
+                        std::memcpy(best, current, sizeof(best));
+                    }
+                    if (cmp <= 0 && std::none_of(candidates.begin() + first_of_state, candidates.end(),
+                                                 [&](const std::pair<size_t, unsigned int>& c){ return same_choice(s, src[s.transpose], c.second, r); })){
+                        candidates.emplace_back(i, r);
+                    }
+                }
+            }
+
+            // when there are too many states, keep one of each view, and at most MAX_STATES of them
+            next_states.clear();
+            views.clear();
+            size_t n_merged = 0;
+            for (auto& [i, r]: candidates){
+                expand(states[i], r, src[states[i].transpose], a, next_states, 2 * MAX_STATES);
+                if (next_states.size() < MAX_STATES) continue;
+                size_t kept = n_merged;
+                for (size_t k = n_merged; k < next_states.size(); k++){
+                    view(next_states[k], src[next_states[k].transpose], key);
+                    if (views.insert(key)) next_states[kept++] = next_states[k];
+                }
+                next_states.resize(std::min(kept, MAX_STATES));
+                n_merged = next_states.size();
+                if (n_merged >= MAX_STATES) break;
+            }
+            std::swap(states, next_states);
+        }
+
+        // all the remaining states give the same form, take the first
+        const State& s = states.front();
+        Transform t;
+        t.transpose = s.transpose;
+        std::memcpy(t.row, s.rows, sizeof(t.row));
+        std::memcpy(t.col, s.cols, sizeof(t.col));
+        t.value[0] = 0;
+        val_t next_label = s.next_label;
+        for (unsigned int v = 1; v <= CANDIDATE_SIZE; v++){
+            // the values missing from the board take the remaining labels
+            t.value[v] = s.labels[v] ? s.labels[v] : next_label++;
+        }
+        t.apply(board, canonical_board);
+        if (transform) *transform = t;
+    }
+
+    uint64_t hash(const Board& canonical_board)
+    {
+        // FNV-1a over the cells
+        uint64_t h = 14695981039346656037ull;
+        const val_t* data = canonical_board.data();
+        for (unsigned int i = 0; i < CELL_COUNT; i++){
+            h = (h ^ data[i]) * 1099511628211ull;
+        }
+        return h;
+    }
+}
@@ -0,0 +1,48 @@
+/*
+Canonical form of a board under the sudoku symmetry group: transposition, permutations of the bands
+and of the rows within a band, of the stacks and of the columns within a stack, and relabeling of the values.
+The canonical form is the minimal one in the lexicographic order of the cells (row-major, 0 as the smallest),
+two boards are equivalent if and only if they have the same canonical form.
+
+From 16x16 a row can have too many orders of its new values to try them all (the first row of a full grid has
+(4!)^5 of them), then only the orders consistent with a signature of the columns are tried, and the form
+is the minimal one among them: still the same for all the equivalent boards, but not always the minimal of all.
+The search is bounded, on boards with a very large symmetry group (as a grid built from a pattern) the bound
+can be hit: the form is then still equivalent to the board, but may differ between equivalent boards.
+*/
+
+#pragma once
+#include "board.h"
+#include "config.h"
+#include <cstdint>
+#include <random>
+
+namespace canonical
+{
+    // maps a board to an equivalent one:
+    //     out[i][j] = value[src[row[i]][col[j]]], with src the board, transposed first if transpose is set
+    struct Transform
+    {
+        bool transpose;
+        uint8_t row[BOARD_SIZE];
+        uint8_t col[BOARD_SIZE];
+        val_t value[CANDIDATE_SIZE + 1];    // value[0] is 0
+
+        void apply(const Board& in, Board& out) const;
+        Transform inverse() const;
+        static Transform identity();
+        static Transform random(std::mt19937& rng);
+    };
+
+    /*
+    Compute the canonical form of the board, and the transform mapping the board to it.
+    The rows are chosen one by one, keeping only the partial forms that are minimal so far,
+    the columns are ordered lazily: the ones that are indistinguishable so far (empty in all the chosen rows)
+    stay interchangeable, so that only the orders of distinct values are branched on.
+    Choices that lead to the same completions (identical rows, as in an empty board) are followed once.
+    */
+    void minlex(const Board& board, Board& canonical_board, Transform* transform = nullptr);
+
+    // a 64 bits hash of the cells, invariant under the symmetries when applied to a canonical form
+    uint64_t hash(const Board& canonical_board);
+}
@@ -0,0 +1,78 @@
+#include "canonical.h"
+#include "generate.h"
+#include "config.h"
+#include "testing.h"
+#include <chrono>
+#include <iostream>
+#include <random>
+
+// the canonical form of random equivalent boards is the same, and the transform maps the board to it
+bool check_equivalents(const Board& board, std::mt19937& rng){
+    Board canonical_board, canonical_other, mapped, back, other;
+    canonical::Transform transform;
+    canonical::minlex(board, canonical_board, &transform);
+    transform.apply(board, mapped);
+    transform.inverse().apply(canonical_board, back);
+    bool ok = mapped == canonical_board && back == board;
+    for (int i = 0; i < 20; i++){
+        canonical::Transform::random(rng).apply(board, other);
+        canonical::minlex(other, canonical_other, &transform);
+        transform.inverse().apply(canonical_other, back);
+        ok = ok && canonical_other == canonical_board && back == other;
+    }
+    return ok;
+}
+
+int main(){
+    std::mt19937 rng(42);
+    Board full, empty;
+    empty.clear(0);
+    gen::fill_valid_board(full, gen::FillStrategy::RANDOM);
+    Board puzzle(full);
+    for (unsigned int i = 0; i < CELL_COUNT; i += 3) puzzle.set(i, 0);
+    puzzle.set(1, 0);
+
+    ASSERT_TRUE(check_equivalents(full, rng));
+    ASSERT_TRUE(check_equivalents(puzzle, rng));
+    ASSERT_TRUE(check_equivalents(empty, rng));
+
+    // a full grid has too many orders of its first row to try them all from 16x16,
+    // and an empty board too many orders of its rows, both are done in well under a second
+    for (const Board* board: {&full, &empty}){
+        auto start = std::chrono::steady_clock::now();
+        Board canonical_board;
+        canonical::Transform transform;
+        canonical::minlex(*board, canonical_board, &transform);
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        Board mapped;
+        transform.apply(*board, mapped);
+        testing::check(mapped == canonical_board && elapsed < 1.0, board == &full ? "Full grid" : "Empty board");
+    }
+    // a single full row leaves all the orders of its values equivalent
+    Board one_row;
+    one_row.clear(0);
+    for (unsigned int i = 0; i < BOARD_SIZE; i++) one_row.set(i, full.get(i));
+    testing::check(check_equivalents(one_row, rng), "Single row");
+
+    // the inverse of a random transform undoes it
+    auto transform = canonical::Transform::random(rng);
+    Board mapped, back;
+    transform.apply(puzzle, mapped);
+    transform.inverse().apply(mapped, back);
+    ASSERT_TRUE(back == puzzle);
+
+    // the canonical form of a full grid starts with the values in order, and is canonical itself
+    Board canonical_board, twice;
+    canonical::minlex(full, canonical_board);
+    bool ordered = true;
+    for (unsigned int i = 0; i < BOARD_SIZE; i++) ordered = ordered && canonical_board.get(i) == i + 1;
+    canonical::minlex(canonical_board, twice);
+    ASSERT_TRUE(ordered && twice == canonical_board);
+
+    // a different grid has a different canonical form
+    Board other_full, other_canonical;
+    gen::fill_valid_board(other_full, gen::FillStrategy::RANDOM);
+    canonical::minlex(other_full, other_canonical);
+    ASSERT_TRUE(!(other_canonical == canonical_board));
+    return testing::exit_code();
+}
@@ -2,6 +2,8 @@
 
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <type_traits>
 
 #ifndef SIZE 
 #define SIZE 9
@@ -37,6 +39,11 @@ if (!(cond)) { throw std::runtime_error("Assertion failed: " __FILE__ ":" + std:
 
 typedef unsigned short val_t;
 
+// bitmask over the candidate values, bit (v - 1) stands for value v
+static_assert(CANDIDATE_SIZE <= 64, "candidate bitmask supports at most 64 values");
+typedef std::conditional<(CANDIDATE_SIZE <= 32), uint32_t, uint64_t>::type mask_t;
+const mask_t FULL_MASK = (CANDIDATE_SIZE == 64) ? ~mask_t(0) : ((mask_t(1) << (CANDIDATE_SIZE % 64)) - 1);
+
 enum class UnitType{
     ROW,
     COL,
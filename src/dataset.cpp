@@ -0,0 +1,65 @@
+#include "dataset.h"
+#include "config.h"
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+// character -> cell value, -1 for the characters that are not a valid cell on this board size
+static constexpr std::array<int8_t, 256> make_decode_table()
+{
+    std::array<int8_t, 256> table = {};
+    for (unsigned int c = 0; c < 256; c++){
+        int value = -1;
+        if (c == '.') value = 0;
+        else if (c >= '0' && c <= '9') value = c - '0';
+        else if (c >= 'a' && c <= 'z') value = c - 'a' + 10;
+        else if (c >= 'A' && c <= 'Z') value = c - 'A' + 10;
+        table[c] = (value > static_cast<int>(CANDIDATE_SIZE)) ? -1 : value;
+    }
+    return table;
+}
+static constexpr std::array<int8_t, 256> DECODE_TABLE = make_decode_table();
+
+bool CompactDataset::decode(const char* line, Board& board)
+{
+    val_t* cells = board.data();
+    // check the validity once at the end, so that the loop has no branch
+    int8_t invalid = 0;
+    for (unsigned int i = 0; i < CELL_COUNT; i++){
+        int8_t value = DECODE_TABLE[static_cast<unsigned char>(line[i])];
+        invalid |= value;
+        cells[i] = static_cast<val_t>(value);
+    }
+    return invalid >= 0;
+}
+
+CompactDataset::CompactDataset(const std::string& path): m_file(path)
+{
+    rewind();
+}
+
+void CompactDataset::rewind()
+{
+    m_cursor = m_file.data();
+    m_line_number = 0;
+}
+
+bool CompactDataset::next(Board& board)
+{
+    const char* end = m_file.data() + m_file.size();
+    while (m_cursor < end){
+        const char* line = m_cursor;
+        const char* newline = static_cast<const char*>(std::memchr(line, '\n', end - line));
+        const char* line_end = newline ? newline : end;
+        m_cursor = newline ? newline + 1 : end;
+        m_line_number++;
+
+        if (static_cast<size_t>(line_end - line) < CELL_COUNT) continue;
+        if (!decode(line, board)){
+            throw std::runtime_error("Invalid character on line " + std::to_string(m_line_number));
+        }
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,36 @@
+/*
+Most of the datasets store one puzzle per line in the compact format,
+each of the first CELL_COUNT characters of a line is a cell:
+- '.' or '0' is an empty cell
+- '1'-'9' are the values 1-9
+- a-z / A-Z are the values 10-35 (for 16x16 and 25x25 sudoku, case insensitive)
+The rest of a line is ignored, and lines shorter than CELL_COUNT are skipped.
+
+CompactDataset maps the whole file into memory and decodes the lines in place,
+straight into the board storage, without copying a line.
+*/
+
+#pragma once
+#include "board.h"
+#include "util.h"
+#include <string>
+
+class CompactDataset
+{
+public:
+    CompactDataset(const std::string& path);
+
+    // decode the next puzzle into the board, returns false at the end of the file,
+    // throws std::runtime_error on a character that is not a valid cell
+    bool next(Board& board);
+    void rewind();
+    unsigned long line_number() const { return m_line_number; }
+
+    // decode the first CELL_COUNT characters of a line, returns false on an invalid character
+    static bool decode(const char* line, Board& board);
+
+private:
+    util::MappedFile m_file;
+    const char* m_cursor;
+    unsigned long m_line_number;
+};
@@ -0,0 +1,45 @@
+#include "dataset.h"
+#include "config.h"
+#include "testing.h"
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+int main(){
+    const std::string path = "./output/dataset_test.txt";
+    std::string line_a(CELL_COUNT, '.');
+    std::string line_b(CELL_COUNT, '0');
+    line_a[0] = '1';
+    line_b[CELL_COUNT - 1] = (CANDIDATE_SIZE >= 10) ? 'a' : '9';
+    {
+        std::ofstream file(path, std::ios::trunc);
+        file << line_a << "\n" << "short line\n" << line_b << " trailing text\r\n" << line_a;
+    }
+
+    CompactDataset dataset(path);
+    Board board;
+    ASSERT_TRUE(dataset.next(board));
+    ASSERT_TRUE(board.get(0, 0) == 1 && board.get(0, 1) == 0);
+    ASSERT_TRUE(dataset.next(board));
+    ASSERT_TRUE(dataset.line_number() == 3);
+    ASSERT_TRUE(board.get(BOARD_SIZE - 1, BOARD_SIZE - 1) == ((CANDIDATE_SIZE >= 10) ? 10 : 9));
+    ASSERT_TRUE(dataset.next(board));   // the last line has no newline
+    ASSERT_TRUE(!dataset.next(board));
+
+    dataset.rewind();
+    ASSERT_TRUE(dataset.next(board) && board.get(0, 0) == 1);
+
+    // a value out of range is rejected
+    std::string invalid(CELL_COUNT, '.');
+    invalid[3] = '#';
+    ASSERT_TRUE(!CompactDataset::decode(invalid.c_str(), board));
+    {
+        std::ofstream file(path, std::ios::trunc);
+        file << invalid << "\n";
+    }
+    CompactDataset invalid_dataset(path);
+    bool thrown = false;
+    try{ invalid_dataset.next(board); } catch (std::runtime_error&){ thrown = true; }
+    ASSERT_TRUE(thrown);
+    return testing::exit_code();
+}
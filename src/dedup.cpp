@@ -0,0 +1,322 @@
+#include "dedup.h"
+#include "board.h"
+#include "canonical.h"
+#include "dataset.h"
+#include "packed.h"
+#include "util.h"
+#include "config.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace dedup
+{
+    // records per chunk, the canonical forms of a chunk are kept in memory
+    static const unsigned int CHUNK_SIZE = 16384;
+
+    // the records of the input, addressed by a locator increasing along the input:
+    // the byte offset of a line, or the index of a packed record
+    class Source
+    {
+    public:
+        virtual ~Source() = default;
+        // the locators of the next records, up to n, returns false at the end of the input
+        virtual bool next_chunk(std::vector<uint64_t>& locators, unsigned int n) = 0;
+        // returns false if the record is not a valid board
+        virtual bool load(uint64_t locator, Board& board) const = 0;
+        // copy the record to the output
+        virtual void write(uint64_t locator) = 0;
+        virtual void close() = 0;
+    };
+
+    class CompactSource: public Source
+    {
+    public:
+        CompactSource(const std::string& input_path, const std::string& output_path):
+            m_file(input_path), m_cursor(m_file.data()), m_out(output_path, std::ios::trunc)
+        {
+            if (!m_out.is_open()){
+                throw std::runtime_error("Failed to open file: " + output_path);
+            }
+        }
+
+        bool next_chunk(std::vector<uint64_t>& locators, unsigned int n) override
+        {
+            locators.clear();
+            const char* end = m_file.data() + m_file.size();
+            while (m_cursor < end && locators.size() < n){
+                const char* line = m_cursor;
+                const char* newline = static_cast<const char*>(std::memchr(line, '\n', end - line));
+                m_cursor = newline ? newline + 1 : end;
+                // the short lines are skipped, as by the dataset reader
+                if (static_cast<size_t>((newline ? newline : end) - line) >= CELL_COUNT){
+                    locators.push_back(line - m_file.data());
+                }
+            }
+            return !locators.empty();
+        }
+
+        bool load(uint64_t locator, Board& board) const override
+        {
+            return CompactDataset::decode(m_file.data() + locator, board);
+        }
+
+        void write(uint64_t locator) override
+        {
+            const char* line = m_file.data() + locator;
+            const char* end = m_file.data() + m_file.size();
+            const char* newline = static_cast<const char*>(std::memchr(line, '\n', end - line));
+            const char* line_end = newline ? newline : end;
+            if (line_end > line && line_end[-1] == '\r') line_end--;
+            m_out.write(line, line_end - line);
+            m_out.put('\n');
+        }
+
+        void close() override
+        {
+            m_out.close();
+        }
+
+    private:
+        util::MappedFile m_file;
+        const char* m_cursor;
+        std::ofstream m_out;
+    };
+
+    class PackedSource: public Source
+    {
+    public:
+        PackedSource(const std::string& input_path, const std::string& output_path):
+            m_reader(input_path), m_next(0),
+            m_writer(output_path, m_reader.has_solution() ? static_cast<uint32_t>(packed::HAS_SOLUTION) : 0u)
+        {}
+
+        bool next_chunk(std::vector<uint64_t>& locators, unsigned int n) override
+        {
+            locators.clear();
+            for (; m_next < m_reader.size() && locators.size() < n; m_next++){
+                locators.push_back(m_next);
+            }
+            return !locators.empty();
+        }
+
+        bool load(uint64_t locator, Board& board) const override
+        {
+            // a record with a value out of range is invalid, as a line with an invalid character
+            try{
+                m_reader.load(locator, board);
+            } catch (std::runtime_error&){
+                return false;
+            }
+            return true;
+        }
+
+        void write(uint64_t locator) override
+        {
+            Board puzzle, solution;
+            m_reader.load(locator, puzzle);
+            if (m_reader.has_solution()){
+                m_reader.load_solution(locator, solution);
+                m_writer.write(puzzle, solution);
+            }
+            else{
+                m_writer.write(puzzle);
+            }
+        }
+
+        void close() override
+        {
+            m_writer.close();
+        }
+
+    private:
+        packed::Reader m_reader;
+        uint64_t m_next;
+        packed::Writer m_writer;
+    };
+
+    // open addressing table of the first record of each class, by the hash of its canonical form,
+    // different classes can share a hash, so the slots with an equal hash are all visited.
+    // The transform of the record to its canonical form is kept with it, to confirm a match
+    // without canonicalising the record again
+    class Table
+    {
+    public:
+        struct Entry
+        {
+            uint64_t locator;
+            canonical::Transform transform;
+        };
+
+        Table(): m_slots(1 << 16) {}
+
+        void matches(uint64_t hash, std::vector<size_t>& entries) const
+        {
+            hash = hash ? hash : 1;
+            size_t mask = m_slots.size() - 1;
+            for (size_t i = hash & mask; m_slots[i].hash; i = (i + 1) & mask){
+                if (m_slots[i].hash == hash) entries.push_back(m_slots[i].entry);
+            }
+        }
+
+        void insert(uint64_t hash, uint64_t locator, const canonical::Transform& transform)
+        {
+            // keep the load factor under 1/2
+            if (2 * (m_entries.size() + 1) > m_slots.size()) grow();
+            place(hash ? hash : 1, m_entries.size());
+            m_entries.push_back({locator, transform});
+        }
+
+        const Entry& entry(size_t index) const { return m_entries[index]; }
+
+    private:
+        struct Slot
+        {
+            uint64_t hash;      // 0 for an empty slot
+            uint64_t entry;
+        };
+        std::vector<Slot> m_slots;
+        std::vector<Entry> m_entries;
+
+        void place(uint64_t hash, uint64_t entry)
+        {
+            size_t mask = m_slots.size() - 1;
+            size_t i = hash & mask;
+            while (m_slots[i].hash) i = (i + 1) & mask;
+            m_slots[i] = {hash, entry};
+        }
+
+        void grow()
+        {
+            std::vector<Slot> old(m_slots.size() * 2);
+            std::swap(old, m_slots);
+            for (auto& slot: old){
+                if (slot.hash) place(slot.hash, slot.entry);
+            }
+        }
+    };
+
+    enum class Status: uint8_t
+    {
+        INVALID, UNIQUE, PENDING, DUPLICATE
+    };
+
+    struct Item
+    {
+        uint64_t hash;
+        Board canonical_board;
+        canonical::Transform transform;
+        Status status;
+    };
+
+    // run f(i) for i in [0, n) on the pool, in contiguous slices
+    static void parallel_for(util::ThreadPool& pool, size_t n, const std::function<void(size_t)>& f)
+    {
+        size_t n_slices = std::min<size_t>(n, pool.size() * 4);
+        for (size_t s = 0; s < n_slices; s++){
+            pool.submit([&f, s, n, n_slices](){
+                for (size_t i = n * s / n_slices; i < n * (s + 1) / n_slices; i++) f(i);
+            });
+        }
+        pool.wait();
+    }
+
+    DedupStats dedup_file(const std::string& input_path, const std::string& output_path, unsigned int n_threads)
+    {
+        std::unique_ptr<Source> source;
+        if (packed::is_packed_file(input_path)){
+            source.reset(new PackedSource(input_path, output_path));
+        }
+        else{
+            source.reset(new CompactSource(input_path, output_path));
+        }
+
+        util::ThreadPool pool(n_threads);
+        DedupStats stats;
+        Table table;
+        std::vector<uint64_t> locators;
+        std::vector<size_t> candidates;
+        std::vector<Item> items(CHUNK_SIZE);
+        // the records to compare exactly with an earlier record of the same hash, by its entry in the table
+        std::vector<std::pair<size_t, size_t>> pairs;
+        std::vector<char> equal;
+        std::vector<size_t> late_inserted;
+
+        while (source->next_chunk(locators, CHUNK_SIZE)){
+            size_t n = locators.size();
+            parallel_for(pool, n, [&](size_t i){
+                Board board;
+                Item& item = items[i];
+                if (!source->load(locators[i], board)){
+                    item.status = Status::INVALID;
+                    return;
+                }
+                canonical::minlex(board, item.canonical_board, &item.transform);
+                item.hash = canonical::hash(item.canonical_board);
+                item.status = Status::UNIQUE;
+            });
+
+            // a record is unique if no earlier record has its hash, otherwise it is compared with them
+            pairs.clear();
+            for (size_t i = 0; i < n; i++){
+                if (items[i].status == Status::INVALID) continue;
+                candidates.clear();
+                table.matches(items[i].hash, candidates);
+                if (candidates.empty()){
+                    table.insert(items[i].hash, locators[i], items[i].transform);
+                    continue;
+                }
+                items[i].status = Status::PENDING;
+                for (size_t entry: candidates) pairs.emplace_back(i, entry);
+            }
+
+            equal.assign(pairs.size(), 0);
+            parallel_for(pool, pairs.size(), [&](size_t k){
+                // the earlier record is decoded again from the input, and mapped to its canonical form
+                const Table::Entry& entry = table.entry(pairs[k].second);
+                Board board, other;
+                source->load(entry.locator, board);
+                entry.transform.apply(board, other);
+                equal[k] = other == items[pairs[k].first].canonical_board;
+            });
+            for (size_t k = 0; k < pairs.size(); k++){
+                if (equal[k]) items[pairs[k].first].status = Status::DUPLICATE;
+            }
+
+            // the rest are hash collisions with other classes, rare enough to be resolved in order
+            late_inserted.clear();
+            for (size_t i = 0; i < n; i++){
+                if (items[i].status != Status::PENDING) continue;
+                stats.n_collisions++;
+                items[i].status = Status::UNIQUE;
+                for (size_t j: late_inserted){
+                    if (items[j].hash == items[i].hash && items[j].canonical_board == items[i].canonical_board){
+                        items[i].status = Status::DUPLICATE;
+                        break;
+                    }
+                }
+                if (items[i].status == Status::UNIQUE){
+                    table.insert(items[i].hash, locators[i], items[i].transform);
+                    late_inserted.push_back(i);
+                }
+            }
+
+            for (size_t i = 0; i < n; i++){
+                stats.n_records++;
+                switch (items[i].status){
+                    case Status::INVALID: stats.n_invalid++; break;
+                    case Status::DUPLICATE: stats.n_duplicates++; break;
+                    default:
+                        stats.n_unique++;
+                        source->write(locators[i]);
+                }
+            }
+        }
+        source->close();
+        return stats;
+    }
+}
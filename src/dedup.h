@@ -0,0 +1,32 @@
+/*
+Removal of the duplicate puzzles of a dataset, including the equivalent copies
+(transposed, bands / rows / stacks / columns permuted, values relabeled).
+The input is a compact text dataset or a packed file, the output keeps the first puzzle of each
+equivalence class, in the input order and in the format of the input (the lines as they are,
+or the packed records with their solutions).
+
+The records are processed in chunks: the canonical forms are computed on a pool of threads,
+then looked up in an open addressing table of (hash, entry) pairs, 16 bytes per slot,
+with an entry per class: the locator of its first record and the transform of the record to its canonical form.
+A hash match is confirmed exactly by decoding the first record of the class again from the mapped input
+and applying the transform, without computing its canonical form again,
+so the memory is bounded by the table and a chunk, whatever the size of the records.
+*/
+
+#pragma once
+#include <string>
+
+namespace dedup
+{
+    struct DedupStats
+    {
+        unsigned long n_records = 0;
+        unsigned long n_unique = 0;
+        unsigned long n_duplicates = 0;
+        unsigned long n_invalid = 0;        // lines with an invalid character, dropped
+        unsigned long n_collisions = 0;     // hash matches between different classes
+    };
+
+    // throws std::runtime_error if a file can not be opened
+    DedupStats dedup_file(const std::string& input_path, const std::string& output_path, unsigned int n_threads);
+}
@@ -0,0 +1,59 @@
+#include "dedup.h"
+#include "canonical.h"
+#include "generate.h"
+#include "packed.h"
+#include "config.h"
+#include "testing.h"
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+int main(){
+    // more lines than a chunk, equivalent copies of a few classes in a random order
+    const unsigned int n_classes = 300, n_lines = 20000;
+    std::vector<Board> puzzles;
+    for (unsigned int i = 0; i < n_classes; i++){
+        Board grid;
+        gen::fill_valid_board(grid, gen::FillStrategy::RANDOM);
+        puzzles.emplace_back(grid);
+        for (unsigned int j = i % 7; j < CELL_COUNT; j += 7) puzzles.back().set(j, 0);
+    }
+    std::mt19937 rng(11);
+    std::vector<std::string> expected;
+    std::vector<bool> seen(n_classes, false);
+    {
+        std::ofstream file("output/dedup_test.txt");
+        for (unsigned int i = 0; i < n_lines; i++){
+            unsigned int c = rng() % n_classes;
+            Board copy;
+            canonical::Transform::random(rng).apply(puzzles[c], copy);
+            std::string line = copy.to_string(BoardFormat::COMPACT);
+            file << line;
+            if (!seen[c]) expected.push_back(line);
+            seen[c] = true;
+            if (i == 100) file << std::string(CELL_COUNT, '?') << "\n";
+        }
+    }
+
+    auto stats = dedup::dedup_file("output/dedup_test.txt", "output/dedup_test_unique.txt", 3);
+    ASSERT_TRUE(stats.n_records == n_lines + 1 && stats.n_invalid == 1);
+    ASSERT_TRUE(stats.n_unique == expected.size() && stats.n_duplicates == n_lines - expected.size());
+
+    // the first line of each class is kept, in order
+    std::ifstream unique_file("output/dedup_test_unique.txt");
+    bool same = true;
+    unsigned int n = 0;
+    for (std::string line; std::getline(unique_file, line); n++){
+        same = same && n < expected.size() && line + "\n" == expected[n];
+    }
+    ASSERT_TRUE(same && n == expected.size());
+
+    // the same on the packed file, and the output is packed too
+    packed::from_text("output/dedup_test_unique.txt", "output/dedup_test.sdkp");
+    auto packed_stats = dedup::dedup_file("output/dedup_test.sdkp", "output/dedup_test_unique.sdkp", 2);
+    packed::Reader reader("output/dedup_test_unique.sdkp");
+    ASSERT_TRUE(packed_stats.n_unique == expected.size() && packed_stats.n_duplicates == 0 && reader.size() == expected.size());
+    return testing::exit_code();
+}
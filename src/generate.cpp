@@ -9,6 +9,8 @@ namespace py = pybind11;
 #include "indexer.h"
 #include "util.h"
 #include "solver.h"
+#include "bit_search.h"
+#include "parser.hpp"
 #include <ostream>
 #include <tuple>
 #include <algorithm>
@@ -21,6 +23,8 @@ static Indexer indexer;
 static std::mutex mtx;
 
 namespace gen_helper{
+    using gen::VerdictCache;
+
     /*
     a meta board is a board that contains the simplist form of a filled board
     generated with fixed strategy.
@@ -58,28 +62,29 @@ namespace gen_helper{
     Apply random equivalence transformation to the board
     */
     void apply_random_transform(Board& board, unsigned int n_repeats){
-        std::srand(std::time(nullptr));
+        // the engine of the thread, so that concurrent attempts start from different grids
+        std::mt19937& rng = util::thread_rng();
         for (unsigned int i = 0; i < n_repeats; i++){
-            unsigned int transform_type = std::rand() % 4;
+            unsigned int transform_type = rng() % 4;
             unsigned int idx1;
             unsigned int idx2;
             unsigned int g_idx1;
             unsigned int g_idx2;
             switch (transform_type){
                 case 0:
-                    idx1 = std::rand() % GRID_SIZE;
-                    idx2 = std::rand() % GRID_SIZE;
-                    g_idx1 = std::rand() % GRID_SIZE;
+                    idx1 = rng() % GRID_SIZE;
+                    idx2 = rng() % GRID_SIZE;
+                    g_idx1 = rng() % GRID_SIZE;
                     BoardEquivalenceTransform::swap_row(board, g_idx1, idx1, idx2);
                     break;
                 case 1:
-                    g_idx1 = std::rand() % GRID_SIZE;
-                    g_idx2 = std::rand() % GRID_SIZE;
+                    g_idx1 = rng() % GRID_SIZE;
+                    g_idx2 = rng() % GRID_SIZE;
                     BoardEquivalenceTransform::swap_band(board, g_idx1, g_idx2);
                     break;
                 case 2:
-                    idx1 = std::rand() % CANDIDATE_SIZE;
-                    idx2 = std::rand() % CANDIDATE_SIZE;
+                    idx1 = rng() % CANDIDATE_SIZE;
+                    idx2 = rng() % CANDIDATE_SIZE;
                     BoardEquivalenceTransform::swap_value(board, idx1 + 1, idx2 + 1);
                     break;
                 case 3:
@@ -301,7 +306,9 @@ namespace gen_helper{
         Board& board, 
         const Board& solution, 
         unsigned int n_clues_to_remove, 
-        long max_depth = CELL_COUNT*2
+        long max_depth = CELL_COUNT*2,
+        VerdictCache* cache = nullptr,
+        gen::GenerateProgress* progress = nullptr
     ){
         struct StackItem{
             std::vector<unsigned int> indices;
@@ -310,6 +317,8 @@ namespace gen_helper{
         };
         Board original_board = Board(board);
         std::stack<StackItem> stack;
+        uint64_t key = VerdictCache::hash(board);
+        unsigned int n_clues = gen::count_clues(board);
 
         // fill the first one
         stack.push({get_randomized_filled_indices(board), 0, 0});
@@ -318,13 +327,17 @@ namespace gen_helper{
 
         long depth_remain = max_depth;
         while (stack.size() > 0){
-            if (stop_flag.load()){
+            if (stop_flag.load() || (progress && progress->expired())){
                 return std::make_tuple(false, depth_remain);
             }
 
             StackItem& top_item = stack.top();
             if (top_item.next_idx >= top_item.indices.size()){
                 // all indices are tried, revert the base index
+                if (board.get(top_item.base_pos) != original_board.get(top_item.base_pos)){
+                    key ^= VerdictCache::zobrist(top_item.base_pos);
+                    n_clues++;
+                }
                 board.set(top_item.base_pos, original_board.get(top_item.base_pos));
                 stack.pop();
 
@@ -336,14 +349,23 @@ namespace gen_helper{
             // remove the next index and check if the board is still uniquely solvable
             unsigned int pos = top_item.indices[top_item.next_idx];
             board.set(pos, 0);
+            key ^= VerdictCache::zobrist(pos);
             depth_remain--; if (depth_remain < n_clues_to_remove){ return std::make_tuple(false, depth_remain); }
 
-            if (!uniquely_solvable(board, solution)){
+            bool unique;
+            if (!cache || !cache->lookup(key, unique)){
+                unique = uniquely_solvable(board, solution);
+                if (cache) cache->store(key, unique);
+            }
+            if (!unique){
                 board.set(pos, original_board.get(pos));
+                key ^= VerdictCache::zobrist(pos);
                 top_item.next_idx++;
                 continue;
             }
             n_clues_to_remove--;
+            n_clues--;
+            if (progress) progress->offer(board, n_clues);
 
             if (n_clues_to_remove == 0){ return std::make_tuple(true, depth_remain); }
 
@@ -352,58 +374,305 @@ namespace gen_helper{
         }
         return std::make_tuple(false, depth_remain);
     }
+
+    /*
+    Same search as remove_n_clues_iteratively, 
+    but the candidate positions of a step are tested concurrently on the thread pool.
+    The first removal found to keep the board uniquely solvable is committed, 
+    the results of the other tests in flight are dropped as stale.
+    */
+    std::tuple<bool, long> remove_n_clues_speculative(
+        util::ThreadPool& pool,
+        std::atomic_bool& stop_flag,
+        Board& board, 
+        const Board& solution, 
+        unsigned int n_clues_to_remove, 
+        long max_depth = CELL_COUNT*2,
+        VerdictCache* cache = nullptr,
+        gen::GenerateProgress* progress = nullptr
+    ){
+        struct StackItem{
+            std::vector<unsigned int> indices;
+            unsigned int base_pos;  // the position that should be reverted if all indices are tried
+            unsigned int next_idx;  // indices before it are tried
+        };
+
+        // shared with the tasks, which may outlive this call if they are stale
+        struct Speculation{
+            std::mutex mtx;
+            std::condition_variable cv;
+            unsigned long epoch = 0;
+            unsigned int n_done = 0;        // tests finished in the current epoch
+            int found_idx = -1;             // index (in the window) of the first removal that stays unique
+            VerdictCache* cache = nullptr;  // detached on return, so stale tasks do not touch it
+        };
+        auto spec = std::make_shared<Speculation>();
+        spec->cache = cache;
+        auto detach = [&spec](std::tuple<bool, long> result){
+            std::lock_guard<std::mutex> lock(spec->mtx);
+            spec->epoch++;
+            spec->cache = nullptr;
+            return result;
+        };
+
+        Board original_board = Board(board);
+        std::stack<StackItem> stack;
+        stack.push({get_randomized_filled_indices(board), 0, 0});
+        uint64_t key = VerdictCache::hash(board);
+        unsigned int n_clues = gen::count_clues(board);
+
+        long depth_remain = max_depth;
+        while (stack.size() > 0){
+            if (stop_flag.load() || (progress && progress->expired())){
+                return detach(std::make_tuple(false, depth_remain));
+            }
+
+            StackItem& top_item = stack.top();
+            if (top_item.next_idx >= top_item.indices.size()){
+                // all indices are tried, revert the base index
+                if (board.get(top_item.base_pos) != original_board.get(top_item.base_pos)){
+                    key ^= VerdictCache::zobrist(top_item.base_pos);
+                    n_clues++;
+                }
+                board.set(top_item.base_pos, original_board.get(top_item.base_pos));
+                stack.pop();
+
+                n_clues_to_remove++;
+                depth_remain--; if (depth_remain < n_clues_to_remove){ return detach(std::make_tuple(false, depth_remain)); }
+                continue;
+            }
+
+            // collect a window of untried positions without a known verdict, 
+            // keeping [next_idx, next_idx + window) as the window
+            unsigned int window = 0;
+            int found_idx = -1;
+            {
+                std::lock_guard<std::mutex> lock(spec->mtx);
+                for (unsigned int j = top_item.next_idx; j < top_item.indices.size() && window < pool.size(); j++){
+                    bool unique;
+                    if (!cache || !cache->lookup(key ^ VerdictCache::zobrist(top_item.indices[j]), unique)){
+                        window++;
+                        continue;
+                    }
+                    std::swap(top_item.indices[j], top_item.indices[top_item.next_idx + window]);
+                    if (unique){
+                        found_idx = window;
+                        break;
+                    }
+                    // known to be not unique, move it to the tried part
+                    std::swap(top_item.indices[top_item.next_idx], top_item.indices[top_item.next_idx + window]);
+                    top_item.next_idx++;
+                    depth_remain--;
+                }
+            }
+            if (depth_remain < n_clues_to_remove){ return detach(std::make_tuple(false, depth_remain)); }
+
+            if (found_idx < 0 && window > 0){
+                // test the window concurrently
+                unsigned long epoch;
+                {
+                    std::lock_guard<std::mutex> lock(spec->mtx);
+                    epoch = ++spec->epoch;
+                    spec->n_done = 0;
+                    spec->found_idx = -1;
+                }
+                for (unsigned int i = 0; i < window; i++){
+                    unsigned int pos = top_item.indices[top_item.next_idx + i];
+                    uint64_t forked_key = key ^ VerdictCache::zobrist(pos);
+                    Board forked_board(board);
+                    forked_board.set(pos, 0);
+                    pool.submit([spec, epoch, i, forked_key, forked_board, solution](){
+                        {
+                            std::lock_guard<std::mutex> lock(spec->mtx);
+                            if (spec->epoch != epoch) return;
+                        }
+                        bool unique = uniquely_solvable(forked_board, solution);
+                        std::lock_guard<std::mutex> lock(spec->mtx);
+                        // a stale verdict is still valid for the cache
+                        if (spec->cache) spec->cache->store(forked_key, unique);
+                        if (spec->epoch != epoch) return;
+                        spec->n_done++;
+                        if (unique && spec->found_idx < 0){ spec->found_idx = i; }
+                        spec->cv.notify_one();
+                    });
+                }
+
+                unsigned int n_done;
+                {
+                    std::unique_lock<std::mutex> lock(spec->mtx);
+                    while (!spec->cv.wait_for(lock, std::chrono::milliseconds(10), [&](){ 
+                        return spec->found_idx >= 0 || spec->n_done == window; 
+                    })){
+                        if (stop_flag.load() || (progress && progress->expired())) break;
+                    }
+                    found_idx = spec->found_idx;
+                    n_done = spec->n_done;
+                    spec->epoch++;      // the remaining tests are stale now
+                }
+                if (stop_flag.load() || (progress && progress->expired())){
+                    return detach(std::make_tuple(false, depth_remain));
+                }
+
+                depth_remain -= n_done; if (depth_remain < n_clues_to_remove){ return detach(std::make_tuple(false, depth_remain)); }
+                if (found_idx < 0){
+                    top_item.next_idx += window;
+                    continue;
+                }
+            }
+            if (found_idx < 0) continue;
+
+            // move the committed position to the tried part, the unfinished ones are left untried
+            std::swap(top_item.indices[top_item.next_idx], top_item.indices[top_item.next_idx + found_idx]);
+            unsigned int pos = top_item.indices[top_item.next_idx];
+            top_item.next_idx++;
+
+            board.set(pos, 0);
+            key ^= VerdictCache::zobrist(pos);
+            n_clues_to_remove--;
+            n_clues--;
+            if (progress) progress->offer(board, n_clues);
+            if (n_clues_to_remove == 0){ return detach(std::make_tuple(true, depth_remain)); }
+
+            auto next_indices = get_randomized_filled_indices(board);
+            stack.push({next_indices, pos, 0});
+        }
+        return detach(std::make_tuple(false, depth_remain));
+    }
 }
 
 namespace gen{
 
+    unsigned int count_clues(const Board& board){
+        unsigned int n = 0;
+        for (unsigned int i = 0; i < CELL_COUNT; i++){
+            n += board.data()[i] != 0;
+        }
+        return n;
+    }
+
     void fill_valid_board(Board &board, FillStrategy strategy){
         if (strategy == FillStrategy::SEARCH){
             board.clear(0);
             gen_helper::fill_cell_iterative(board);
         }
+        else if (strategy == FillStrategy::RANDOM){
+            // the search object is large for big boards, keep it off the stack
+            auto search = std::unique_ptr<BitSearch>(new BitSearch());
+            board.clear(0);
+            search->fill_random(board, util::thread_rng());
+            ASSERT(board.is_solved(), "Invalid board, error while filling the board");
+        }
         else{
             board.load_data(gen_helper::get_meta_board());
             gen_helper::apply_random_transform(board, 100*BOARD_SIZE);
         }
     }
 
-    bool remove_clues_by_solve(std::atomic_bool& stop_flag, Board& board, const Board& solution, int n_clues_to_remove){
+    void GenerateProgress::offer(const Board& board, unsigned int n_clues){
+        if (n_clues >= best_n_clues.load()) return;
+        std::lock_guard<std::mutex> lock(best_mutex);
+        if (n_clues >= best_n_clues.load()) return;
+        best_board.load_data(board);
+        best_n_clues.store(n_clues);
+    }
+
+    bool remove_clues_by_solve(
+        std::atomic_bool& stop_flag, Board& board, const Board& solution, int n_clues_to_remove, 
+        util::ThreadPool* pool, GenerateProgress* progress
+        ){
         if (n_clues_to_remove == 0){ return board == solution; }
-        auto result = gen_helper::remove_n_clues_iteratively(stop_flag, board, solution, n_clues_to_remove);
+        VerdictCache cache;
+        std::tuple<bool, long> result;
+        if (pool){
+            result = gen_helper::remove_n_clues_speculative(*pool, stop_flag, board, solution, n_clues_to_remove, CELL_COUNT*2, &cache, progress);
+        }
+        else{
+            result = gen_helper::remove_n_clues_iteratively(stop_flag, board, solution, n_clues_to_remove, CELL_COUNT*2, &cache, progress);
+        }
+        if (progress){
+            progress->n_verdict_lookups += cache.n_lookups;
+            progress->n_verdict_hits += cache.n_hits;
+        }
         return std::get<0>(result);
     }
 
-    std::tuple<bool, Board> generate_board(
+    std::tuple<bool, Board> try_generate_board(
+        unsigned int n_clues_remain, std::atomic_bool& stop_flag, util::ThreadPool* pool, GenerateProgress* progress
+        ){
+        Board board = Board();
+        if (n_clues_remain > CELL_COUNT){
+            return std::make_tuple(false, board);
+        }
+        fill_valid_board(board, FillStrategy::TRANSFORM);
+        auto solution = Board(board);
+        // the full board is the fallback, if no clue can be removed in time
+        if (progress) progress->offer(solution, CELL_COUNT);
+
+        if (stop_flag.load() || (progress && progress->expired())){ return std::make_tuple(false, board); }
+
+        // speed up...
+        unsigned int n_to_remove_ = CELL_COUNT - n_clues_remain;
+        const int confident_remove_bound = CELL_COUNT / 3;
+        if (n_to_remove_ > confident_remove_bound){
+            gen_helper::remove_clues_no_check(board, confident_remove_bound);
+            n_to_remove_ -= confident_remove_bound;
+        }
+
+        bool generated = remove_clues_by_solve(stop_flag, board, solution, n_to_remove_, pool, progress);
+        return std::make_tuple(generated, board);
+    }
+
+    std::tuple<bool, Board, unsigned int> generate_board(
         unsigned int n_clues_remain, 
         unsigned int max_retries, 
         bool parallel_exec, 
-        bool verbose
+        bool verbose,
+        double timeout,
+        std::atomic_bool* external_stop_flag
         ){
         Board board;
         if (n_clues_remain > CELL_COUNT){
-            return std::make_tuple(false, board);
+            return std::make_tuple(false, board, 0);
         }
 
-        unsigned int n_clues_to_remove = CELL_COUNT - n_clues_remain;
-        std::atomic_bool stop_flag(false);
-        auto fn_thread = [n_clues_to_remove, &stop_flag, verbose](
-            std::promise<std::tuple<bool, Board>> promise
-        ){
-            Board board = Board();
-            fill_valid_board(board, FillStrategy::TRANSFORM);
-            auto solution = Board(board);
-
-            if (stop_flag.load()){ promise.set_value(std::make_tuple(false, board)); return; }
-
-            // speed up...
-            unsigned int n_to_remove_ = n_clues_to_remove;
-            const int confident_remove_bound = CELL_COUNT / 3;
-            if (n_to_remove_ > confident_remove_bound){
-                gen_helper::remove_clues_no_check(board, confident_remove_bound);
-                n_to_remove_ -= confident_remove_bound;
+        // the caller's flag is only read: the concurrent attempts are stopped through a flag of their own,
+        // which the caller's flag trips, so that a success does not look like a cancellation to the caller
+        std::atomic_bool local_stop_flag(false);
+        std::atomic_bool& stop_flag = external_stop_flag ? *external_stop_flag : local_stop_flag;
+        bool speculative = parallel_exec && parser::parse_env("GENERATOR_SPECULATIVE", BOARD_SIZE >= 16);
+        std::atomic_bool siblings_stop_flag(false);
+        std::atomic_bool& attempt_stop_flag = (parallel_exec && !speculative) ? siblings_stop_flag : stop_flag;
+        GenerateProgress progress;
+        if (timeout > 0){
+            progress.has_deadline = true;
+            progress.deadline = std::chrono::steady_clock::now() + 
+                std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(timeout));
+        }
+
+        // the exact board if generated, otherwise the best one found so far
+        auto make_result = [&progress, verbose, n_clues_remain](const std::tuple<bool, Board>& attempt){
+            if (verbose){
+                unsigned long n_lookups = progress.n_verdict_lookups.load();
+                unsigned long n_hits = progress.n_verdict_hits.load();
+                std::cout << "Uniqueness cache hits: " << n_hits << "/" << n_lookups;
+                if (n_lookups > 0) std::cout << " (" << 100.0 * n_hits / n_lookups << "%)";
+                std::cout << std::endl;
+            }
+            if (std::get<0>(attempt)){
+                return std::make_tuple(true, std::get<1>(attempt), n_clues_remain);
             }
+            std::lock_guard<std::mutex> lock(progress.best_mutex);
+            unsigned int n_clues = progress.best_n_clues.load();
+            if (verbose && n_clues <= CELL_COUNT && progress.expired()){
+                std::cout << "Time is up, the best board has " << n_clues << " clues." << std::endl;
+            }
+            return std::make_tuple(false, Board(progress.best_board), n_clues <= CELL_COUNT ? n_clues : 0);
+        };
 
-            bool generated = remove_clues_by_solve(stop_flag, board, solution, n_to_remove_);
+        auto fn_thread = [n_clues_remain, &attempt_stop_flag, &progress, verbose](
+            std::promise<std::tuple<bool, Board>> promise
+        ){
+            auto [generated, board] = try_generate_board(n_clues_remain, attempt_stop_flag, nullptr, &progress);
             if (generated){
                 promise.set_value(std::make_tuple(true, board));
             }
@@ -419,17 +688,37 @@ namespace gen{
         if (!parallel_exec){
             if (verbose) std::cout << "Generating board (" << BOARD_SIZE << "x" << BOARD_SIZE <<
             ") with " << n_clues_remain << " clues remaining." << std::flush;
-            for (unsigned int i = 0; i < max_retries; i++){
+            std::tuple<bool, Board> result{false, board};
+            for (unsigned int i = 0; i < max_retries && !std::get<0>(result) && !progress.expired() && !stop_flag; i++){
                 auto promise = std::promise<std::tuple<bool, Board>>();
                 auto future = promise.get_future();
                 fn_thread(std::move(promise));
-                auto [success, b] = future.get();
-                if (success){
-                    std::cout << std::endl;
-                    return std::make_tuple(true, b);
+                result = future.get();
+            }
+            if (verbose) std::cout << std::endl;
+            return make_result(result);
+        }
+
+        // speculative execution, the threads work together on one attempt at a time
+        // this pays off on large boards, where a single attempt is long
+        if (speculative){
+            util::ThreadPool pool(std::max(std::thread::hardware_concurrency(), 1u));
+            if (verbose) std::cout << "Generating board (" << BOARD_SIZE << "x" << BOARD_SIZE <<
+            ") with " << n_clues_remain << " clues remaining" << " (" << pool.size() << " speculative)." << std::flush;
+
+            std::tuple<bool, Board> result{false, board};
+            for (unsigned int i = 0; i < max_retries && !std::get<0>(result) && !progress.expired() && !stop_flag; i++){
+                #ifdef PYBIND11_BUILD
+                // the generation may also run on native threads that do not hold the GIL
+                if (PyGILState_Check() && PyErr_CheckSignals() != 0){
+                    throw py::error_already_set();
                 }
+                #endif
+                result = try_generate_board(n_clues_remain, stop_flag, &pool, &progress);
+                if (verbose && !std::get<0>(result)) std::cout << '.' << std::flush;
             }
-            return std::make_tuple(false, board);
+            if (verbose) std::cout << std::endl;
+            return make_result(result);
         }
 
         // parallel execution
@@ -442,31 +731,45 @@ namespace gen{
         if (verbose) std::cout << "Generating board (" << BOARD_SIZE << "x" << BOARD_SIZE <<
         ") with " << n_clues_remain << " clues remaining" << " (" << n_concurrent << " concurrent)." << std::flush;
 
-        std::vector<std::thread> threads;
+        // one thread per slot, joined before its slot runs the next attempt
+        std::array<std::thread, MAX_THREADS> threads;
         unsigned int submitted_counter = 0;
+        auto join_all = [&threads](){
+            for (auto& t: threads){
+                if (t.joinable()) t.join();
+            }
+        };
 
         // submit the first batch
         for (unsigned int i = 0; i < n_concurrent; i++){
             auto promise = std::promise<std::tuple<bool, Board>>();
             futures[i] = promise.get_future();
-            threads.emplace_back(fn_thread, std::move(promise));
+            threads[i] = std::thread(fn_thread, std::move(promise));
             submitted_counter++;
         }
 
         std::tuple<bool, Board> result{false, board};
         while(submitted_counter < max_retries && !std::get<0>(result)){
             #ifdef PYBIND11_BUILD
-            if (PyErr_CheckSignals() != 0){
+            if (PyGILState_Check() && PyErr_CheckSignals() != 0){
+                // the running attempts give up, they must be joined before unwinding
+                attempt_stop_flag.store(true);
+                join_all();
                 throw py::error_already_set();
             }
             #endif
+            if (progress.expired() || stop_flag){
+                attempt_stop_flag.store(true);
+                break;
+            }
 
             for (unsigned int i = 0; i < n_concurrent; i++){
                 if (futures[i].valid() && futures[i].wait_for(std::chrono::microseconds(1)) == std::future_status::ready){
                     auto [success, b] = futures[i].get();
+                    threads[i].join();
                     // std::cout << "Checking futures " << i << std::endl;
                     if (success){
-                        stop_flag.store(true);
+                        attempt_stop_flag.store(true);
                         result = std::make_tuple(true, b);
                         break;
                     }
@@ -475,7 +778,7 @@ namespace gen{
                         // std::cout << "Submitting new thread " << submitted_counter << std::endl;
                         auto promise = std::promise<std::tuple<bool, Board>>();
                         futures[i] = promise.get_future();
-                        threads.emplace_back(fn_thread, std::move(promise));
+                        threads[i] = std::thread(fn_thread, std::move(promise));
                         submitted_counter++;
                     }
                 }
@@ -483,12 +786,10 @@ namespace gen{
         }
 
         // wait for all threads to finish, clean up
-        for (auto& t: threads){
-            t.join();
-        }
+        join_all();
         if (verbose) std::cout << std::endl;
 
-        return result;
+        return make_result(result);
     }
 
 }
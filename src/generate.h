@@ -1,20 +1,125 @@
 #pragma once
 #include "board.h"
+#include "util.h"
+#include <array>
+#include <cstdint>
+#include <random>
 #include <tuple>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <mutex>
 
 namespace gen
 {
+    // the fewest clues a uniquely solvable puzzle can have, proven for 4x4 and 9x9 and the best known for 16x16,
+    // otherwise the bound of a missing value: a puzzle without two of the values has at least two solutions
+    const unsigned int MIN_CLUES = BOARD_SIZE == 4 ? 4 : BOARD_SIZE == 9 ? 17 : BOARD_SIZE == 16 ? 55 : BOARD_SIZE - 1;
+
     enum class FillStrategy
     {
         SEARCH, 
-        TRANSFORM
+        TRANSFORM,
+        RANDOM,         // randomized bitmask search, reaches every solution grid
     };
+    // the generator fills with TRANSFORM: the transformed pattern grid reaches low clue counts far faster,
+    // RANDOM is for where the variety of the grids matters
     void fill_valid_board(Board& board, FillStrategy strategy = FillStrategy::TRANSFORM);
     bool remove_clues_by_solve(Board& board, int n_clues_to_remove);
-    std::tuple<bool, Board> generate_board(
+
+    /*
+    Bounded cache of uniqueness verdicts, scoped to one generation attempt.
+    Within an attempt the clue values are given by the solution, 
+    so a board is identified by the positions of it's remaining clues, 
+    which are hashed with zobrist keys and can be updated per removed / restored clue.
+    The table is direct-mapped, a new verdict replaces the entry of the same slot.
+    */
+    class VerdictCache
+    {
+    public:
+        VerdictCache(unsigned int capacity_log2 = 14): 
+        m_entries(size_t(1) << capacity_log2), m_mask((size_t(1) << capacity_log2) - 1), n_lookups(0), n_hits(0) {}
+
+        static uint64_t zobrist(unsigned int pos){
+            static const std::array<uint64_t, CELL_COUNT> keys = [](){
+                std::array<uint64_t, CELL_COUNT> keys;
+                std::mt19937_64 rng(0x5d0c5eedULL);
+                for (auto& k: keys){ k = rng(); }
+                return keys;
+            }();
+            return keys[pos];
+        }
+
+        static uint64_t hash(const Board& board){
+            uint64_t h = 0;
+            for (unsigned int i = 0; i < CELL_COUNT; i++){
+                if (board.data()[i] != 0){ h ^= zobrist(i); }
+            }
+            return h;
+        }
+
+        bool lookup(uint64_t key, bool& verdict){
+            n_lookups++;
+            const Entry& e = m_entries[key & m_mask];
+            if (e.state == 0 || e.key != key) return false;
+            n_hits++;
+            verdict = e.state == 2;
+            return true;
+        }
+
+        void store(uint64_t key, bool verdict){
+            m_entries[key & m_mask] = {key, static_cast<uint8_t>(verdict ? 2 : 1)};
+        }
+
+    private:
+        struct Entry{
+            uint64_t key = 0;
+            uint8_t state = 0;      // 0: empty, 1: not unique, 2: unique
+        };
+        std::vector<Entry> m_entries;
+        size_t m_mask;
+    public:
+        unsigned long n_lookups;
+        unsigned long n_hits;
+    };
+
+    // shared by the attempts of a generation:
+    // counters, the deadline, and the best (fewest clues) uniquely solvable board found so far
+    struct GenerateProgress
+    {
+        std::atomic<unsigned long> n_verdict_lookups{0};
+        std::atomic<unsigned long> n_verdict_hits{0};
+
+        bool has_deadline = false;
+        std::chrono::steady_clock::time_point deadline;
+        bool expired() const { return has_deadline && std::chrono::steady_clock::now() >= deadline; }
+
+        std::mutex best_mutex;
+        Board best_board;
+        std::atomic<unsigned int> best_n_clues{CELL_COUNT + 1};
+        void offer(const Board& board, unsigned int n_clues);
+    };
+
+    // number of filled cells
+    unsigned int count_clues(const Board& board);
+
+    // a single generation attempt, gives up early if stop_flag is set or the deadline passes.
+    // with a thread pool, the candidate removals of each step are tested concurrently
+    std::tuple<bool, Board> try_generate_board(
+        unsigned int n_clues_remain, std::atomic_bool& stop_flag, 
+        util::ThreadPool* pool = nullptr, GenerateProgress* progress = nullptr
+        );
+
+    // returns if the exact clue count is reached, the board and it's clue count.
+    // with a timeout (in seconds, 0 for none), the best board found is returned when the time is up,
+    // i.e. the uniquely solvable board with the fewest clues.
+    // setting the stop_flag from another thread cancels the generation the same way
+    std::tuple<bool, Board, unsigned int> generate_board(
         unsigned int n_clues_remain, 
         unsigned int max_retries = 2048, 
         bool parallel_exec = true,
-        bool verbose = false
+        bool verbose = false,
+        double timeout = 0,
+        std::atomic_bool* stop_flag = nullptr
         );
 } // namespace generate
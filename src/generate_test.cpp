@@ -1,5 +1,7 @@
 #include "generate.h"
+#include "bit_search.h"
 #include <iostream>
+#include <memory>
 
 int main(){
     // Board board;
@@ -14,8 +16,50 @@ int main(){
     //     return 1;
     // }
 
+    Board filled;
+    gen::fill_valid_board(filled, gen::FillStrategy::RANDOM);
+    std::cout << "Random fill is solved: " << (filled.is_solved() ? "PASS" : "FAIL") << std::endl;
+
+    auto search = std::unique_ptr<BitSearch>(new BitSearch());
+    std::cout << "Filled board has one solution: " << (search->count(filled, 2) == 1 ? "PASS" : "FAIL") << std::endl;
+    Board empty;
+    empty.clear(0);
+    std::cout << "Empty board has many solutions: " << (search->count(empty, 10) == 10 ? "PASS" : "FAIL") << std::endl;
+
+    util::ThreadPool pool(4);
+    std::atomic_bool stop_flag(false);
+    auto [spec_generated, spec_board] = gen::try_generate_board(CELL_COUNT / 2, stop_flag, &pool);
+    std::cout << "Speculative removal keeps the board unique: " << 
+        (!spec_generated || search->count(spec_board, 2) == 1 ? "PASS" : "FAIL") << std::endl;
+
+    // anytime generation, an unreachable target returns the best board found in time
+    auto [exact, best_board, best_n_clues] = gen::generate_board(CELL_COUNT / 5, 1e5, true, false, 0.5);
+    std::cout << "Deadline returns the best unique board: " << 
+        (!exact && best_n_clues > CELL_COUNT / 5 && search->count(best_board, 2) == 1 ? "PASS" : "FAIL") << std::endl;
+
+    // a success stops the concurrent attempts without touching the caller's flag
+    std::atomic_bool caller_flag(false);
+    auto [parallel_generated, parallel_board, parallel_n_clues] = gen::generate_board(CELL_COUNT / 2, 64, true, false, 0, &caller_flag);
+    std::cout << "Success leaves the caller's stop flag unset: " << (parallel_generated && !caller_flag ? "PASS" : "FAIL") << std::endl;
+
+    // the verdict cache: the hash follows a removed clue, a slot shared by two keys is a miss, then replaced
+    gen::VerdictCache cache(4);
+    uint64_t key = gen::VerdictCache::hash(filled);
+    Board removed = filled;
+    removed.set(7, 0);
+    bool verdict = false;
+    bool cached = gen::VerdictCache::hash(removed) == (key ^ gen::VerdictCache::zobrist(7));
+    cached = cached && !cache.lookup(key, verdict);
+    cache.store(key, true);
+    cached = cached && cache.lookup(key, verdict) && verdict;
+    uint64_t colliding = key ^ (uint64_t(1) << 40);     // same slot, the low bits are equal
+    cached = cached && !cache.lookup(colliding, verdict);
+    cache.store(colliding, false);
+    cached = cached && cache.lookup(colliding, verdict) && !verdict && !cache.lookup(key, verdict);
+    std::cout << "Verdict cache hits, misses and collisions: " << (cached && cache.n_lookups == 5 && cache.n_hits == 2 ? "PASS" : "FAIL") << std::endl;
+
     unsigned int n_clues_remain = 20;
-    auto [generated, board] = gen::generate_board(n_clues_remain);
+    auto [generated, board, _] = gen::generate_board(n_clues_remain);
     if (!generated){
         std::cout << "Failed to generate a board with " << n_clues_remain << " clues remaining" << std::endl;
         return 1;
@@ -0,0 +1,4 @@
+// This is a generated file, do not edit it directly
+// N: 16
+#include "indexer.h"
+const unsigned int Indexer::grid_lookup [16][16][2] = {{{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 1}, {0, 1}, {0, 1}, {0, 1}, {0, 2}, {0, 2}, {0, 2}, {0, 2}, {0, 3}, {0, 3}, {0, 3}, {0, 3}}, {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 1}, {0, 1}, {0, 1}, {0, 1}, {0, 2}, {0, 2}, {0, 2}, {0, 2}, {0, 3}, {0, 3}, {0, 3}, {0, 3}}, {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 1}, {0, 1}, {0, 1}, {0, 1}, {0, 2}, {0, 2}, {0, 2}, {0, 2}, {0, 3}, {0, 3}, {0, 3}, {0, 3}}, {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 1}, {0, 1}, {0, 1}, {0, 1}, {0, 2}, {0, 2}, {0, 2}, {0, 2}, {0, 3}, {0, 3}, {0, 3}, {0, 3}}, {{1, 0}, {1, 0}, {1, 0}, {1, 0}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 2}, {1, 2}, {1, 2}, {1, 2}, {1, 3}, {1, 3}, {1, 3}, {1, 3}}, {{1, 0}, {1, 0}, {1, 0}, {1, 0}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 2}, {1, 2}, {1, 2}, {1, 2}, {1, 3}, {1, 3}, {1, 3}, {1, 3}}, {{1, 0}, {1, 0}, {1, 0}, {1, 0}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 2}, {1, 2}, {1, 2}, {1, 2}, {1, 3}, {1, 3}, {1, 3}, {1, 3}}, {{1, 0}, {1, 0}, {1, 0}, {1, 0}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 2}, {1, 2}, {1, 2}, {1, 2}, {1, 3}, {1, 3}, {1, 3}, {1, 3}}, {{2, 0}, {2, 0}, {2, 0}, {2, 0}, {2, 1}, {2, 1}, {2, 1}, {2, 1}, {2, 2}, {2, 2}, {2, 2}, {2, 2}, {2, 3}, {2, 3}, {2, 3}, {2, 3}}, {{2, 0}, {2, 0}, {2, 0}, {2, 0}, {2, 1}, {2, 1}, {2, 1}, {2, 1}, {2, 2}, {2, 2}, {2, 2}, {2, 2}, {2, 3}, {2, 3}, {2, 3}, {2, 3}}, {{2, 0}, {2, 0}, {2, 0}, {2, 0}, {2, 1}, {2, 1}, {2, 1}, {2, 1}, {2, 2}, {2, 2}, {2, 2}, {2, 2}, {2, 3}, {2, 3}, {2, 3}, {2, 3}}, {{2, 0}, {2, 0}, {2, 0}, {2, 0}, {2, 1}, {2, 1}, {2, 1}, {2, 1}, {2, 2}, {2, 2}, {2, 2}, {2, 2}, {2, 3}, {2, 3}, {2, 3}, {2, 3}}, {{3, 0}, {3, 0}, {3, 0}, {3, 0}, {3, 1}, {3, 1}, {3, 1}, {3, 1}, {3, 2}, {3, 2}, {3, 2}, {3, 2}, {3, 3}, {3, 3}, {3, 3}, {3, 3}}, {{3, 0}, {3, 0}, {3, 0}, {3, 0}, {3, 1}, {3, 1}, {3, 1}, {3, 1}, {3, 2}, {3, 2}, {3, 2}, {3, 2}, {3, 3}, {3, 3}, {3, 3}, {3, 3}}, {{3, 0}, {3, 0}, {3, 0}, {3, 0}, {3, 1}, {3, 1}, {3, 1}, {3, 1}, {3, 2}, {3, 2}, {3, 2}, {3, 2}, {3, 3}, {3, 3}, {3, 3}, {3, 3}}, {{3, 0}, {3, 0}, {3, 0}, {3, 0}, {3, 1}, {3, 1}, {3, 1}, {3, 1}, {3, 2}, {3, 2}, {3, 2}, {3, 2}, {3, 3}, {3, 3}, {3, 3}, {3, 3}}}; const unsigned int Indexer::offset_coord_lookup [256][2] = {{0, 0}, {0, 1}, {0, 2}, {0, 3}, {0, 4}, {0, 5}, {0, 6}, {0, 7}, {0, 8}, {0, 9}, {0, 10}, {0, 11}, {0, 12}, {0, 13}, {0, 14}, {0, 15}, {1, 0}, {1, 1}, {1, 2}, {1, 3}, {1, 4}, {1, 5}, {1, 6}, {1, 7}, {1, 8}, {1, 9}, {1, 10}, {1, 11}, {1, 12}, {1, 13}, {1, 14}, {1, 15}, {2, 0}, {2, 1}, {2, 2}, {2, 3}, {2, 4}, {2, 5}, {2, 6}, {2, 7}, {2, 8}, {2, 9}, {2, 10}, {2, 11}, {2, 12}, {2, 13}, {2, 14}, {2, 15}, {3, 0}, {3, 1}, {3, 2}, {3, 3}, {3, 4}, {3, 5}, {3, 6}, {3, 7}, {3, 8}, {3, 9}, {3, 10}, {3, 11}, {3, 12}, {3, 13}, {3, 14}, {3, 15}, {4, 0}, {4, 1}, {4, 2}, {4, 3}, {4, 4}, {4, 5}, {4, 6}, {4, 7}, {4, 8}, {4, 9}, {4, 10}, {4, 11}, {4, 12}, {4, 13}, {4, 14}, {4, 15}, {5, 0}, {5, 1}, {5, 2}, {5, 3}, {5, 4}, {5, 5}, {5, 6}, {5, 7}, {5, 8}, {5, 9}, {5, 10}, {5, 11}, {5, 12}, {5, 13}, {5, 14}, {5, 15}, {6, 0}, {6, 1}, {6, 2}, {6, 3}, {6, 4}, {6, 5}, {6, 6}, {6, 7}, {6, 8}, {6, 9}, {6, 10}, {6, 11}, {6, 12}, {6, 13}, {6, 14}, {6, 15}, {7, 0}, {7, 1}, {7, 2}, {7, 3}, {7, 4}, {7, 5}, {7, 6}, {7, 7}, {7, 8}, {7, 9}, {7, 10}, {7, 11}, {7, 12}, {7, 13}, {7, 14}, {7, 15}, {8, 0}, {8, 1}, {8, 2}, {8, 3}, {8, 4}, {8, 5}, {8, 6}, {8, 7}, {8, 8}, {8, 9}, {8, 10}, {8, 11}, {8, 12}, {8, 13}, {8, 14}, {8, 15}, {9, 0}, {9, 1}, {9, 2}, {9, 3}, {9, 4}, {9, 5}, {9, 6}, {9, 7}, {9, 8}, {9, 9}, {9, 10}, {9, 11}, {9, 12}, {9, 13}, {9, 14}, {9, 15}, {10, 0}, {10, 1}, {10, 2}, {10, 3}, {10, 4}, {10, 5}, {10, 6}, {10, 7}, {10, 8}, {10, 9}, {10, 10}, {10, 11}, {10, 12}, {10, 13}, {10, 14}, {10, 15}, {11, 0}, {11, 1}, {11, 2}, {11, 3}, {11, 4}, {11, 5}, {11, 6}, {11, 7}, {11, 8}, {11, 9}, {11, 10}, {11, 11}, {11, 12}, {11, 13}, {11, 14}, {11, 15}, {12, 0}, {12, 1}, {12, 2}, {12, 3}, {12, 4}, {12, 5}, {12, 6}, {12, 7}, {12, 8}, {12, 9}, {12, 10}, {12, 11}, {12, 12}, {12, 13}, {12, 14}, {12, 15}, {13, 0}, {13, 1}, {13, 2}, {13, 3}, {13, 4}, {13, 5}, {13, 6}, {13, 7}, {13, 8}, {13, 9}, {13, 10}, {13, 11}, {13, 12}, {13, 13}, {13, 14}, {13, 15}, {14, 0}, {14, 1}, {14, 2}, {14, 3}, {14, 4}, {14, 5}, {14, 6}, {14, 7}, {14, 8}, {14, 9}, {14, 10}, {14, 11}, {14, 12}, {14, 13}, {14, 14}, {14, 15}, {15, 0}, {15, 1}, {15, 2}, {15, 3}, {15, 4}, {15, 5}, {15, 6}, {15, 7}, {15, 8}, {15, 9}, {15, 10}, {15, 11}, {15, 12}, {15, 13}, {15, 14}, {15, 15}}; const unsigned int Indexer::coord_offset_lookup [16][16] = {{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}, {16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31}, {32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47}, {48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63}, {64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79}, {80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95}, {96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111}, {112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127}, {128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143}, {144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159}, {160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175}, {176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191}, {192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207}, {208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223}, {224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239}, {240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255}}; const unsigned int Indexer::row_index [16][16] = {{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}, {16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31}, {32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47}, {48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63}, {64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79}, {80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95}, {96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111}, {112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127}, {128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143}, {144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159}, {160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175}, {176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191}, {192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207}, {208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223}, {224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239}, {240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255}}; const unsigned int Indexer::col_index [16][16] = {{0, 16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176, 192, 208, 224, 240}, {1, 17, 33, 49, 65, 81, 97, 113, 129, 145, 161, 177, 193, 209, 225, 241}, {2, 18, 34, 50, 66, 82, 98, 114, 130, 146, 162, 178, 194, 210, 226, 242}, {3, 19, 35, 51, 67, 83, 99, 115, 131, 147, 163, 179, 195, 211, 227, 243}, {4, 20, 36, 52, 68, 84, 100, 116, 132, 148, 164, 180, 196, 212, 228, 244}, {5, 21, 37, 53, 69, 85, 101, 117, 133, 149, 165, 181, 197, 213, 229, 245}, {6, 22, 38, 54, 70, 86, 102, 118, 134, 150, 166, 182, 198, 214, 230, 246}, {7, 23, 39, 55, 71, 87, 103, 119, 135, 151, 167, 183, 199, 215, 231, 247}, {8, 24, 40, 56, 72, 88, 104, 120, 136, 152, 168, 184, 200, 216, 232, 248}, {9, 25, 41, 57, 73, 89, 105, 121, 137, 153, 169, 185, 201, 217, 233, 249}, {10, 26, 42, 58, 74, 90, 106, 122, 138, 154, 170, 186, 202, 218, 234, 250}, {11, 27, 43, 59, 75, 91, 107, 123, 139, 155, 171, 187, 203, 219, 235, 251}, {12, 28, 44, 60, 76, 92, 108, 124, 140, 156, 172, 188, 204, 220, 236, 252}, {13, 29, 45, 61, 77, 93, 109, 125, 141, 157, 173, 189, 205, 221, 237, 253}, {14, 30, 46, 62, 78, 94, 110, 126, 142, 158, 174, 190, 206, 222, 238, 254}, {15, 31, 47, 63, 79, 95, 111, 127, 143, 159, 175, 191, 207, 223, 239, 255}}; const unsigned int Indexer::grid_index [4][4][16] = {{{0, 1, 2, 3, 16, 17, 18, 19, 32, 33, 34, 35, 48, 49, 50, 51}, {4, 5, 6, 7, 20, 21, 22, 23, 36, 37, 38, 39, 52, 53, 54, 55}, {8, 9, 10, 11, 24, 25, 26, 27, 40, 41, 42, 43, 56, 57, 58, 59}, {12, 13, 14, 15, 28, 29, 30, 31, 44, 45, 46, 47, 60, 61, 62, 63}}, {{64, 65, 66, 67, 80, 81, 82, 83, 96, 97, 98, 99, 112, 113, 114, 115}, {68, 69, 70, 71, 84, 85, 86, 87, 100, 101, 102, 103, 116, 117, 118, 119}, {72, 73, 74, 75, 88, 89, 90, 91, 104, 105, 106, 107, 120, 121, 122, 123}, {76, 77, 78, 79, 92, 93, 94, 95, 108, 109, 110, 111, 124, 125, 126, 127}}, {{128, 129, 130, 131, 144, 145, 146, 147, 160, 161, 162, 163, 176, 177, 178, 179}, {132, 133, 134, 135, 148, 149, 150, 151, 164, 165, 166, 167, 180, 181, 182, 183}, {136, 137, 138, 139, 152, 153, 154, 155, 168, 169, 170, 171, 184, 185, 186, 187}, {140, 141, 142, 143, 156, 157, 158, 159, 172, 173, 174, 175, 188, 189, 190, 191}}, {{192, 193, 194, 195, 208, 209, 210, 211, 224, 225, 226, 227, 240, 241, 242, 243}, {196, 197, 198, 199, 212, 213, 214, 215, 228, 229, 230, 231, 244, 245, 246, 247}, {200, 201, 202, 203, 216, 217, 218, 219, 232, 233, 234, 235, 248, 249, 250, 251}, {204, 205, 206, 207, 220, 221, 222, 223, 236, 237, 238, 239, 252, 253, 254, 255}}}; const unsigned int Indexer::grid_coord_index [16][16][16] = {{{0, 1, 2, 3, 16, 17, 18, 19, 32, 33, 34, 35, 48, 49, 50, 51}, {0, 1, 2, 3, 16, 17, 18, 19, 32, 33, 34, 35, 48, 49, 50, 51}, {0, 1, 2, 3, 16, 17, 18, 19, 32, 33, 34, 35, 48, 49, 50, 51}, {0, 1, 2, 3, 16, 17, 18, 19, 32, 33, 34, 35, 48, 49, 50, 51}, {4, 5, 6, 7, 20, 21, 22, 23, 36, 37, 38, 39, 52, 53, 54, 55}, {4, 5, 6, 7, 20, 21, 22, 23, 36, 37, 38, 39, 52, 53, 54, 55}, {4, 5, 6, 7, 20, 21, 22, 23, 36, 37, 38, 39, 52, 53, 54, 55}, {4, 5, 6, 7, 20, 21, 22, 23, 36, 37, 38, 39, 52, 53, 54, 55}, {8, 9, 10, 11, 24, 25, 26, 27, 40, 41, 42, 43, 56, 57, 58, 59}, {8, 9, 10, 11, 24, 25, 26, 27, 40, 41, 42, 43, 56, 57, 58, 59}, {8, 9, 10, 11, 24, 25, 26, 27, 40, 41, 42, 43, 56, 57, 58, 59}, {8, 9, 10, 11, 24, 25, 26, 27, 40, 41, 42, 43, 56, 57, 58, 59}, {12, 13, 14, 15, 28, 29, 30, 31, 44, 45, 46, 47, 60, 61, 62, 63}, {12, 13, 14, 15, 28, 29, 30, 31, 44, 45, 46, 47, 60, 61, 62, 63}, {12, 13, 14, 15, 28, 29, 30, 31, 44, 45, 46, 47, 60, 61, 62, 63}, {12, 13, 14, 15, 28, 29, 30, 31, 44, 45, 46, 47, 60, 61, 62, 63}}, {{0, 1, 2, 3, 16, 17, 18, 19, 32, 33, 34, 35, 48, 49, 50, 51}, {0, 1, 2, 3, 16, 17, 18, 19, 32, 33, 34, 35, 48, 49, 50, 51}, {0, 1, 2, 3, 16, 17, 18, 19, 32, 33, 34, 35, 48, 49, 50, 51}, {0, 1, 2, 3, 16, 17, 18, 19, 32, 33, 34, 35, 48, 49, 50, 51}, {4, 5, 6, 7, 20, 21, 22, 23, 36, 37, 38, 39, 52, 53, 54, 55}, {4, 5, 6, 7, 20, 21, 22, 23, 36, 37, 38, 39, 52, 53, 54, 55}, {4, 5, 6, 7, 20, 21, 22, 23, 36, 37, 38, 39, 52, 53, 54, 55}, {4, 5, 6, 7, 20, 21, 22, 23, 36, 37, 38, 39, 52, 53, 54, 55}, {8, 9, 10, 11, 24, 25, 26, 27, 40, 41, 42, 43, 56, 57, 58, 59}, {8, 9, 10, 11, 24, 25, 26, 27, 40, 41, 42, 43, 56, 57, 58, 59}, {8, 9, 10, 11, 24, 25, 26, 27, 40, 41, 42, 43, 56, 57, 58, 59}, {8, 9, 10, 11, 24, 25, 26, 27, 40, 41, 42, 43, 56, 57, 58, 59}, {12, 13, 14, 15, 28, 29, 30, 31, 44, 45, 46, 47, 60, 61, 62, 63}, {12, 13, 14, 15, 28, 29, 30, 31, 44, 45, 46, 47, 60, 61, 62, 63}, {12, 13, 14, 15, 28, 29, 30, 31, 44, 45, 46, 47, 60, 61, 62, 63}, {12, 13, 14, 15, 28, 29, 30, 31, 44, 45, 46, 47, 60, 61, 62, 63}}, {{0, 1, 2, 3, 16, 17, 18, 19, 32, 33, 34, 35, 48, 49, 50, 51}, {0, 1, 2, 3, 16, 17, 18, 19, 32, 33, 34, 35, 48, 49, 50, 51}, {0, 1, 2, 3, 16, 17, 18, 19, 32, 33, 34, 35, 48, 49, 50, 51}, {0, 1, 2, 3, 16, 17, 18, 19, 32, 33, 34, 35, 48, 49, 50, 51}, {4, 5, 6, 7, 20, 21, 22, 23, 36, 37, 38, 39, 52, 53, 54, 55}, {4, 5, 6, 7, 20, 21, 22, 23, 36, 37, 38, 39, 52, 53, 54, 55}, {4, 5, 6, 7, 20, 21, 22, 23, 36, 37, 38, 39, 52, 53, 54, 55}, {4, 5, 6, 7, 20, 21, 22, 23, 36, 37, 38, 39, 52, 53, 54, 55}, {8, 9, 10, 11, 24, 25, 26, 27, 40, 41, 42, 43, 56, 57, 58, 59}, {8, 9, 10, 11, 24, 25, 26, 27, 40, 41, 42, 43, 56, 57, 58, 59}, {8, 9, 10, 11, 24, 25, 26, 27, 40, 41, 42, 43, 56, 57, 58, 59}, {8, 9, 10, 11, 24, 25, 26, 27, 40, 41, 42, 43, 56, 57, 58, 59}, {12, 13, 14, 15, 28, 29, 30, 31, 44, 45, 46, 47, 60, 61, 62, 63}, {12, 13, 14, 15, 28, 29, 30, 31, 44, 45, 46, 47, 60, 61, 62, 63}, {12, 13, 14, 15, 28, 29, 30, 31, 44, 45, 46, 47, 60, 61, 62, 63}, {12, 13, 14, 15, 28, 29, 30, 31, 44, 45, 46, 47, 60, 61, 62, 63}}, {{0, 1, 2, 3, 16, 17, 18, 19, 32, 33, 34, 35, 48, 49, 50, 51}, {0, 1, 2, 3, 16, 17, 18, 19, 32, 33, 34, 35, 48, 49, 50, 51}, {0, 1, 2, 3, 16, 17, 18, 19, 32, 33, 34, 35, 48, 49, 50, 51}, {0, 1, 2, 3, 16, 17, 18, 19, 32, 33, 34, 35, 48, 49, 50, 51}, {4, 5, 6, 7, 20, 21, 22, 23, 36, 37, 38, 39, 52, 53, 54, 55}, {4, 5, 6, 7, 20, 21, 22, 23, 36, 37, 38, 39, 52, 53, 54, 55}, {4, 5, 6, 7, 20, 21, 22, 23, 36, 37, 38, 39, 52, 53, 54, 55}, {4, 5, 6, 7, 20, 21, 22, 23, 36, 37, 38, 39, 52, 53, 54, 55}, {8, 9, 10, 11, 24, 25, 26, 27, 40, 41, 42, 43, 56, 57, 58, 59}, {8, 9, 10, 11, 24, 25, 26, 27, 40, 41, 42, 43, 56, 57, 58, 59}, {8, 9, 10, 11, 24, 25, 26, 27, 40, 41, 42, 43, 56, 57, 58, 59}, {8, 9, 10, 11, 24, 25, 26, 27, 40, 41, 42, 43, 56, 57, 58, 59}, {12, 13, 14, 15, 28, 29, 30, 31, 44, 45, 46, 47, 60, 61, 62, 63}, {12, 13, 14, 15, 28, 29, 30, 31, 44, 45, 46, 47, 60, 61, 62, 63}, {12, 13, 14, 15, 28, 29, 30, 31, 44, 45, 46, 47, 60, 61, 62, 63}, {12, 13, 14, 15, 28, 29, 30, 31, 44, 45, 46, 47, 60, 61, 62, 63}}, {{64, 65, 66, 67, 80, 81, 82, 83, 96, 97, 98, 99, 112, 113, 114, 115}, {64, 65, 66, 67, 80, 81, 82, 83, 96, 97, 98, 99, 112, 113, 114, 115}, {64, 65, 66, 67, 80, 81, 82, 83, 96, 97, 98, 99, 112, 113, 114, 115}, {64, 65, 66, 67, 80, 81, 82, 83, 96, 97, 98, 99, 112, 113, 114, 115}, {68, 69, 70, 71, 84, 85, 86, 87, 100, 101, 102, 103, 116, 117, 118, 119}, {68, 69, 70, 71, 84, 85, 86, 87, 100, 101, 102, 103, 116, 117, 118, 119}, {68, 69, 70, 71, 84, 85, 86, 87, 100, 101, 102, 103, 116, 117, 118, 119}, {68, 69, 70, 71, 84, 85, 86, 87, 100, 101, 102, 103, 116, 117, 118, 119}, {72, 73, 74, 75, 88, 89, 90, 91, 104, 105, 106, 107, 120, 121, 122, 123}, {72, 73, 74, 75, 88, 89, 90, 91, 104, 105, 106, 107, 120, 121, 122, 123}, {72, 73, 74, 75, 88, 89, 90, 91, 104, 105, 106, 107, 120, 121, 122, 123}, {72, 73, 74, 75, 88, 89, 90, 91, 104, 105, 106, 107, 120, 121, 122, 123}, {76, 77, 78, 79, 92, 93, 94, 95, 108, 109, 110, 111, 124, 125, 126, 127}, {76, 77, 78, 79, 92, 93, 94, 95, 108, 109, 110, 111, 124, 125, 126, 127}, {76, 77, 78, 79, 92, 93, 94, 95, 108, 109, 110, 111, 124, 125, 126, 127}, {76, 77, 78, 79, 92, 93, 94, 95, 108, 109, 110, 111, 124, 125, 126, 127}}, {{64, 65, 66, 67, 80, 81, 82, 83, 96, 97, 98, 99, 112, 113, 114, 115}, {64, 65, 66, 67, 80, 81, 82, 83, 96, 97, 98, 99, 112, 113, 114, 115}, {64, 65, 66, 67, 80, 81, 82, 83, 96, 97, 98, 99, 112, 113, 114, 115}, {64, 65, 66, 67, 80, 81, 82, 83, 96, 97, 98, 99, 112, 113, 114, 115}, {68, 69, 70, 71, 84, 85, 86, 87, 100, 101, 102, 103, 116, 117, 118, 119}, {68, 69, 70, 71, 84, 85, 86, 87, 100, 101, 102, 103, 116, 117, 118, 119}, {68, 69, 70, 71, 84, 85, 86, 87, 100, 101, 102, 103, 116, 117, 118, 119}, {68, 69, 70, 71, 84, 85, 86, 87, 100, 101, 102, 103, 116, 117, 118, 119}, {72, 73, 74, 75, 88, 89, 90, 91, 104, 105, 106, 107, 120, 121, 122, 123}, {72, 73, 74, 75, 88, 89, 90, 91, 104, 105, 106, 107, 120, 121, 122, 123}, {72, 73, 74, 75, 88, 89, 90, 91, 104, 105, 106, 107, 120, 121, 122, 123}, {72, 73, 74, 75, 88, 89, 90, 91, 104, 105, 106, 107, 120, 121, 122, 123}, {76, 77, 78, 79, 92, 93, 94, 95, 108, 109, 110, 111, 124, 125, 126, 127}, {76, 77, 78, 79, 92, 93, 94, 95, 108, 109, 110, 111, 124, 125, 126, 127}, {76, 77, 78, 79, 92, 93, 94, 95, 108, 109, 110, 111, 124, 125, 126, 127}, {76, 77, 78, 79, 92, 93, 94, 95, 108, 109, 110, 111, 124, 125, 126, 127}}, {{64, 65, 66, 67, 80, 81, 82, 83, 96, 97, 98, 99, 112, 113, 114, 115}, {64, 65, 66, 67, 80, 81, 82, 83, 96, 97, 98, 99, 112, 113, 114, 115}, {64, 65, 66, 67, 80, 81, 82, 83, 96, 97, 98, 99, 112, 113, 114, 115}, {64, 65, 66, 67, 80, 81, 82, 83, 96, 97, 98, 99, 112, 113, 114, 115}, {68, 69, 70, 71, 84, 85, 86, 87, 100, 101, 102, 103, 116, 117, 118, 119}, {68, 69, 70, 71, 84, 85, 86, 87, 100, 101, 102, 103, 116, 117, 118, 119}, {68, 69, 70, 71, 84, 85, 86, 87, 100, 101, 102, 103, 116, 117, 118, 119}, {68, 69, 70, 71, 84, 85, 86, 87, 100, 101, 102, 103, 116, 117, 118, 119}, {72, 73, 74, 75, 88, 89, 90, 91, 104, 105, 106, 107, 120, 121, 122, 123}, {72, 73, 74, 75, 88, 89, 90, 91, 104, 105, 106, 107, 120, 121, 122, 123}, {72, 73, 74, 75, 88, 89, 90, 91, 104, 105, 106, 107, 120, 121, 122, 123}, {72, 73, 74, 75, 88, 89, 90, 91, 104, 105, 106, 107, 120, 121, 122, 123}, {76, 77, 78, 79, 92, 93, 94, 95, 108, 109, 110, 111, 124, 125, 126, 127}, {76, 77, 78, 79, 92, 93, 94, 95, 108, 109, 110, 111, 124, 125, 126, 127}, {76, 77, 78, 79, 92, 93, 94, 95, 108, 109, 110, 111, 124, 125, 126, 127}, {76, 77, 78, 79, 92, 93, 94, 95, 108, 109, 110, 111, 124, 125, 126, 127}}, {{64, 65, 66, 67, 80, 81, 82, 83, 96, 97, 98, 99, 112, 113, 114, 115}, {64, 65, 66, 67, 80, 81, 82, 83, 96, 97, 98, 99, 112, 113, 114, 115}, {64, 65, 66, 67, 80, 81, 82, 83, 96, 97, 98, 99, 112, 113, 114, 115}, {64, 65, 66, 67, 80, 81, 82, 83, 96, 97, 98, 99, 112, 113, 114, 115}, {68, 69, 70, 71, 84, 85, 86, 87, 100, 101, 102, 103, 116, 117, 118, 119}, {68, 69, 70, 71, 84, 85, 86, 87, 100, 101, 102, 103, 116, 117, 118, 119}, {68, 69, 70, 71, 84, 85, 86, 87, 100, 101, 102, 103, 116, 117, 118, 119}, {68, 69, 70, 71, 84, 85, 86, 87, 100, 101, 102, 103, 116, 117, 118, 119}, {72, 73, 74, 75, 88, 89, 90, 91, 104, 105, 106, 107, 120, 121, 122, 123}, {72, 73, 74, 75, 88, 89, 90, 91, 104, 105, 106, 107, 120, 121, 122, 123}, {72, 73, 74, 75, 88, 89, 90, 91, 104, 105, 106, 107, 120, 121, 122, 123}, {72, 73, 74, 75, 88, 89, 90, 91, 104, 105, 106, 107, 120, 121, 122, 123}, {76, 77, 78, 79, 92, 93, 94, 95, 108, 109, 110, 111, 124, 125, 126, 127}, {76, 77, 78, 79, 92, 93, 94, 95, 108, 109, 110, 111, 124, 125, 126, 127}, {76, 77, 78, 79, 92, 93, 94, 95, 108, 109, 110, 111, 124, 125, 126, 127}, {76, 77, 78, 79, 92, 93, 94, 95, 108, 109, 110, 111, 124, 125, 126, 127}}, {{128, 129, 130, 131, 144, 145, 146, 147, 160, 161, 162, 163, 176, 177, 178, 179}, {128, 129, 130, 131, 144, 145, 146, 147, 160, 161, 162, 163, 176, 177, 178, 179}, {128, 129, 130, 131, 144, 145, 146, 147, 160, 161, 162, 163, 176, 177, 178, 179}, {128, 129, 130, 131, 144, 145, 146, 147, 160, 161, 162, 163, 176, 177, 178, 179}, {132, 133, 134, 135, 148, 149, 150, 151, 164, 165, 166, 167, 180, 181, 182, 183}, {132, 133, 134, 135, 148, 149, 150, 151, 164, 165, 166, 167, 180, 181, 182, 183}, {132, 133, 134, 135, 148, 149, 150, 151, 164, 165, 166, 167, 180, 181, 182, 183}, {132, 133, 134, 135, 148, 149, 150, 151, 164, 165, 166, 167, 180, 181, 182, 183}, {136, 137, 138, 139, 152, 153, 154, 155, 168, 169, 170, 171, 184, 185, 186, 187}, {136, 137, 138, 139, 152, 153, 154, 155, 168, 169, 170, 171, 184, 185, 186, 187}, {136, 137, 138, 139, 152, 153, 154, 155, 168, 169, 170, 171, 184, 185, 186, 187}, {136, 137, 138, 139, 152, 153, 154, 155, 168, 169, 170, 171, 184, 185, 186, 187}, {140, 141, 142, 143, 156, 157, 158, 159, 172, 173, 174, 175, 188, 189, 190, 191}, {140, 141, 142, 143, 156, 157, 158, 159, 172, 173, 174, 175, 188, 189, 190, 191}, {140, 141, 142, 143, 156, 157, 158, 159, 172, 173, 174, 175, 188, 189, 190, 191}, {140, 141, 142, 143, 156, 157, 158, 159, 172, 173, 174, 175, 188, 189, 190, 191}}, {{128, 129, 130, 131, 144, 145, 146, 147, 160, 161, 162, 163, 176, 177, 178, 179}, {128, 129, 130, 131, 144, 145, 146, 147, 160, 161, 162, 163, 176, 177, 178, 179}, {128, 129, 130, 131, 144, 145, 146, 147, 160, 161, 162, 163, 176, 177, 178, 179}, {128, 129, 130, 131, 144, 145, 146, 147, 160, 161, 162, 163, 176, 177, 178, 179}, {132, 133, 134, 135, 148, 149, 150, 151, 164, 165, 166, 167, 180, 181, 182, 183}, {132, 133, 134, 135, 148, 149, 150, 151, 164, 165, 166, 167, 180, 181, 182, 183}, {132, 133, 134, 135, 148, 149, 150, 151, 164, 165, 166, 167, 180, 181, 182, 183}, {132, 133, 134, 135, 148, 149, 150, 151, 164, 165, 166, 167, 180, 181, 182, 183}, {136, 137, 138, 139, 152, 153, 154, 155, 168, 169, 170, 171, 184, 185, 186, 187}, {136, 137, 138, 139, 152, 153, 154, 155, 168, 169, 170, 171, 184, 185, 186, 187}, {136, 137, 138, 139, 152, 153, 154, 155, 168, 169, 170, 171, 184, 185, 186, 187}, {136, 137, 138, 139, 152, 153, 154, 155, 168, 169, 170, 171, 184, 185, 186, 187}, {140, 141, 142, 143, 156, 157, 158, 159, 172, 173, 174, 175, 188, 189, 190, 191}, {140, 141, 142, 143, 156, 157, 158, 159, 172, 173, 174, 175, 188, 189, 190, 191}, {140, 141, 142, 143, 156, 157, 158, 159, 172, 173, 174, 175, 188, 189, 190, 191}, {140, 141, 142, 143, 156, 157, 158, 159, 172, 173, 174, 175, 188, 189, 190, 191}}, {{128, 129, 130, 131, 144, 145, 146, 147, 160, 161, 162, 163, 176, 177, 178, 179}, {128, 129, 130, 131, 144, 145, 146, 147, 160, 161, 162, 163, 176, 177, 178, 179}, {128, 129, 130, 131, 144, 145, 146, 147, 160, 161, 162, 163, 176, 177, 178, 179}, {128, 129, 130, 131, 144, 145, 146, 147, 160, 161, 162, 163, 176, 177, 178, 179}, {132, 133, 134, 135, 148, 149, 150, 151, 164, 165, 166, 167, 180, 181, 182, 183}, {132, 133, 134, 135, 148, 149, 150, 151, 164, 165, 166, 167, 180, 181, 182, 183}, {132, 133, 134, 135, 148, 149, 150, 151, 164, 165, 166, 167, 180, 181, 182, 183}, {132, 133, 134, 135, 148, 149, 150, 151, 164, 165, 166, 167, 180, 181, 182, 183}, {136, 137, 138, 139, 152, 153, 154, 155, 168, 169, 170, 171, 184, 185, 186, 187}, {136, 137, 138, 139, 152, 153, 154, 155, 168, 169, 170, 171, 184, 185, 186, 187}, {136, 137, 138, 139, 152, 153, 154, 155, 168, 169, 170, 171, 184, 185, 186, 187}, {136, 137, 138, 139, 152, 153, 154, 155, 168, 169, 170, 171, 184, 185, 186, 187}, {140, 141, 142, 143, 156, 157, 158, 159, 172, 173, 174, 175, 188, 189, 190, 191}, {140, 141, 142, 143, 156, 157, 158, 159, 172, 173, 174, 175, 188, 189, 190, 191}, {140, 141, 142, 143, 156, 157, 158, 159, 172, 173, 174, 175, 188, 189, 190, 191}, {140, 141, 142, 143, 156, 157, 158, 159, 172, 173, 174, 175, 188, 189, 190, 191}}, {{128, 129, 130, 131, 144, 145, 146, 147, 160, 161, 162, 163, 176, 177, 178, 179}, {128, 129, 130, 131, 144, 145, 146, 147, 160, 161, 162, 163, 176, 177, 178, 179}, {128, 129, 130, 131, 144, 145, 146, 147, 160, 161, 162, 163, 176, 177, 178, 179}, {128, 129, 130, 131, 144, 145, 146, 147, 160, 161, 162, 163, 176, 177, 178, 179}, {132, 133, 134, 135, 148, 149, 150, 151, 164, 165, 166, 167, 180, 181, 182, 183}, {132, 133, 134, 135, 148, 149, 150, 151, 164, 165, 166, 167, 180, 181, 182, 183}, {132, 133, 134, 135, 148, 149, 150, 151, 164, 165, 166, 167, 180, 181, 182, 183}, {132, 133, 134, 135, 148, 149, 150, 151, 164, 165, 166, 167, 180, 181, 182, 183}, {136, 137, 138, 139, 152, 153, 154, 155, 168, 169, 170, 171, 184, 185, 186, 187}, {136, 137, 138, 139, 152, 153, 154, 155, 168, 169, 170, 171, 184, 185, 186, 187}, {136, 137, 138, 139, 152, 153, 154, 155, 168, 169, 170, 171, 184, 185, 186, 187}, {136, 137, 138, 139, 152, 153, 154, 155, 168, 169, 170, 171, 184, 185, 186, 187}, {140, 141, 142, 143, 156, 157, 158, 159, 172, 173, 174, 175, 188, 189, 190, 191}, {140, 141, 142, 143, 156, 157, 158, 159, 172, 173, 174, 175, 188, 189, 190, 191}, {140, 141, 142, 143, 156, 157, 158, 159, 172, 173, 174, 175, 188, 189, 190, 191}, {140, 141, 142, 143, 156, 157, 158, 159, 172, 173, 174, 175, 188, 189, 190, 191}}, {{192, 193, 194, 195, 208, 209, 210, 211, 224, 225, 226, 227, 240, 241, 242, 243}, {192, 193, 194, 195, 208, 209, 210, 211, 224, 225, 226, 227, 240, 241, 242, 243}, {192, 193, 194, 195, 208, 209, 210, 211, 224, 225, 226, 227, 240, 241, 242, 243}, {192, 193, 194, 195, 208, 209, 210, 211, 224, 225, 226, 227, 240, 241, 242, 243}, {196, 197, 198, 199, 212, 213, 214, 215, 228, 229, 230, 231, 244, 245, 246, 247}, {196, 197, 198, 199, 212, 213, 214, 215, 228, 229, 230, 231, 244, 245, 246, 247}, {196, 197, 198, 199, 212, 213, 214, 215, 228, 229, 230, 231, 244, 245, 246, 247}, {196, 197, 198, 199, 212, 213, 214, 215, 228, 229, 230, 231, 244, 245, 246, 247}, {200, 201, 202, 203, 216, 217, 218, 219, 232, 233, 234, 235, 248, 249, 250, 251}, {200, 201, 202, 203, 216, 217, 218, 219, 232, 233, 234, 235, 248, 249, 250, 251}, {200, 201, 202, 203, 216, 217, 218, 219, 232, 233, 234, 235, 248, 249, 250, 251}, {200, 201, 202, 203, 216, 217, 218, 219, 232, 233, 234, 235, 248, 249, 250, 251}, {204, 205, 206, 207, 220, 221, 222, 223, 236, 237, 238, 239, 252, 253, 254, 255}, {204, 205, 206, 207, 220, 221, 222, 223, 236, 237, 238, 239, 252, 253, 254, 255}, {204, 205, 206, 207, 220, 221, 222, 223, 236, 237, 238, 239, 252, 253, 254, 255}, {204, 205, 206, 207, 220, 221, 222, 223, 236, 237, 238, 239, 252, 253, 254, 255}}, {{192, 193, 194, 195, 208, 209, 210, 211, 224, 225, 226, 227, 240, 241, 242, 243}, {192, 193, 194, 195, 208, 209, 210, 211, 224, 225, 226, 227, 240, 241, 242, 243}, {192, 193, 194, 195, 208, 209, 210, 211, 224, 225, 226, 227, 240, 241, 242, 243}, {192, 193, 194, 195, 208, 209, 210, 211, 224, 225, 226, 227, 240, 241, 242, 243}, {196, 197, 198, 199, 212, 213, 214, 215, 228, 229, 230, 231, 244, 245, 246, 247}, {196, 197, 198, 199, 212, 213, 214, 215, 228, 229, 230, 231, 244, 245, 246, 247}, {196, 197, 198, 199, 212, 213, 214, 215, 228, 229, 230, 231, 244, 245, 246, 247}, {196, 197, 198, 199, 212, 213, 214, 215, 228, 229, 230, 231, 244, 245, 246, 247}, {200, 201, 202, 203, 216, 217, 218, 219, 232, 233, 234, 235, 248, 249, 250, 251}, {200, 201, 202, 203, 216, 217, 218, 219, 232, 233, 234, 235, 248, 249, 250, 251}, {200, 201, 202, 203, 216, 217, 218, 219, 232, 233, 234, 235, 248, 249, 250, 251}, {200, 201, 202, 203, 216, 217, 218, 219, 232, 233, 234, 235, 248, 249, 250, 251}, {204, 205, 206, 207, 220, 221, 222, 223, 236, 237, 238, 239, 252, 253, 254, 255}, {204, 205, 206, 207, 220, 221, 222, 223, 236, 237, 238, 239, 252, 253, 254, 255}, {204, 205, 206, 207, 220, 221, 222, 223, 236, 237, 238, 239, 252, 253, 254, 255}, {204, 205, 206, 207, 220, 221, 222, 223, 236, 237, 238, 239, 252, 253, 254, 255}}, {{192, 193, 194, 195, 208, 209, 210, 211, 224, 225, 226, 227, 240, 241, 242, 243}, {192, 193, 194, 195, 208, 209, 210, 211, 224, 225, 226, 227, 240, 241, 242, 243}, {192, 193, 194, 195, 208, 209, 210, 211, 224, 225, 226, 227, 240, 241, 242, 243}, {192, 193, 194, 195, 208, 209, 210, 211, 224, 225, 226, 227, 240, 241, 242, 243}, {196, 197, 198, 199, 212, 213, 214, 215, 228, 229, 230, 231, 244, 245, 246, 247}, {196, 197, 198, 199, 212, 213, 214, 215, 228, 229, 230, 231, 244, 245, 246, 247}, {196, 197, 198, 199, 212, 213, 214, 215, 228, 229, 230, 231, 244, 245, 246, 247}, {196, 197, 198, 199, 212, 213, 214, 215, 228, 229, 230, 231, 244, 245, 246, 247}, {200, 201, 202, 203, 216, 217, 218, 219, 232, 233, 234, 235, 248, 249, 250, 251}, {200, 201, 202, 203, 216, 217, 218, 219, 232, 233, 234, 235, 248, 249, 250, 251}, {200, 201, 202, 203, 216, 217, 218, 219, 232, 233, 234, 235, 248, 249, 250, 251}, {200, 201, 202, 203, 216, 217, 218, 219, 232, 233, 234, 235, 248, 249, 250, 251}, {204, 205, 206, 207, 220, 221, 222, 223, 236, 237, 238, 239, 252, 253, 254, 255}, {204, 205, 206, 207, 220, 221, 222, 223, 236, 237, 238, 239, 252, 253, 254, 255}, {204, 205, 206, 207, 220, 221, 222, 223, 236, 237, 238, 239, 252, 253, 254, 255}, {204, 205, 206, 207, 220, 221, 222, 223, 236, 237, 238, 239, 252, 253, 254, 255}}, {{192, 193, 194, 195, 208, 209, 210, 211, 224, 225, 226, 227, 240, 241, 242, 243}, {192, 193, 194, 195, 208, 209, 210, 211, 224, 225, 226, 227, 240, 241, 242, 243}, {192, 193, 194, 195, 208, 209, 210, 211, 224, 225, 226, 227, 240, 241, 242, 243}, {192, 193, 194, 195, 208, 209, 210, 211, 224, 225, 226, 227, 240, 241, 242, 243}, {196, 197, 198, 199, 212, 213, 214, 215, 228, 229, 230, 231, 244, 245, 246, 247}, {196, 197, 198, 199, 212, 213, 214, 215, 228, 229, 230, 231, 244, 245, 246, 247}, {196, 197, 198, 199, 212, 213, 214, 215, 228, 229, 230, 231, 244, 245, 246, 247}, {196, 197, 198, 199, 212, 213, 214, 215, 228, 229, 230, 231, 244, 245, 246, 247}, {200, 201, 202, 203, 216, 217, 218, 219, 232, 233, 234, 235, 248, 249, 250, 251}, {200, 201, 202, 203, 216, 217, 218, 219, 232, 233, 234, 235, 248, 249, 250, 251}, {200, 201, 202, 203, 216, 217, 218, 219, 232, 233, 234, 235, 248, 249, 250, 251}, {200, 201, 202, 203, 216, 217, 218, 219, 232, 233, 234, 235, 248, 249, 250, 251}, {204, 205, 206, 207, 220, 221, 222, 223, 236, 237, 238, 239, 252, 253, 254, 255}, {204, 205, 206, 207, 220, 221, 222, 223, 236, 237, 238, 239, 252, 253, 254, 255}, {204, 205, 206, 207, 220, 221, 222, 223, 236, 237, 238, 239, 252, 253, 254, 255}, {204, 205, 206, 207, 220, 221, 222, 223, 236, 237, 238, 239, 252, 253, 254, 255}}}; const unsigned int Indexer::neighbor_index [16][16][39] = {{{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176, 192, 208, 224, 240, 17, 18, 19, 33, 34, 35, 49, 50, 51}, {0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 17, 33, 49, 65, 81, 97, 113, 129, 145, 161, 177, 193, 209, 225, 241, 16, 18, 19, 32, 34, 35, 48, 50, 51}, {0, 1, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 18, 34, 50, 66, 82, 98, 114, 130, 146, 162, 178, 194, 210, 226, 242, 16, 17, 19, 32, 33, 35, 48, 49, 51}, {0, 1, 2, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 19, 35, 51, 67, 83, 99, 115, 131, 147, 163, 179, 195, 211, 227, 243, 16, 17, 18, 32, 33, 34, 48, 49, 50}, {0, 1, 2, 3, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 20, 36, 52, 68, 84, 100, 116, 132, 148, 164, 180, 196, 212, 228, 244, 21, 22, 23, 37, 38, 39, 53, 54, 55}, {0, 1, 2, 3, 4, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 21, 37, 53, 69, 85, 101, 117, 133, 149, 165, 181, 197, 213, 229, 245, 20, 22, 23, 36, 38, 39, 52, 54, 55}, {0, 1, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 13, 14, 15, 22, 38, 54, 70, 86, 102, 118, 134, 150, 166, 182, 198, 214, 230, 246, 20, 21, 23, 36, 37, 39, 52, 53, 55}, {0, 1, 2, 3, 4, 5, 6, 8, 9, 10, 11, 12, 13, 14, 15, 23, 39, 55, 71, 87, 103, 119, 135, 151, 167, 183, 199, 215, 231, 247, 20, 21, 22, 36, 37, 38, 52, 53, 54}, {0, 1, 2, 3, 4, 5, 6, 7, 9, 10, 11, 12, 13, 14, 15, 24, 40, 56, 72, 88, 104, 120, 136, 152, 168, 184, 200, 216, 232, 248, 25, 26, 27, 41, 42, 43, 57, 58, 59}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 10, 11, 12, 13, 14, 15, 25, 41, 57, 73, 89, 105, 121, 137, 153, 169, 185, 201, 217, 233, 249, 24, 26, 27, 40, 42, 43, 56, 58, 59}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 11, 12, 13, 14, 15, 26, 42, 58, 74, 90, 106, 122, 138, 154, 170, 186, 202, 218, 234, 250, 24, 25, 27, 40, 41, 43, 56, 57, 59}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 13, 14, 15, 27, 43, 59, 75, 91, 107, 123, 139, 155, 171, 187, 203, 219, 235, 251, 24, 25, 26, 40, 41, 42, 56, 57, 58}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 14, 15, 28, 44, 60, 76, 92, 108, 124, 140, 156, 172, 188, 204, 220, 236, 252, 29, 30, 31, 45, 46, 47, 61, 62, 63}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 14, 15, 29, 45, 61, 77, 93, 109, 125, 141, 157, 173, 189, 205, 221, 237, 253, 28, 30, 31, 44, 46, 47, 60, 62, 63}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 15, 30, 46, 62, 78, 94, 110, 126, 142, 158, 174, 190, 206, 222, 238, 254, 28, 29, 31, 44, 45, 47, 60, 61, 63}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 31, 47, 63, 79, 95, 111, 127, 143, 159, 175, 191, 207, 223, 239, 255, 28, 29, 30, 44, 45, 46, 60, 61, 62}}, {{17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 0, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176, 192, 208, 224, 240, 1, 2, 3, 33, 34, 35, 49, 50, 51}, {16, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 1, 33, 49, 65, 81, 97, 113, 129, 145, 161, 177, 193, 209, 225, 241, 0, 2, 3, 32, 34, 35, 48, 50, 51}, {16, 17, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 2, 34, 50, 66, 82, 98, 114, 130, 146, 162, 178, 194, 210, 226, 242, 0, 1, 3, 32, 33, 35, 48, 49, 51}, {16, 17, 18, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 3, 35, 51, 67, 83, 99, 115, 131, 147, 163, 179, 195, 211, 227, 243, 0, 1, 2, 32, 33, 34, 48, 49, 50}, {16, 17, 18, 19, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 4, 36, 52, 68, 84, 100, 116, 132, 148, 164, 180, 196, 212, 228, 244, 5, 6, 7, 37, 38, 39, 53, 54, 55}, {16, 17, 18, 19, 20, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 5, 37, 53, 69, 85, 101, 117, 133, 149, 165, 181, 197, 213, 229, 245, 4, 6, 7, 36, 38, 39, 52, 54, 55}, {16, 17, 18, 19, 20, 21, 23, 24, 25, 26, 27, 28, 29, 30, 31, 6, 38, 54, 70, 86, 102, 118, 134, 150, 166, 182, 198, 214, 230, 246, 4, 5, 7, 36, 37, 39, 52, 53, 55}, {16, 17, 18, 19, 20, 21, 22, 24, 25, 26, 27, 28, 29, 30, 31, 7, 39, 55, 71, 87, 103, 119, 135, 151, 167, 183, 199, 215, 231, 247, 4, 5, 6, 36, 37, 38, 52, 53, 54}, {16, 17, 18, 19, 20, 21, 22, 23, 25, 26, 27, 28, 29, 30, 31, 8, 40, 56, 72, 88, 104, 120, 136, 152, 168, 184, 200, 216, 232, 248, 9, 10, 11, 41, 42, 43, 57, 58, 59}, {16, 17, 18, 19, 20, 21, 22, 23, 24, 26, 27, 28, 29, 30, 31, 9, 41, 57, 73, 89, 105, 121, 137, 153, 169, 185, 201, 217, 233, 249, 8, 10, 11, 40, 42, 43, 56, 58, 59}, {16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 27, 28, 29, 30, 31, 10, 42, 58, 74, 90, 106, 122, 138, 154, 170, 186, 202, 218, 234, 250, 8, 9, 11, 40, 41, 43, 56, 57, 59}, {16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 28, 29, 30, 31, 11, 43, 59, 75, 91, 107, 123, 139, 155, 171, 187, 203, 219, 235, 251, 8, 9, 10, 40, 41, 42, 56, 57, 58}, {16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 29, 30, 31, 12, 44, 60, 76, 92, 108, 124, 140, 156, 172, 188, 204, 220, 236, 252, 13, 14, 15, 45, 46, 47, 61, 62, 63}, {16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 30, 31, 13, 45, 61, 77, 93, 109, 125, 141, 157, 173, 189, 205, 221, 237, 253, 12, 14, 15, 44, 46, 47, 60, 62, 63}, {16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 31, 14, 46, 62, 78, 94, 110, 126, 142, 158, 174, 190, 206, 222, 238, 254, 12, 13, 15, 44, 45, 47, 60, 61, 63}, {16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 15, 47, 63, 79, 95, 111, 127, 143, 159, 175, 191, 207, 223, 239, 255, 12, 13, 14, 44, 45, 46, 60, 61, 62}}, {{33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 0, 16, 48, 64, 80, 96, 112, 128, 144, 160, 176, 192, 208, 224, 240, 1, 2, 3, 17, 18, 19, 49, 50, 51}, {32, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 1, 17, 49, 65, 81, 97, 113, 129, 145, 161, 177, 193, 209, 225, 241, 0, 2, 3, 16, 18, 19, 48, 50, 51}, {32, 33, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 2, 18, 50, 66, 82, 98, 114, 130, 146, 162, 178, 194, 210, 226, 242, 0, 1, 3, 16, 17, 19, 48, 49, 51}, {32, 33, 34, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 3, 19, 51, 67, 83, 99, 115, 131, 147, 163, 179, 195, 211, 227, 243, 0, 1, 2, 16, 17, 18, 48, 49, 50}, {32, 33, 34, 35, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 4, 20, 52, 68, 84, 100, 116, 132, 148, 164, 180, 196, 212, 228, 244, 5, 6, 7, 21, 22, 23, 53, 54, 55}, {32, 33, 34, 35, 36, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 5, 21, 53, 69, 85, 101, 117, 133, 149, 165, 181, 197, 213, 229, 245, 4, 6, 7, 20, 22, 23, 52, 54, 55}, {32, 33, 34, 35, 36, 37, 39, 40, 41, 42, 43, 44, 45, 46, 47, 6, 22, 54, 70, 86, 102, 118, 134, 150, 166, 182, 198, 214, 230, 246, 4, 5, 7, 20, 21, 23, 52, 53, 55}, {32, 33, 34, 35, 36, 37, 38, 40, 41, 42, 43, 44, 45, 46, 47, 7, 23, 55, 71, 87, 103, 119, 135, 151, 167, 183, 199, 215, 231, 247, 4, 5, 6, 20, 21, 22, 52, 53, 54}, {32, 33, 34, 35, 36, 37, 38, 39, 41, 42, 43, 44, 45, 46, 47, 8, 24, 56, 72, 88, 104, 120, 136, 152, 168, 184, 200, 216, 232, 248, 9, 10, 11, 25, 26, 27, 57, 58, 59}, {32, 33, 34, 35, 36, 37, 38, 39, 40, 42, 43, 44, 45, 46, 47, 9, 25, 57, 73, 89, 105, 121, 137, 153, 169, 185, 201, 217, 233, 249, 8, 10, 11, 24, 26, 27, 56, 58, 59}, {32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 43, 44, 45, 46, 47, 10, 26, 58, 74, 90, 106, 122, 138, 154, 170, 186, 202, 218, 234, 250, 8, 9, 11, 24, 25, 27, 56, 57, 59}, {32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 44, 45, 46, 47, 11, 27, 59, 75, 91, 107, 123, 139, 155, 171, 187, 203, 219, 235, 251, 8, 9, 10, 24, 25, 26, 56, 57, 58}, {32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 45, 46, 47, 12, 28, 60, 76, 92, 108, 124, 140, 156, 172, 188, 204, 220, 236, 252, 13, 14, 15, 29, 30, 31, 61, 62, 63}, {32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 46, 47, 13, 29, 61, 77, 93, 109, 125, 141, 157, 173, 189, 205, 221, 237, 253, 12, 14, 15, 28, 30, 31, 60, 62, 63}, {32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 47, 14, 30, 62, 78, 94, 110, 126, 142, 158, 174, 190, 206, 222, 238, 254, 12, 13, 15, 28, 29, 31, 60, 61, 63}, {32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 15, 31, 63, 79, 95, 111, 127, 143, 159, 175, 191, 207, 223, 239, 255, 12, 13, 14, 28, 29, 30, 60, 61, 62}}, {{49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 0, 16, 32, 64, 80, 96, 112, 128, 144, 160, 176, 192, 208, 224, 240, 1, 2, 3, 17, 18, 19, 33, 34, 35}, {48, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 1, 17, 33, 65, 81, 97, 113, 129, 145, 161, 177, 193, 209, 225, 241, 0, 2, 3, 16, 18, 19, 32, 34, 35}, {48, 49, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 2, 18, 34, 66, 82, 98, 114, 130, 146, 162, 178, 194, 210, 226, 242, 0, 1, 3, 16, 17, 19, 32, 33, 35}, {48, 49, 50, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 3, 19, 35, 67, 83, 99, 115, 131, 147, 163, 179, 195, 211, 227, 243, 0, 1, 2, 16, 17, 18, 32, 33, 34}, {48, 49, 50, 51, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 4, 20, 36, 68, 84, 100, 116, 132, 148, 164, 180, 196, 212, 228, 244, 5, 6, 7, 21, 22, 23, 37, 38, 39}, {48, 49, 50, 51, 52, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 5, 21, 37, 69, 85, 101, 117, 133, 149, 165, 181, 197, 213, 229, 245, 4, 6, 7, 20, 22, 23, 36, 38, 39}, {48, 49, 50, 51, 52, 53, 55, 56, 57, 58, 59, 60, 61, 62, 63, 6, 22, 38, 70, 86, 102, 118, 134, 150, 166, 182, 198, 214, 230, 246, 4, 5, 7, 20, 21, 23, 36, 37, 39}, {48, 49, 50, 51, 52, 53, 54, 56, 57, 58, 59, 60, 61, 62, 63, 7, 23, 39, 71, 87, 103, 119, 135, 151, 167, 183, 199, 215, 231, 247, 4, 5, 6, 20, 21, 22, 36, 37, 38}, {48, 49, 50, 51, 52, 53, 54, 55, 57, 58, 59, 60, 61, 62, 63, 8, 24, 40, 72, 88, 104, 120, 136, 152, 168, 184, 200, 216, 232, 248, 9, 10, 11, 25, 26, 27, 41, 42, 43}, {48, 49, 50, 51, 52, 53, 54, 55, 56, 58, 59, 60, 61, 62, 63, 9, 25, 41, 73, 89, 105, 121, 137, 153, 169, 185, 201, 217, 233, 249, 8, 10, 11, 24, 26, 27, 40, 42, 43}, {48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 59, 60, 61, 62, 63, 10, 26, 42, 74, 90, 106, 122, 138, 154, 170, 186, 202, 218, 234, 250, 8, 9, 11, 24, 25, 27, 40, 41, 43}, {48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 60, 61, 62, 63, 11, 27, 43, 75, 91, 107, 123, 139, 155, 171, 187, 203, 219, 235, 251, 8, 9, 10, 24, 25, 26, 40, 41, 42}, {48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 61, 62, 63, 12, 28, 44, 76, 92, 108, 124, 140, 156, 172, 188, 204, 220, 236, 252, 13, 14, 15, 29, 30, 31, 45, 46, 47}, {48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 62, 63, 13, 29, 45, 77, 93, 109, 125, 141, 157, 173, 189, 205, 221, 237, 253, 12, 14, 15, 28, 30, 31, 44, 46, 47}, {48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 63, 14, 30, 46, 78, 94, 110, 126, 142, 158, 174, 190, 206, 222, 238, 254, 12, 13, 15, 28, 29, 31, 44, 45, 47}, {48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 15, 31, 47, 79, 95, 111, 127, 143, 159, 175, 191, 207, 223, 239, 255, 12, 13, 14, 28, 29, 30, 44, 45, 46}}, {{65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 0, 16, 32, 48, 80, 96, 112, 128, 144, 160, 176, 192, 208, 224, 240, 81, 82, 83, 97, 98, 99, 113, 114, 115}, {64, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 1, 17, 33, 49, 81, 97, 113, 129, 145, 161, 177, 193, 209, 225, 241, 80, 82, 83, 96, 98, 99, 112, 114, 115}, {64, 65, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 2, 18, 34, 50, 82, 98, 114, 130, 146, 162, 178, 194, 210, 226, 242, 80, 81, 83, 96, 97, 99, 112, 113, 115}, {64, 65, 66, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 3, 19, 35, 51, 83, 99, 115, 131, 147, 163, 179, 195, 211, 227, 243, 80, 81, 82, 96, 97, 98, 112, 113, 114}, {64, 65, 66, 67, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 4, 20, 36, 52, 84, 100, 116, 132, 148, 164, 180, 196, 212, 228, 244, 85, 86, 87, 101, 102, 103, 117, 118, 119}, {64, 65, 66, 67, 68, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 5, 21, 37, 53, 85, 101, 117, 133, 149, 165, 181, 197, 213, 229, 245, 84, 86, 87, 100, 102, 103, 116, 118, 119}, {64, 65, 66, 67, 68, 69, 71, 72, 73, 74, 75, 76, 77, 78, 79, 6, 22, 38, 54, 86, 102, 118, 134, 150, 166, 182, 198, 214, 230, 246, 84, 85, 87, 100, 101, 103, 116, 117, 119}, {64, 65, 66, 67, 68, 69, 70, 72, 73, 74, 75, 76, 77, 78, 79, 7, 23, 39, 55, 87, 103, 119, 135, 151, 167, 183, 199, 215, 231, 247, 84, 85, 86, 100, 101, 102, 116, 117, 118}, {64, 65, 66, 67, 68, 69, 70, 71, 73, 74, 75, 76, 77, 78, 79, 8, 24, 40, 56, 88, 104, 120, 136, 152, 168, 184, 200, 216, 232, 248, 89, 90, 91, 105, 106, 107, 121, 122, 123}, {64, 65, 66, 67, 68, 69, 70, 71, 72, 74, 75, 76, 77, 78, 79, 9, 25, 41, 57, 89, 105, 121, 137, 153, 169, 185, 201, 217, 233, 249, 88, 90, 91, 104, 106, 107, 120, 122, 123}, {64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 75, 76, 77, 78, 79, 10, 26, 42, 58, 90, 106, 122, 138, 154, 170, 186, 202, 218, 234, 250, 88, 89, 91, 104, 105, 107, 120, 121, 123}, {64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 76, 77, 78, 79, 11, 27, 43, 59, 91, 107, 123, 139, 155, 171, 187, 203, 219, 235, 251, 88, 89, 90, 104, 105, 106, 120, 121, 122}, {64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 77, 78, 79, 12, 28, 44, 60, 92, 108, 124, 140, 156, 172, 188, 204, 220, 236, 252, 93, 94, 95, 109, 110, 111, 125, 126, 127}, {64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 78, 79, 13, 29, 45, 61, 93, 109, 125, 141, 157, 173, 189, 205, 221, 237, 253, 92, 94, 95, 108, 110, 111, 124, 126, 127}, {64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 79, 14, 30, 46, 62, 94, 110, 126, 142, 158, 174, 190, 206, 222, 238, 254, 92, 93, 95, 108, 109, 111, 124, 125, 127}, {64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 15, 31, 47, 63, 95, 111, 127, 143, 159, 175, 191, 207, 223, 239, 255, 92, 93, 94, 108, 109, 110, 124, 125, 126}}, {{81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 0, 16, 32, 48, 64, 96, 112, 128, 144, 160, 176, 192, 208, 224, 240, 65, 66, 67, 97, 98, 99, 113, 114, 115}, {80, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 1, 17, 33, 49, 65, 97, 113, 129, 145, 161, 177, 193, 209, 225, 241, 64, 66, 67, 96, 98, 99, 112, 114, 115}, {80, 81, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 2, 18, 34, 50, 66, 98, 114, 130, 146, 162, 178, 194, 210, 226, 242, 64, 65, 67, 96, 97, 99, 112, 113, 115}, {80, 81, 82, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 3, 19, 35, 51, 67, 99, 115, 131, 147, 163, 179, 195, 211, 227, 243, 64, 65, 66, 96, 97, 98, 112, 113, 114}, {80, 81, 82, 83, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 4, 20, 36, 52, 68, 100, 116, 132, 148, 164, 180, 196, 212, 228, 244, 69, 70, 71, 101, 102, 103, 117, 118, 119}, {80, 81, 82, 83, 84, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 5, 21, 37, 53, 69, 101, 117, 133, 149, 165, 181, 197, 213, 229, 245, 68, 70, 71, 100, 102, 103, 116, 118, 119}, {80, 81, 82, 83, 84, 85, 87, 88, 89, 90, 91, 92, 93, 94, 95, 6, 22, 38, 54, 70, 102, 118, 134, 150, 166, 182, 198, 214, 230, 246, 68, 69, 71, 100, 101, 103, 116, 117, 119}, {80, 81, 82, 83, 84, 85, 86, 88, 89, 90, 91, 92, 93, 94, 95, 7, 23, 39, 55, 71, 103, 119, 135, 151, 167, 183, 199, 215, 231, 247, 68, 69, 70, 100, 101, 102, 116, 117, 118}, {80, 81, 82, 83, 84, 85, 86, 87, 89, 90, 91, 92, 93, 94, 95, 8, 24, 40, 56, 72, 104, 120, 136, 152, 168, 184, 200, 216, 232, 248, 73, 74, 75, 105, 106, 107, 121, 122, 123}, {80, 81, 82, 83, 84, 85, 86, 87, 88, 90, 91, 92, 93, 94, 95, 9, 25, 41, 57, 73, 105, 121, 137, 153, 169, 185, 201, 217, 233, 249, 72, 74, 75, 104, 106, 107, 120, 122, 123}, {80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 91, 92, 93, 94, 95, 10, 26, 42, 58, 74, 106, 122, 138, 154, 170, 186, 202, 218, 234, 250, 72, 73, 75, 104, 105, 107, 120, 121, 123}, {80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 92, 93, 94, 95, 11, 27, 43, 59, 75, 107, 123, 139, 155, 171, 187, 203, 219, 235, 251, 72, 73, 74, 104, 105, 106, 120, 121, 122}, {80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 93, 94, 95, 12, 28, 44, 60, 76, 108, 124, 140, 156, 172, 188, 204, 220, 236, 252, 77, 78, 79, 109, 110, 111, 125, 126, 127}, {80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 94, 95, 13, 29, 45, 61, 77, 109, 125, 141, 157, 173, 189, 205, 221, 237, 253, 76, 78, 79, 108, 110, 111, 124, 126, 127}, {80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 95, 14, 30, 46, 62, 78, 110, 126, 142, 158, 174, 190, 206, 222, 238, 254, 76, 77, 79, 108, 109, 111, 124, 125, 127}, {80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 15, 31, 47, 63, 79, 111, 127, 143, 159, 175, 191, 207, 223, 239, 255, 76, 77, 78, 108, 109, 110, 124, 125, 126}}, {{97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 0, 16, 32, 48, 64, 80, 112, 128, 144, 160, 176, 192, 208, 224, 240, 65, 66, 67, 81, 82, 83, 113, 114, 115}, {96, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 1, 17, 33, 49, 65, 81, 113, 129, 145, 161, 177, 193, 209, 225, 241, 64, 66, 67, 80, 82, 83, 112, 114, 115}, {96, 97, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 2, 18, 34, 50, 66, 82, 114, 130, 146, 162, 178, 194, 210, 226, 242, 64, 65, 67, 80, 81, 83, 112, 113, 115}, {96, 97, 98, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 3, 19, 35, 51, 67, 83, 115, 131, 147, 163, 179, 195, 211, 227, 243, 64, 65, 66, 80, 81, 82, 112, 113, 114}, {96, 97, 98, 99, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 4, 20, 36, 52, 68, 84, 116, 132, 148, 164, 180, 196, 212, 228, 244, 69, 70, 71, 85, 86, 87, 117, 118, 119}, {96, 97, 98, 99, 100, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 5, 21, 37, 53, 69, 85, 117, 133, 149, 165, 181, 197, 213, 229, 245, 68, 70, 71, 84, 86, 87, 116, 118, 119}, {96, 97, 98, 99, 100, 101, 103, 104, 105, 106, 107, 108, 109, 110, 111, 6, 22, 38, 54, 70, 86, 118, 134, 150, 166, 182, 198, 214, 230, 246, 68, 69, 71, 84, 85, 87, 116, 117, 119}, {96, 97, 98, 99, 100, 101, 102, 104, 105, 106, 107, 108, 109, 110, 111, 7, 23, 39, 55, 71, 87, 119, 135, 151, 167, 183, 199, 215, 231, 247, 68, 69, 70, 84, 85, 86, 116, 117, 118}, {96, 97, 98, 99, 100, 101, 102, 103, 105, 106, 107, 108, 109, 110, 111, 8, 24, 40, 56, 72, 88, 120, 136, 152, 168, 184, 200, 216, 232, 248, 73, 74, 75, 89, 90, 91, 121, 122, 123}, {96, 97, 98, 99, 100, 101, 102, 103, 104, 106, 107, 108, 109, 110, 111, 9, 25, 41, 57, 73, 89, 121, 137, 153, 169, 185, 201, 217, 233, 249, 72, 74, 75, 88, 90, 91, 120, 122, 123}, {96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 107, 108, 109, 110, 111, 10, 26, 42, 58, 74, 90, 122, 138, 154, 170, 186, 202, 218, 234, 250, 72, 73, 75, 88, 89, 91, 120, 121, 123}, {96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 108, 109, 110, 111, 11, 27, 43, 59, 75, 91, 123, 139, 155, 171, 187, 203, 219, 235, 251, 72, 73, 74, 88, 89, 90, 120, 121, 122}, {96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 109, 110, 111, 12, 28, 44, 60, 76, 92, 124, 140, 156, 172, 188, 204, 220, 236, 252, 77, 78, 79, 93, 94, 95, 125, 126, 127}, {96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 110, 111, 13, 29, 45, 61, 77, 93, 125, 141, 157, 173, 189, 205, 221, 237, 253, 76, 78, 79, 92, 94, 95, 124, 126, 127}, {96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 111, 14, 30, 46, 62, 78, 94, 126, 142, 158, 174, 190, 206, 222, 238, 254, 76, 77, 79, 92, 93, 95, 124, 125, 127}, {96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 15, 31, 47, 63, 79, 95, 127, 143, 159, 175, 191, 207, 223, 239, 255, 76, 77, 78, 92, 93, 94, 124, 125, 126}}, {{113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 0, 16, 32, 48, 64, 80, 96, 128, 144, 160, 176, 192, 208, 224, 240, 65, 66, 67, 81, 82, 83, 97, 98, 99}, {112, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 1, 17, 33, 49, 65, 81, 97, 129, 145, 161, 177, 193, 209, 225, 241, 64, 66, 67, 80, 82, 83, 96, 98, 99}, {112, 113, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 2, 18, 34, 50, 66, 82, 98, 130, 146, 162, 178, 194, 210, 226, 242, 64, 65, 67, 80, 81, 83, 96, 97, 99}, {112, 113, 114, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 3, 19, 35, 51, 67, 83, 99, 131, 147, 163, 179, 195, 211, 227, 243, 64, 65, 66, 80, 81, 82, 96, 97, 98}, {112, 113, 114, 115, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 4, 20, 36, 52, 68, 84, 100, 132, 148, 164, 180, 196, 212, 228, 244, 69, 70, 71, 85, 86, 87, 101, 102, 103}, {112, 113, 114, 115, 116, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 5, 21, 37, 53, 69, 85, 101, 133, 149, 165, 181, 197, 213, 229, 245, 68, 70, 71, 84, 86, 87, 100, 102, 103}, {112, 113, 114, 115, 116, 117, 119, 120, 121, 122, 123, 124, 125, 126, 127, 6, 22, 38, 54, 70, 86, 102, 134, 150, 166, 182, 198, 214, 230, 246, 68, 69, 71, 84, 85, 87, 100, 101, 103}, {112, 113, 114, 115, 116, 117, 118, 120, 121, 122, 123, 124, 125, 126, 127, 7, 23, 39, 55, 71, 87, 103, 135, 151, 167, 183, 199, 215, 231, 247, 68, 69, 70, 84, 85, 86, 100, 101, 102}, {112, 113, 114, 115, 116, 117, 118, 119, 121, 122, 123, 124, 125, 126, 127, 8, 24, 40, 56, 72, 88, 104, 136, 152, 168, 184, 200, 216, 232, 248, 73, 74, 75, 89, 90, 91, 105, 106, 107}, {112, 113, 114, 115, 116, 117, 118, 119, 120, 122, 123, 124, 125, 126, 127, 9, 25, 41, 57, 73, 89, 105, 137, 153, 169, 185, 201, 217, 233, 249, 72, 74, 75, 88, 90, 91, 104, 106, 107}, {112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 123, 124, 125, 126, 127, 10, 26, 42, 58, 74, 90, 106, 138, 154, 170, 186, 202, 218, 234, 250, 72, 73, 75, 88, 89, 91, 104, 105, 107}, {112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 124, 125, 126, 127, 11, 27, 43, 59, 75, 91, 107, 139, 155, 171, 187, 203, 219, 235, 251, 72, 73, 74, 88, 89, 90, 104, 105, 106}, {112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 125, 126, 127, 12, 28, 44, 60, 76, 92, 108, 140, 156, 172, 188, 204, 220, 236, 252, 77, 78, 79, 93, 94, 95, 109, 110, 111}, {112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 126, 127, 13, 29, 45, 61, 77, 93, 109, 141, 157, 173, 189, 205, 221, 237, 253, 76, 78, 79, 92, 94, 95, 108, 110, 111}, {112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 127, 14, 30, 46, 62, 78, 94, 110, 142, 158, 174, 190, 206, 222, 238, 254, 76, 77, 79, 92, 93, 95, 108, 109, 111}, {112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 15, 31, 47, 63, 79, 95, 111, 143, 159, 175, 191, 207, 223, 239, 255, 76, 77, 78, 92, 93, 94, 108, 109, 110}}, {{129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 0, 16, 32, 48, 64, 80, 96, 112, 144, 160, 176, 192, 208, 224, 240, 145, 146, 147, 161, 162, 163, 177, 178, 179}, {128, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 1, 17, 33, 49, 65, 81, 97, 113, 145, 161, 177, 193, 209, 225, 241, 144, 146, 147, 160, 162, 163, 176, 178, 179}, {128, 129, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 2, 18, 34, 50, 66, 82, 98, 114, 146, 162, 178, 194, 210, 226, 242, 144, 145, 147, 160, 161, 163, 176, 177, 179}, {128, 129, 130, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 3, 19, 35, 51, 67, 83, 99, 115, 147, 163, 179, 195, 211, 227, 243, 144, 145, 146, 160, 161, 162, 176, 177, 178}, {128, 129, 130, 131, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 4, 20, 36, 52, 68, 84, 100, 116, 148, 164, 180, 196, 212, 228, 244, 149, 150, 151, 165, 166, 167, 181, 182, 183}, {128, 129, 130, 131, 132, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 5, 21, 37, 53, 69, 85, 101, 117, 149, 165, 181, 197, 213, 229, 245, 148, 150, 151, 164, 166, 167, 180, 182, 183}, {128, 129, 130, 131, 132, 133, 135, 136, 137, 138, 139, 140, 141, 142, 143, 6, 22, 38, 54, 70, 86, 102, 118, 150, 166, 182, 198, 214, 230, 246, 148, 149, 151, 164, 165, 167, 180, 181, 183}, {128, 129, 130, 131, 132, 133, 134, 136, 137, 138, 139, 140, 141, 142, 143, 7, 23, 39, 55, 71, 87, 103, 119, 151, 167, 183, 199, 215, 231, 247, 148, 149, 150, 164, 165, 166, 180, 181, 182}, {128, 129, 130, 131, 132, 133, 134, 135, 137, 138, 139, 140, 141, 142, 143, 8, 24, 40, 56, 72, 88, 104, 120, 152, 168, 184, 200, 216, 232, 248, 153, 154, 155, 169, 170, 171, 185, 186, 187}, {128, 129, 130, 131, 132, 133, 134, 135, 136, 138, 139, 140, 141, 142, 143, 9, 25, 41, 57, 73, 89, 105, 121, 153, 169, 185, 201, 217, 233, 249, 152, 154, 155, 168, 170, 171, 184, 186, 187}, {128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 139, 140, 141, 142, 143, 10, 26, 42, 58, 74, 90, 106, 122, 154, 170, 186, 202, 218, 234, 250, 152, 153, 155, 168, 169, 171, 184, 185, 187}, {128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 140, 141, 142, 143, 11, 27, 43, 59, 75, 91, 107, 123, 155, 171, 187, 203, 219, 235, 251, 152, 153, 154, 168, 169, 170, 184, 185, 186}, {128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 141, 142, 143, 12, 28, 44, 60, 76, 92, 108, 124, 156, 172, 188, 204, 220, 236, 252, 157, 158, 159, 173, 174, 175, 189, 190, 191}, {128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 142, 143, 13, 29, 45, 61, 77, 93, 109, 125, 157, 173, 189, 205, 221, 237, 253, 156, 158, 159, 172, 174, 175, 188, 190, 191}, {128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 143, 14, 30, 46, 62, 78, 94, 110, 126, 158, 174, 190, 206, 222, 238, 254, 156, 157, 159, 172, 173, 175, 188, 189, 191}, {128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 15, 31, 47, 63, 79, 95, 111, 127, 159, 175, 191, 207, 223, 239, 255, 156, 157, 158, 172, 173, 174, 188, 189, 190}}, {{145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 0, 16, 32, 48, 64, 80, 96, 112, 128, 160, 176, 192, 208, 224, 240, 129, 130, 131, 161, 162, 163, 177, 178, 179}, {144, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 1, 17, 33, 49, 65, 81, 97, 113, 129, 161, 177, 193, 209, 225, 241, 128, 130, 131, 160, 162, 163, 176, 178, 179}, {144, 145, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 2, 18, 34, 50, 66, 82, 98, 114, 130, 162, 178, 194, 210, 226, 242, 128, 129, 131, 160, 161, 163, 176, 177, 179}, {144, 145, 146, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 3, 19, 35, 51, 67, 83, 99, 115, 131, 163, 179, 195, 211, 227, 243, 128, 129, 130, 160, 161, 162, 176, 177, 178}, {144, 145, 146, 147, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 4, 20, 36, 52, 68, 84, 100, 116, 132, 164, 180, 196, 212, 228, 244, 133, 134, 135, 165, 166, 167, 181, 182, 183}, {144, 145, 146, 147, 148, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 5, 21, 37, 53, 69, 85, 101, 117, 133, 165, 181, 197, 213, 229, 245, 132, 134, 135, 164, 166, 167, 180, 182, 183}, {144, 145, 146, 147, 148, 149, 151, 152, 153, 154, 155, 156, 157, 158, 159, 6, 22, 38, 54, 70, 86, 102, 118, 134, 166, 182, 198, 214, 230, 246, 132, 133, 135, 164, 165, 167, 180, 181, 183}, {144, 145, 146, 147, 148, 149, 150, 152, 153, 154, 155, 156, 157, 158, 159, 7, 23, 39, 55, 71, 87, 103, 119, 135, 167, 183, 199, 215, 231, 247, 132, 133, 134, 164, 165, 166, 180, 181, 182}, {144, 145, 146, 147, 148, 149, 150, 151, 153, 154, 155, 156, 157, 158, 159, 8, 24, 40, 56, 72, 88, 104, 120, 136, 168, 184, 200, 216, 232, 248, 137, 138, 139, 169, 170, 171, 185, 186, 187}, {144, 145, 146, 147, 148, 149, 150, 151, 152, 154, 155, 156, 157, 158, 159, 9, 25, 41, 57, 73, 89, 105, 121, 137, 169, 185, 201, 217, 233, 249, 136, 138, 139, 168, 170, 171, 184, 186, 187}, {144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 155, 156, 157, 158, 159, 10, 26, 42, 58, 74, 90, 106, 122, 138, 170, 186, 202, 218, 234, 250, 136, 137, 139, 168, 169, 171, 184, 185, 187}, {144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 156, 157, 158, 159, 11, 27, 43, 59, 75, 91, 107, 123, 139, 171, 187, 203, 219, 235, 251, 136, 137, 138, 168, 169, 170, 184, 185, 186}, {144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 157, 158, 159, 12, 28, 44, 60, 76, 92, 108, 124, 140, 172, 188, 204, 220, 236, 252, 141, 142, 143, 173, 174, 175, 189, 190, 191}, {144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 158, 159, 13, 29, 45, 61, 77, 93, 109, 125, 141, 173, 189, 205, 221, 237, 253, 140, 142, 143, 172, 174, 175, 188, 190, 191}, {144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 159, 14, 30, 46, 62, 78, 94, 110, 126, 142, 174, 190, 206, 222, 238, 254, 140, 141, 143, 172, 173, 175, 188, 189, 191}, {144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 15, 31, 47, 63, 79, 95, 111, 127, 143, 175, 191, 207, 223, 239, 255, 140, 141, 142, 172, 173, 174, 188, 189, 190}}, {{161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 0, 16, 32, 48, 64, 80, 96, 112, 128, 144, 176, 192, 208, 224, 240, 129, 130, 131, 145, 146, 147, 177, 178, 179}, {160, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 1, 17, 33, 49, 65, 81, 97, 113, 129, 145, 177, 193, 209, 225, 241, 128, 130, 131, 144, 146, 147, 176, 178, 179}, {160, 161, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 2, 18, 34, 50, 66, 82, 98, 114, 130, 146, 178, 194, 210, 226, 242, 128, 129, 131, 144, 145, 147, 176, 177, 179}, {160, 161, 162, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 3, 19, 35, 51, 67, 83, 99, 115, 131, 147, 179, 195, 211, 227, 243, 128, 129, 130, 144, 145, 146, 176, 177, 178}, {160, 161, 162, 163, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 4, 20, 36, 52, 68, 84, 100, 116, 132, 148, 180, 196, 212, 228, 244, 133, 134, 135, 149, 150, 151, 181, 182, 183}, {160, 161, 162, 163, 164, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 5, 21, 37, 53, 69, 85, 101, 117, 133, 149, 181, 197, 213, 229, 245, 132, 134, 135, 148, 150, 151, 180, 182, 183}, {160, 161, 162, 163, 164, 165, 167, 168, 169, 170, 171, 172, 173, 174, 175, 6, 22, 38, 54, 70, 86, 102, 118, 134, 150, 182, 198, 214, 230, 246, 132, 133, 135, 148, 149, 151, 180, 181, 183}, {160, 161, 162, 163, 164, 165, 166, 168, 169, 170, 171, 172, 173, 174, 175, 7, 23, 39, 55, 71, 87, 103, 119, 135, 151, 183, 199, 215, 231, 247, 132, 133, 134, 148, 149, 150, 180, 181, 182}, {160, 161, 162, 163, 164, 165, 166, 167, 169, 170, 171, 172, 173, 174, 175, 8, 24, 40, 56, 72, 88, 104, 120, 136, 152, 184, 200, 216, 232, 248, 137, 138, 139, 153, 154, 155, 185, 186, 187}, {160, 161, 162, 163, 164, 165, 166, 167, 168, 170, 171, 172, 173, 174, 175, 9, 25, 41, 57, 73, 89, 105, 121, 137, 153, 185, 201, 217, 233, 249, 136, 138, 139, 152, 154, 155, 184, 186, 187}, {160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 171, 172, 173, 174, 175, 10, 26, 42, 58, 74, 90, 106, 122, 138, 154, 186, 202, 218, 234, 250, 136, 137, 139, 152, 153, 155, 184, 185, 187}, {160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 172, 173, 174, 175, 11, 27, 43, 59, 75, 91, 107, 123, 139, 155, 187, 203, 219, 235, 251, 136, 137, 138, 152, 153, 154, 184, 185, 186}, {160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 173, 174, 175, 12, 28, 44, 60, 76, 92, 108, 124, 140, 156, 188, 204, 220, 236, 252, 141, 142, 143, 157, 158, 159, 189, 190, 191}, {160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 174, 175, 13, 29, 45, 61, 77, 93, 109, 125, 141, 157, 189, 205, 221, 237, 253, 140, 142, 143, 156, 158, 159, 188, 190, 191}, {160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 175, 14, 30, 46, 62, 78, 94, 110, 126, 142, 158, 190, 206, 222, 238, 254, 140, 141, 143, 156, 157, 159, 188, 189, 191}, {160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 15, 31, 47, 63, 79, 95, 111, 127, 143, 159, 191, 207, 223, 239, 255, 140, 141, 142, 156, 157, 158, 188, 189, 190}}, {{177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 0, 16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 192, 208, 224, 240, 129, 130, 131, 145, 146, 147, 161, 162, 163}, {176, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 1, 17, 33, 49, 65, 81, 97, 113, 129, 145, 161, 193, 209, 225, 241, 128, 130, 131, 144, 146, 147, 160, 162, 163}, {176, 177, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 2, 18, 34, 50, 66, 82, 98, 114, 130, 146, 162, 194, 210, 226, 242, 128, 129, 131, 144, 145, 147, 160, 161, 163}, {176, 177, 178, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 3, 19, 35, 51, 67, 83, 99, 115, 131, 147, 163, 195, 211, 227, 243, 128, 129, 130, 144, 145, 146, 160, 161, 162}, {176, 177, 178, 179, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 4, 20, 36, 52, 68, 84, 100, 116, 132, 148, 164, 196, 212, 228, 244, 133, 134, 135, 149, 150, 151, 165, 166, 167}, {176, 177, 178, 179, 180, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 5, 21, 37, 53, 69, 85, 101, 117, 133, 149, 165, 197, 213, 229, 245, 132, 134, 135, 148, 150, 151, 164, 166, 167}, {176, 177, 178, 179, 180, 181, 183, 184, 185, 186, 187, 188, 189, 190, 191, 6, 22, 38, 54, 70, 86, 102, 118, 134, 150, 166, 198, 214, 230, 246, 132, 133, 135, 148, 149, 151, 164, 165, 167}, {176, 177, 178, 179, 180, 181, 182, 184, 185, 186, 187, 188, 189, 190, 191, 7, 23, 39, 55, 71, 87, 103, 119, 135, 151, 167, 199, 215, 231, 247, 132, 133, 134, 148, 149, 150, 164, 165, 166}, {176, 177, 178, 179, 180, 181, 182, 183, 185, 186, 187, 188, 189, 190, 191, 8, 24, 40, 56, 72, 88, 104, 120, 136, 152, 168, 200, 216, 232, 248, 137, 138, 139, 153, 154, 155, 169, 170, 171}, {176, 177, 178, 179, 180, 181, 182, 183, 184, 186, 187, 188, 189, 190, 191, 9, 25, 41, 57, 73, 89, 105, 121, 137, 153, 169, 201, 217, 233, 249, 136, 138, 139, 152, 154, 155, 168, 170, 171}, {176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 187, 188, 189, 190, 191, 10, 26, 42, 58, 74, 90, 106, 122, 138, 154, 170, 202, 218, 234, 250, 136, 137, 139, 152, 153, 155, 168, 169, 171}, {176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 188, 189, 190, 191, 11, 27, 43, 59, 75, 91, 107, 123, 139, 155, 171, 203, 219, 235, 251, 136, 137, 138, 152, 153, 154, 168, 169, 170}, {176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 189, 190, 191, 12, 28, 44, 60, 76, 92, 108, 124, 140, 156, 172, 204, 220, 236, 252, 141, 142, 143, 157, 158, 159, 173, 174, 175}, {176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 190, 191, 13, 29, 45, 61, 77, 93, 109, 125, 141, 157, 173, 205, 221, 237, 253, 140, 142, 143, 156, 158, 159, 172, 174, 175}, {176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 191, 14, 30, 46, 62, 78, 94, 110, 126, 142, 158, 174, 206, 222, 238, 254, 140, 141, 143, 156, 157, 159, 172, 173, 175}, {176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 15, 31, 47, 63, 79, 95, 111, 127, 143, 159, 175, 207, 223, 239, 255, 140, 141, 142, 156, 157, 158, 172, 173, 174}}, {{193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 0, 16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176, 208, 224, 240, 209, 210, 211, 225, 226, 227, 241, 242, 243}, {192, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 1, 17, 33, 49, 65, 81, 97, 113, 129, 145, 161, 177, 209, 225, 241, 208, 210, 211, 224, 226, 227, 240, 242, 243}, {192, 193, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 2, 18, 34, 50, 66, 82, 98, 114, 130, 146, 162, 178, 210, 226, 242, 208, 209, 211, 224, 225, 227, 240, 241, 243}, {192, 193, 194, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 3, 19, 35, 51, 67, 83, 99, 115, 131, 147, 163, 179, 211, 227, 243, 208, 209, 210, 224, 225, 226, 240, 241, 242}, {192, 193, 194, 195, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 4, 20, 36, 52, 68, 84, 100, 116, 132, 148, 164, 180, 212, 228, 244, 213, 214, 215, 229, 230, 231, 245, 246, 247}, {192, 193, 194, 195, 196, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 5, 21, 37, 53, 69, 85, 101, 117, 133, 149, 165, 181, 213, 229, 245, 212, 214, 215, 228, 230, 231, 244, 246, 247}, {192, 193, 194, 195, 196, 197, 199, 200, 201, 202, 203, 204, 205, 206, 207, 6, 22, 38, 54, 70, 86, 102, 118, 134, 150, 166, 182, 214, 230, 246, 212, 213, 215, 228, 229, 231, 244, 245, 247}, {192, 193, 194, 195, 196, 197, 198, 200, 201, 202, 203, 204, 205, 206, 207, 7, 23, 39, 55, 71, 87, 103, 119, 135, 151, 167, 183, 215, 231, 247, 212, 213, 214, 228, 229, 230, 244, 245, 246}, {192, 193, 194, 195, 196, 197, 198, 199, 201, 202, 203, 204, 205, 206, 207, 8, 24, 40, 56, 72, 88, 104, 120, 136, 152, 168, 184, 216, 232, 248, 217, 218, 219, 233, 234, 235, 249, 250, 251}, {192, 193, 194, 195, 196, 197, 198, 199, 200, 202, 203, 204, 205, 206, 207, 9, 25, 41, 57, 73, 89, 105, 121, 137, 153, 169, 185, 217, 233, 249, 216, 218, 219, 232, 234, 235, 248, 250, 251}, {192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 203, 204, 205, 206, 207, 10, 26, 42, 58, 74, 90, 106, 122, 138, 154, 170, 186, 218, 234, 250, 216, 217, 219, 232, 233, 235, 248, 249, 251}, {192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 204, 205, 206, 207, 11, 27, 43, 59, 75, 91, 107, 123, 139, 155, 171, 187, 219, 235, 251, 216, 217, 218, 232, 233, 234, 248, 249, 250}, {192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 205, 206, 207, 12, 28, 44, 60, 76, 92, 108, 124, 140, 156, 172, 188, 220, 236, 252, 221, 222, 223, 237, 238, 239, 253, 254, 255}, {192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 206, 207, 13, 29, 45, 61, 77, 93, 109, 125, 141, 157, 173, 189, 221, 237, 253, 220, 222, 223, 236, 238, 239, 252, 254, 255}, {192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 207, 14, 30, 46, 62, 78, 94, 110, 126, 142, 158, 174, 190, 222, 238, 254, 220, 221, 223, 236, 237, 239, 252, 253, 255}, {192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 15, 31, 47, 63, 79, 95, 111, 127, 143, 159, 175, 191, 223, 239, 255, 220, 221, 222, 236, 237, 238, 252, 253, 254}}, {{209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 0, 16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176, 192, 224, 240, 193, 194, 195, 225, 226, 227, 241, 242, 243}, {208, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 1, 17, 33, 49, 65, 81, 97, 113, 129, 145, 161, 177, 193, 225, 241, 192, 194, 195, 224, 226, 227, 240, 242, 243}, {208, 209, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 2, 18, 34, 50, 66, 82, 98, 114, 130, 146, 162, 178, 194, 226, 242, 192, 193, 195, 224, 225, 227, 240, 241, 243}, {208, 209, 210, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 3, 19, 35, 51, 67, 83, 99, 115, 131, 147, 163, 179, 195, 227, 243, 192, 193, 194, 224, 225, 226, 240, 241, 242}, {208, 209, 210, 211, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 4, 20, 36, 52, 68, 84, 100, 116, 132, 148, 164, 180, 196, 228, 244, 197, 198, 199, 229, 230, 231, 245, 246, 247}, {208, 209, 210, 211, 212, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 5, 21, 37, 53, 69, 85, 101, 117, 133, 149, 165, 181, 197, 229, 245, 196, 198, 199, 228, 230, 231, 244, 246, 247}, {208, 209, 210, 211, 212, 213, 215, 216, 217, 218, 219, 220, 221, 222, 223, 6, 22, 38, 54, 70, 86, 102, 118, 134, 150, 166, 182, 198, 230, 246, 196, 197, 199, 228, 229, 231, 244, 245, 247}, {208, 209, 210, 211, 212, 213, 214, 216, 217, 218, 219, 220, 221, 222, 223, 7, 23, 39, 55, 71, 87, 103, 119, 135, 151, 167, 183, 199, 231, 247, 196, 197, 198, 228, 229, 230, 244, 245, 246}, {208, 209, 210, 211, 212, 213, 214, 215, 217, 218, 219, 220, 221, 222, 223, 8, 24, 40, 56, 72, 88, 104, 120, 136, 152, 168, 184, 200, 232, 248, 201, 202, 203, 233, 234, 235, 249, 250, 251}, {208, 209, 210, 211, 212, 213, 214, 215, 216, 218, 219, 220, 221, 222, 223, 9, 25, 41, 57, 73, 89, 105, 121, 137, 153, 169, 185, 201, 233, 249, 200, 202, 203, 232, 234, 235, 248, 250, 251}, {208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 219, 220, 221, 222, 223, 10, 26, 42, 58, 74, 90, 106, 122, 138, 154, 170, 186, 202, 234, 250, 200, 201, 203, 232, 233, 235, 248, 249, 251}, {208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 220, 221, 222, 223, 11, 27, 43, 59, 75, 91, 107, 123, 139, 155, 171, 187, 203, 235, 251, 200, 201, 202, 232, 233, 234, 248, 249, 250}, {208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 221, 222, 223, 12, 28, 44, 60, 76, 92, 108, 124, 140, 156, 172, 188, 204, 236, 252, 205, 206, 207, 237, 238, 239, 253, 254, 255}, {208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 222, 223, 13, 29, 45, 61, 77, 93, 109, 125, 141, 157, 173, 189, 205, 237, 253, 204, 206, 207, 236, 238, 239, 252, 254, 255}, {208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 223, 14, 30, 46, 62, 78, 94, 110, 126, 142, 158, 174, 190, 206, 238, 254, 204, 205, 207, 236, 237, 239, 252, 253, 255}, {208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 15, 31, 47, 63, 79, 95, 111, 127, 143, 159, 175, 191, 207, 239, 255, 204, 205, 206, 236, 237, 238, 252, 253, 254}}, {{225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 0, 16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176, 192, 208, 240, 193, 194, 195, 209, 210, 211, 241, 242, 243}, {224, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 1, 17, 33, 49, 65, 81, 97, 113, 129, 145, 161, 177, 193, 209, 241, 192, 194, 195, 208, 210, 211, 240, 242, 243}, {224, 225, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 2, 18, 34, 50, 66, 82, 98, 114, 130, 146, 162, 178, 194, 210, 242, 192, 193, 195, 208, 209, 211, 240, 241, 243}, {224, 225, 226, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 3, 19, 35, 51, 67, 83, 99, 115, 131, 147, 163, 179, 195, 211, 243, 192, 193, 194, 208, 209, 210, 240, 241, 242}, {224, 225, 226, 227, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 4, 20, 36, 52, 68, 84, 100, 116, 132, 148, 164, 180, 196, 212, 244, 197, 198, 199, 213, 214, 215, 245, 246, 247}, {224, 225, 226, 227, 228, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 5, 21, 37, 53, 69, 85, 101, 117, 133, 149, 165, 181, 197, 213, 245, 196, 198, 199, 212, 214, 215, 244, 246, 247}, {224, 225, 226, 227, 228, 229, 231, 232, 233, 234, 235, 236, 237, 238, 239, 6, 22, 38, 54, 70, 86, 102, 118, 134, 150, 166, 182, 198, 214, 246, 196, 197, 199, 212, 213, 215, 244, 245, 247}, {224, 225, 226, 227, 228, 229, 230, 232, 233, 234, 235, 236, 237, 238, 239, 7, 23, 39, 55, 71, 87, 103, 119, 135, 151, 167, 183, 199, 215, 247, 196, 197, 198, 212, 213, 214, 244, 245, 246}, {224, 225, 226, 227, 228, 229, 230, 231, 233, 234, 235, 236, 237, 238, 239, 8, 24, 40, 56, 72, 88, 104, 120, 136, 152, 168, 184, 200, 216, 248, 201, 202, 203, 217, 218, 219, 249, 250, 251}, {224, 225, 226, 227, 228, 229, 230, 231, 232, 234, 235, 236, 237, 238, 239, 9, 25, 41, 57, 73, 89, 105, 121, 137, 153, 169, 185, 201, 217, 249, 200, 202, 203, 216, 218, 219, 248, 250, 251}, {224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 235, 236, 237, 238, 239, 10, 26, 42, 58, 74, 90, 106, 122, 138, 154, 170, 186, 202, 218, 250, 200, 201, 203, 216, 217, 219, 248, 249, 251}, {224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 236, 237, 238, 239, 11, 27, 43, 59, 75, 91, 107, 123, 139, 155, 171, 187, 203, 219, 251, 200, 201, 202, 216, 217, 218, 248, 249, 250}, {224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 237, 238, 239, 12, 28, 44, 60, 76, 92, 108, 124, 140, 156, 172, 188, 204, 220, 252, 205, 206, 207, 221, 222, 223, 253, 254, 255}, {224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 238, 239, 13, 29, 45, 61, 77, 93, 109, 125, 141, 157, 173, 189, 205, 221, 253, 204, 206, 207, 220, 222, 223, 252, 254, 255}, {224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 239, 14, 30, 46, 62, 78, 94, 110, 126, 142, 158, 174, 190, 206, 222, 254, 204, 205, 207, 220, 221, 223, 252, 253, 255}, {224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 15, 31, 47, 63, 79, 95, 111, 127, 143, 159, 175, 191, 207, 223, 255, 204, 205, 206, 220, 221, 222, 252, 253, 254}}, {{241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 0, 16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176, 192, 208, 224, 193, 194, 195, 209, 210, 211, 225, 226, 227}, {240, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 1, 17, 33, 49, 65, 81, 97, 113, 129, 145, 161, 177, 193, 209, 225, 192, 194, 195, 208, 210, 211, 224, 226, 227}, {240, 241, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 2, 18, 34, 50, 66, 82, 98, 114, 130, 146, 162, 178, 194, 210, 226, 192, 193, 195, 208, 209, 211, 224, 225, 227}, {240, 241, 242, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 3, 19, 35, 51, 67, 83, 99, 115, 131, 147, 163, 179, 195, 211, 227, 192, 193, 194, 208, 209, 210, 224, 225, 226}, {240, 241, 242, 243, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 4, 20, 36, 52, 68, 84, 100, 116, 132, 148, 164, 180, 196, 212, 228, 197, 198, 199, 213, 214, 215, 229, 230, 231}, {240, 241, 242, 243, 244, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 5, 21, 37, 53, 69, 85, 101, 117, 133, 149, 165, 181, 197, 213, 229, 196, 198, 199, 212, 214, 215, 228, 230, 231}, {240, 241, 242, 243, 244, 245, 247, 248, 249, 250, 251, 252, 253, 254, 255, 6, 22, 38, 54, 70, 86, 102, 118, 134, 150, 166, 182, 198, 214, 230, 196, 197, 199, 212, 213, 215, 228, 229, 231}, {240, 241, 242, 243, 244, 245, 246, 248, 249, 250, 251, 252, 253, 254, 255, 7, 23, 39, 55, 71, 87, 103, 119, 135, 151, 167, 183, 199, 215, 231, 196, 197, 198, 212, 213, 214, 228, 229, 230}, {240, 241, 242, 243, 244, 245, 246, 247, 249, 250, 251, 252, 253, 254, 255, 8, 24, 40, 56, 72, 88, 104, 120, 136, 152, 168, 184, 200, 216, 232, 201, 202, 203, 217, 218, 219, 233, 234, 235}, {240, 241, 242, 243, 244, 245, 246, 247, 248, 250, 251, 252, 253, 254, 255, 9, 25, 41, 57, 73, 89, 105, 121, 137, 153, 169, 185, 201, 217, 233, 200, 202, 203, 216, 218, 219, 232, 234, 235}, {240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 251, 252, 253, 254, 255, 10, 26, 42, 58, 74, 90, 106, 122, 138, 154, 170, 186, 202, 218, 234, 200, 201, 203, 216, 217, 219, 232, 233, 235}, {240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 252, 253, 254, 255, 11, 27, 43, 59, 75, 91, 107, 123, 139, 155, 171, 187, 203, 219, 235, 200, 201, 202, 216, 217, 218, 232, 233, 234}, {240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 253, 254, 255, 12, 28, 44, 60, 76, 92, 108, 124, 140, 156, 172, 188, 204, 220, 236, 205, 206, 207, 221, 222, 223, 237, 238, 239}, {240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 254, 255, 13, 29, 45, 61, 77, 93, 109, 125, 141, 157, 173, 189, 205, 221, 237, 204, 206, 207, 220, 222, 223, 236, 238, 239}, {240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 255, 14, 30, 46, 62, 78, 94, 110, 126, 142, 158, 174, 190, 206, 222, 238, 204, 205, 207, 220, 221, 223, 236, 237, 239}, {240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 15, 31, 47, 63, 79, 95, 111, 127, 143, 159, 175, 191, 207, 223, 239, 204, 205, 206, 220, 221, 222, 236, 237, 238}}}; const unsigned int Indexer::subunit_combinations_2 [120][2] = {{0, 1}, {0, 2}, {0, 3}, {0, 4}, {0, 5}, {0, 6}, {0, 7}, {0, 8}, {0, 9}, {0, 10}, {0, 11}, {0, 12}, {0, 13}, {0, 14}, {0, 15}, {1, 2}, {1, 3}, {1, 4}, {1, 5}, {1, 6}, {1, 7}, {1, 8}, {1, 9}, {1, 10}, {1, 11}, {1, 12}, {1, 13}, {1, 14}, {1, 15}, {2, 3}, {2, 4}, {2, 5}, {2, 6}, {2, 7}, {2, 8}, {2, 9}, {2, 10}, {2, 11}, {2, 12}, {2, 13}, {2, 14}, {2, 15}, {3, 4}, {3, 5}, {3, 6}, {3, 7}, {3, 8}, {3, 9}, {3, 10}, {3, 11}, {3, 12}, {3, 13}, {3, 14}, {3, 15}, {4, 5}, {4, 6}, {4, 7}, {4, 8}, {4, 9}, {4, 10}, {4, 11}, {4, 12}, {4, 13}, {4, 14}, {4, 15}, {5, 6}, {5, 7}, {5, 8}, {5, 9}, {5, 10}, {5, 11}, {5, 12}, {5, 13}, {5, 14}, {5, 15}, {6, 7}, {6, 8}, {6, 9}, {6, 10}, {6, 11}, {6, 12}, {6, 13}, {6, 14}, {6, 15}, {7, 8}, {7, 9}, {7, 10}, {7, 11}, {7, 12}, {7, 13}, {7, 14}, {7, 15}, {8, 9}, {8, 10}, {8, 11}, {8, 12}, {8, 13}, {8, 14}, {8, 15}, {9, 10}, {9, 11}, {9, 12}, {9, 13}, {9, 14}, {9, 15}, {10, 11}, {10, 12}, {10, 13}, {10, 14}, {10, 15}, {11, 12}, {11, 13}, {11, 14}, {11, 15}, {12, 13}, {12, 14}, {12, 15}, {13, 14}, {13, 15}, {14, 15}}; const unsigned int Indexer::subvalue_combinations_2 [120][2] = {{0, 1}, {0, 2}, {0, 3}, {0, 4}, {0, 5}, {0, 6}, {0, 7}, {0, 8}, {0, 9}, {0, 10}, {0, 11}, {0, 12}, {0, 13}, {0, 14}, {0, 15}, {1, 2}, {1, 3}, {1, 4}, {1, 5}, {1, 6}, {1, 7}, {1, 8}, {1, 9}, {1, 10}, {1, 11}, {1, 12}, {1, 13}, {1, 14}, {1, 15}, {2, 3}, {2, 4}, {2, 5}, {2, 6}, {2, 7}, {2, 8}, {2, 9}, {2, 10}, {2, 11}, {2, 12}, {2, 13}, {2, 14}, {2, 15}, {3, 4}, {3, 5}, {3, 6}, {3, 7}, {3, 8}, {3, 9}, {3, 10}, {3, 11}, {3, 12}, {3, 13}, {3, 14}, {3, 15}, {4, 5}, {4, 6}, {4, 7}, {4, 8}, {4, 9}, {4, 10}, {4, 11}, {4, 12}, {4, 13}, {4, 14}, {4, 15}, {5, 6}, {5, 7}, {5, 8}, {5, 9}, {5, 10}, {5, 11}, {5, 12}, {5, 13}, {5, 14}, {5, 15}, {6, 7}, {6, 8}, {6, 9}, {6, 10}, {6, 11}, {6, 12}, {6, 13}, {6, 14}, {6, 15}, {7, 8}, {7, 9}, {7, 10}, {7, 11}, {7, 12}, {7, 13}, {7, 14}, {7, 15}, {8, 9}, {8, 10}, {8, 11}, {8, 12}, {8, 13}, {8, 14}, {8, 15}, {9, 10}, {9, 11}, {9, 12}, {9, 13}, {9, 14}, {9, 15}, {10, 11}, {10, 12}, {10, 13}, {10, 14}, {10, 15}, {11, 12}, {11, 13}, {11, 14}, {11, 15}, {12, 13}, {12, 14}, {12, 15}, {13, 14}, {13, 15}, {14, 15}}; 
\ No newline at end of file
@@ -0,0 +1,4 @@
+// This is a generated file, do not edit it directly
+// N: 25
+#include "indexer.h"
+const unsigned int Indexer::grid_lookup [25][25][2] = {{{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 1}, {0, 1}, {0, 1}, {0, 1}, {0, 1}, {0, 2}, {0, 2}, {0, 2}, {0, 2}, {0, 2}, {0, 3}, {0, 3}, {0, 3}, {0, 3}, {0, 3}, {0, 4}, {0, 4}, {0, 4}, {0, 4}, {0, 4}}, {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 1}, {0, 1}, {0, 1}, {0, 1}, {0, 1}, {0, 2}, {0, 2}, {0, 2}, {0, 2}, {0, 2}, {0, 3}, {0, 3}, {0, 3}, {0, 3}, {0, 3}, {0, 4}, {0, 4}, {0, 4}, {0, 4}, {0, 4}}, {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 1}, {0, 1}, {0, 1}, {0, 1}, {0, 1}, {0, 2}, {0, 2}, {0, 2}, {0, 2}, {0, 2}, {0, 3}, {0, 3}, {0, 3}, {0, 3}, {0, 3}, {0, 4}, {0, 4}, {0, 4}, {0, 4}, {0, 4}}, {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 1}, {0, 1}, {0, 1}, {0, 1}, {0, 1}, {0, 2}, {0, 2}, {0, 2}, {0, 2}, {0, 2}, {0, 3}, {0, 3}, {0, 3}, {0, 3}, {0, 3}, {0, 4}, {0, 4}, {0, 4}, {0, 4}, {0, 4}}, {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 1}, {0, 1}, {0, 1}, {0, 1}, {0, 1}, {0, 2}, {0, 2}, {0, 2}, {0, 2}, {0, 2}, {0, 3}, {0, 3}, {0, 3}, {0, 3}, {0, 3}, {0, 4}, {0, 4}, {0, 4}, {0, 4}, {0, 4}}, {{1, 0}, {1, 0}, {1, 0}, {1, 0}, {1, 0}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 2}, {1, 2}, {1, 2}, {1, 2}, {1, 2}, {1, 3}, {1, 3}, {1, 3}, {1, 3}, {1, 3}, {1, 4}, {1, 4}, {1, 4}, {1, 4}, {1, 4}}, {{1, 0}, {1, 0}, {1, 0}, {1, 0}, {1, 0}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 2}, {1, 2}, {1, 2}, {1, 2}, {1, 2}, {1, 3}, {1, 3}, {1, 3}, {1, 3}, {1, 3}, {1, 4}, {1, 4}, {1, 4}, {1, 4}, {1, 4}}, {{1, 0}, {1, 0}, {1, 0}, {1, 0}, {1, 0}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 2}, {1, 2}, {1, 2}, {1, 2}, {1, 2}, {1, 3}, {1, 3}, {1, 3}, {1, 3}, {1, 3}, {1, 4}, {1, 4}, {1, 4}, {1, 4}, {1, 4}}, {{1, 0}, {1, 0}, {1, 0}, {1, 0}, {1, 0}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 2}, {1, 2}, {1, 2}, {1, 2}, {1, 2}, {1, 3}, {1, 3}, {1, 3}, {1, 3}, {1, 3}, {1, 4}, {1, 4}, {1, 4}, {1, 4}, {1, 4}}, {{1, 0}, {1, 0}, {1, 0}, {1, 0}, {1, 0}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 2}, {1, 2}, {1, 2}, {1, 2}, {1, 2}, {1, 3}, {1, 3}, {1, 3}, {1, 3}, {1, 3}, {1, 4}, {1, 4}, {1, 4}, {1, 4}, {1, 4}}, {{2, 0}, {2, 0}, {2, 0}, {2, 0}, {2, 0}, {2, 1}, {2, 1}, {2, 1}, {2, 1}, {2, 1}, {2, 2}, {2, 2}, {2, 2}, {2, 2}, {2, 2}, {2, 3}, {2, 3}, {2, 3}, {2, 3}, {2, 3}, {2, 4}, {2, 4}, {2, 4}, {2, 4}, {2, 4}}, {{2, 0}, {2, 0}, {2, 0}, {2, 0}, {2, 0}, {2, 1}, {2, 1}, {2, 1}, {2, 1}, {2, 1}, {2, 2}, {2, 2}, {2, 2}, {2, 2}, {2, 2}, {2, 3}, {2, 3}, {2, 3}, {2, 3}, {2, 3}, {2, 4}, {2, 4}, {2, 4}, {2, 4}, {2, 4}}, {{2, 0}, {2, 0}, {2, 0}, {2, 0}, {2, 0}, {2, 1}, {2, 1}, {2, 1}, {2, 1}, {2, 1}, {2, 2}, {2, 2}, {2, 2}, {2, 2}, {2, 2}, {2, 3}, {2, 3}, {2, 3}, {2, 3}, {2, 3}, {2, 4}, {2, 4}, {2, 4}, {2, 4}, {2, 4}}, {{2, 0}, {2, 0}, {2, 0}, {2, 0}, {2, 0}, {2, 1}, {2, 1}, {2, 1}, {2, 1}, {2, 1}, {2, 2}, {2, 2}, {2, 2}, {2, 2}, {2, 2}, {2, 3}, {2, 3}, {2, 3}, {2, 3}, {2, 3}, {2, 4}, {2, 4}, {2, 4}, {2, 4}, {2, 4}}, {{2, 0}, {2, 0}, {2, 0}, {2, 0}, {2, 0}, {2, 1}, {2, 1}, {2, 1}, {2, 1}, {2, 1}, {2, 2}, {2, 2}, {2, 2}, {2, 2}, {2, 2}, {2, 3}, {2, 3}, {2, 3}, {2, 3}, {2, 3}, {2, 4}, {2, 4}, {2, 4}, {2, 4}, {2, 4}}, {{3, 0}, {3, 0}, {3, 0}, {3, 0}, {3, 0}, {3, 1}, {3, 1}, {3, 1}, {3, 1}, {3, 1}, {3, 2}, {3, 2}, {3, 2}, {3, 2}, {3, 2}, {3, 3}, {3, 3}, {3, 3}, {3, 3}, {3, 3}, {3, 4}, {3, 4}, {3, 4}, {3, 4}, {3, 4}}, {{3, 0}, {3, 0}, {3, 0}, {3, 0}, {3, 0}, {3, 1}, {3, 1}, {3, 1}, {3, 1}, {3, 1}, {3, 2}, {3, 2}, {3, 2}, {3, 2}, {3, 2}, {3, 3}, {3, 3}, {3, 3}, {3, 3}, {3, 3}, {3, 4}, {3, 4}, {3, 4}, {3, 4}, {3, 4}}, {{3, 0}, {3, 0}, {3, 0}, {3, 0}, {3, 0}, {3, 1}, {3, 1}, {3, 1}, {3, 1}, {3, 1}, {3, 2}, {3, 2}, {3, 2}, {3, 2}, {3, 2}, {3, 3}, {3, 3}, {3, 3}, {3, 3}, {3, 3}, {3, 4}, {3, 4}, {3, 4}, {3, 4}, {3, 4}}, {{3, 0}, {3, 0}, {3, 0}, {3, 0}, {3, 0}, {3, 1}, {3, 1}, {3, 1}, {3, 1}, {3, 1}, {3, 2}, {3, 2}, {3, 2}, {3, 2}, {3, 2}, {3, 3}, {3, 3}, {3, 3}, {3, 3}, {3, 3}, {3, 4}, {3, 4}, {3, 4}, {3, 4}, {3, 4}}, {{3, 0}, {3, 0}, {3, 0}, {3, 0}, {3, 0}, {3, 1}, {3, 1}, {3, 1}, {3, 1}, {3, 1}, {3, 2}, {3, 2}, {3, 2}, {3, 2}, {3, 2}, {3, 3}, {3, 3}, {3, 3}, {3, 3}, {3, 3}, {3, 4}, {3, 4}, {3, 4}, {3, 4}, {3, 4}}, {{4, 0}, {4, 0}, {4, 0}, {4, 0}, {4, 0}, {4, 1}, {4, 1}, {4, 1}, {4, 1}, {4, 1}, {4, 2}, {4, 2}, {4, 2}, {4, 2}, {4, 2}, {4, 3}, {4, 3}, {4, 3}, {4, 3}, {4, 3}, {4, 4}, {4, 4}, {4, 4}, {4, 4}, {4, 4}}, {{4, 0}, {4, 0}, {4, 0}, {4, 0}, {4, 0}, {4, 1}, {4, 1}, {4, 1}, {4, 1}, {4, 1}, {4, 2}, {4, 2}, {4, 2}, {4, 2}, {4, 2}, {4, 3}, {4, 3}, {4, 3}, {4, 3}, {4, 3}, {4, 4}, {4, 4}, {4, 4}, {4, 4}, {4, 4}}, {{4, 0}, {4, 0}, {4, 0}, {4, 0}, {4, 0}, {4, 1}, {4, 1}, {4, 1}, {4, 1}, {4, 1}, {4, 2}, {4, 2}, {4, 2}, {4, 2}, {4, 2}, {4, 3}, {4, 3}, {4, 3}, {4, 3}, {4, 3}, {4, 4}, {4, 4}, {4, 4}, {4, 4}, {4, 4}}, {{4, 0}, {4, 0}, {4, 0}, {4, 0}, {4, 0}, {4, 1}, {4, 1}, {4, 1}, {4, 1}, {4, 1}, {4, 2}, {4, 2}, {4, 2}, {4, 2}, {4, 2}, {4, 3}, {4, 3}, {4, 3}, {4, 3}, {4, 3}, {4, 4}, {4, 4}, {4, 4}, {4, 4}, {4, 4}}, {{4, 0}, {4, 0}, {4, 0}, {4, 0}, {4, 0}, {4, 1}, {4, 1}, {4, 1}, {4, 1}, {4, 1}, {4, 2}, {4, 2}, {4, 2}, {4, 2}, {4, 2}, {4, 3}, {4, 3}, {4, 3}, {4, 3}, {4, 3}, {4, 4}, {4, 4}, {4, 4}, {4, 4}, {4, 4}}}; const unsigned int Indexer::offset_coord_lookup [625][2] = {{0, 0}, {0, 1}, {0, 2}, {0, 3}, {0, 4}, {0, 5}, {0, 6}, {0, 7}, {0, 8}, {0, 9}, {0, 10}, {0, 11}, {0, 12}, {0, 13}, {0, 14}, {0, 15}, {0, 16}, {0, 17}, {0, 18}, {0, 19}, {0, 20}, {0, 21}, {0, 22}, {0, 23}, {0, 24}, {1, 0}, {1, 1}, {1, 2}, {1, 3}, {1, 4}, {1, 5}, {1, 6}, {1, 7}, {1, 8}, {1, 9}, {1, 10}, {1, 11}, {1, 12}, {1, 13}, {1, 14}, {1, 15}, {1, 16}, {1, 17}, {1, 18}, {1, 19}, {1, 20}, {1, 21}, {1, 22}, {1, 23}, {1, 24}, {2, 0}, {2, 1}, {2, 2}, {2, 3}, {2, 4}, {2, 5}, {2, 6}, {2, 7}, {2, 8}, {2, 9}, {2, 10}, {2, 11}, {2, 12}, {2, 13}, {2, 14}, {2, 15}, {2, 16}, {2, 17}, {2, 18}, {2, 19}, {2, 20}, {2, 21}, {2, 22}, {2, 23}, {2, 24}, {3, 0}, {3, 1}, {3, 2}, {3, 3}, {3, 4}, {3, 5}, {3, 6}, {3, 7}, {3, 8}, {3, 9}, {3, 10}, {3, 11}, {3, 12}, {3, 13}, {3, 14}, {3, 15}, {3, 16}, {3, 17}, {3, 18}, {3, 19}, {3, 20}, {3, 21}, {3, 22}, {3, 23}, {3, 24}, {4, 0}, {4, 1}, {4, 2}, {4, 3}, {4, 4}, {4, 5}, {4, 6}, {4, 7}, {4, 8}, {4, 9}, {4, 10}, {4, 11}, {4, 12}, {4, 13}, {4, 14}, {4, 15}, {4, 16}, {4, 17}, {4, 18}, {4, 19}, {4, 20}, {4, 21}, {4, 22}, {4, 23}, {4, 24}, {5, 0}, {5, 1}, {5, 2}, {5, 3}, {5, 4}, {5, 5}, {5, 6}, {5, 7}, {5, 8}, {5, 9}, {5, 10}, {5, 11}, {5, 12}, {5, 13}, {5, 14}, {5, 15}, {5, 16}, {5, 17}, {5, 18}, {5, 19}, {5, 20}, {5, 21}, {5, 22}, {5, 23}, {5, 24}, {6, 0}, {6, 1}, {6, 2}, {6, 3}, {6, 4}, {6, 5}, {6, 6}, {6, 7}, {6, 8}, {6, 9}, {6, 10}, {6, 11}, {6, 12}, {6, 13}, {6, 14}, {6, 15}, {6, 16}, {6, 17}, {6, 18}, {6, 19}, {6, 20}, {6, 21}, {6, 22}, {6, 23}, {6, 24}, {7, 0}, {7, 1}, {7, 2}, {7, 3}, {7, 4}, {7, 5}, {7, 6}, {7, 7}, {7, 8}, {7, 9}, {7, 10}, {7, 11}, {7, 12}, {7, 13}, {7, 14}, {7, 15}, {7, 16}, {7, 17}, {7, 18}, {7, 19}, {7, 20}, {7, 21}, {7, 22}, {7, 23}, {7, 24}, {8, 0}, {8, 1}, {8, 2}, {8, 3}, {8, 4}, {8, 5}, {8, 6}, {8, 7}, {8, 8}, {8, 9}, {8, 10}, {8, 11}, {8, 12}, {8, 13}, {8, 14}, {8, 15}, {8, 16}, {8, 17}, {8, 18}, {8, 19}, {8, 20}, {8, 21}, {8, 22}, {8, 23}, {8, 24}, {9, 0}, {9, 1}, {9, 2}, {9, 3}, {9, 4}, {9, 5}, {9, 6}, {9, 7}, {9, 8}, {9, 9}, {9, 10}, {9, 11}, {9, 12}, {9, 13}, {9, 14}, {9, 15}, {9, 16}, {9, 17}, {9, 18}, {9, 19}, {9, 20}, {9, 21}, {9, 22}, {9, 23}, {9, 24}, {10, 0}, {10, 1}, {10, 2}, {10, 3}, {10, 4}, {10, 5}, {10, 6}, {10, 7}, {10, 8}, {10, 9}, {10, 10}, {10, 11}, {10, 12}, {10, 13}, {10, 14}, {10, 15}, {10, 16}, {10, 17}, {10, 18}, {10, 19}, {10, 20}, {10, 21}, {10, 22}, {10, 23}, {10, 24}, {11, 0}, {11, 1}, {11, 2}, {11, 3}, {11, 4}, {11, 5}, {11, 6}, {11, 7}, {11, 8}, {11, 9}, {11, 10}, {11, 11}, {11, 12}, {11, 13}, {11, 14}, {11, 15}, {11, 16}, {11, 17}, {11, 18}, {11, 19}, {11, 20}, {11, 21}, {11, 22}, {11, 23}, {11, 24}, {12, 0}, {12, 1}, {12, 2}, {12, 3}, {12, 4}, {12, 5}, {12, 6}, {12, 7}, {12, 8}, {12, 9}, {12, 10}, {12, 11}, {12, 12}, {12, 13}, {12, 14}, {12, 15}, {12, 16}, {12, 17}, {12, 18}, {12, 19}, {12, 20}, {12, 21}, {12, 22}, {12, 23}, {12, 24}, {13, 0}, {13, 1}, {13, 2}, {13, 3}, {13, 4}, {13, 5}, {13, 6}, {13, 7}, {13, 8}, {13, 9}, {13, 10}, {13, 11}, {13, 12}, {13, 13}, {13, 14}, {13, 15}, {13, 16}, {13, 17}, {13, 18}, {13, 19}, {13, 20}, {13, 21}, {13, 22}, {13, 23}, {13, 24}, {14, 0}, {14, 1}, {14, 2}, {14, 3}, {14, 4}, {14, 5}, {14, 6}, {14, 7}, {14, 8}, {14, 9}, {14, 10}, {14, 11}, {14, 12}, {14, 13}, {14, 14}, {14, 15}, {14, 16}, {14, 17}, {14, 18}, {14, 19}, {14, 20}, {14, 21}, {14, 22}, {14, 23}, {14, 24}, {15, 0}, {15, 1}, {15, 2}, {15, 3}, {15, 4}, {15, 5}, {15, 6}, {15, 7}, {15, 8}, {15, 9}, {15, 10}, {15, 11}, {15, 12}, {15, 13}, {15, 14}, {15, 15}, {15, 16}, {15, 17}, {15, 18}, {15, 19}, {15, 20}, {15, 21}, {15, 22}, {15, 23}, {15, 24}, {16, 0}, {16, 1}, {16, 2}, {16, 3}, {16, 4}, {16, 5}, {16, 6}, {16, 7}, {16, 8}, {16, 9}, {16, 10}, {16, 11}, {16, 12}, {16, 13}, {16, 14}, {16, 15}, {16, 16}, {16, 17}, {16, 18}, {16, 19}, {16, 20}, {16, 21}, {16, 22}, {16, 23}, {16, 24}, {17, 0}, {17, 1}, {17, 2}, {17, 3}, {17, 4}, {17, 5}, {17, 6}, {17, 7}, {17, 8}, {17, 9}, {17, 10}, {17, 11}, {17, 12}, {17, 13}, {17, 14}, {17, 15}, {17, 16}, {17, 17}, {17, 18}, {17, 19}, {17, 20}, {17, 21}, {17, 22}, {17, 23}, {17, 24}, {18, 0}, {18, 1}, {18, 2}, {18, 3}, {18, 4}, {18, 5}, {18, 6}, {18, 7}, {18, 8}, {18, 9}, {18, 10}, {18, 11}, {18, 12}, {18, 13}, {18, 14}, {18, 15}, {18, 16}, {18, 17}, {18, 18}, {18, 19}, {18, 20}, {18, 21}, {18, 22}, {18, 23}, {18, 24}, {19, 0}, {19, 1}, {19, 2}, {19, 3}, {19, 4}, {19, 5}, {19, 6}, {19, 7}, {19, 8}, {19, 9}, {19, 10}, {19, 11}, {19, 12}, {19, 13}, {19, 14}, {19, 15}, {19, 16}, {19, 17}, {19, 18}, {19, 19}, {19, 20}, {19, 21}, {19, 22}, {19, 23}, {19, 24}, {20, 0}, {20, 1}, {20, 2}, {20, 3}, {20, 4}, {20, 5}, {20, 6}, {20, 7}, {20, 8}, {20, 9}, {20, 10}, {20, 11}, {20, 12}, {20, 13}, {20, 14}, {20, 15}, {20, 16}, {20, 17}, {20, 18}, {20, 19}, {20, 20}, {20, 21}, {20, 22}, {20, 23}, {20, 24}, {21, 0}, {21, 1}, {21, 2}, {21, 3}, {21, 4}, {21, 5}, {21, 6}, {21, 7}, {21, 8}, {21, 9}, {21, 10}, {21, 11}, {21, 12}, {21, 13}, {21, 14}, {21, 15}, {21, 16}, {21, 17}, {21, 18}, {21, 19}, {21, 20}, {21, 21}, {21, 22}, {21, 23}, {21, 24}, {22, 0}, {22, 1}, {22, 2}, {22, 3}, {22, 4}, {22, 5}, {22, 6}, {22, 7}, {22, 8}, {22, 9}, {22, 10}, {22, 11}, {22, 12}, {22, 13}, {22, 14}, {22, 15}, {22, 16}, {22, 17}, {22, 18}, {22, 19}, {22, 20}, {22, 21}, {22, 22}, {22, 23}, {22, 24}, {23, 0}, {23, 1}, {23, 2}, {23, 3}, {23, 4}, {23, 5}, {23, 6}, {23, 7}, {23, 8}, {23, 9}, {23, 10}, {23, 11}, {23, 12}, {23, 13}, {23, 14}, {23, 15}, {23, 16}, {23, 17}, {23, 18}, {23, 19}, {23, 20}, {23, 21}, {23, 22}, {23, 23}, {23, 24}, {24, 0}, {24, 1}, {24, 2}, {24, 3}, {24, 4}, {24, 5}, {24, 6}, {24, 7}, {24, 8}, {24, 9}, {24, 10}, {24, 11}, {24, 12}, {24, 13}, {24, 14}, {24, 15}, {24, 16}, {24, 17}, {24, 18}, {24, 19}, {24, 20}, {24, 21}, {24, 22}, {24, 23}, {24, 24}}; const unsigned int Indexer::coord_offset_lookup [25][25] = {{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24}, {25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49}, {50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74}, {75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99}, {100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124}, {125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149}, {150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174}, {175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199}, {200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224}, {225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249}, {250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274}, {275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299}, {300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324}, {325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349}, {350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374}, {375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399}, {400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424}, {425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449}, {450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474}, {475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499}, {500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524}, {525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549}, {550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574}, {575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599}, {600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624}}; const unsigned int Indexer::row_index [25][25] = {{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24}, {25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49}, {50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74}, {75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99}, {100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124}, {125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149}, {150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174}, {175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199}, {200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224}, {225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249}, {250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274}, {275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299}, {300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324}, {325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349}, {350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374}, {375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399}, {400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424}, {425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449}, {450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474}, {475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499}, {500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524}, {525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549}, {550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574}, {575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599}, {600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624}}; const unsigned int Indexer::col_index [25][25] = {{0, 25, 50, 75, 100, 125, 150, 175, 200, 225, 250, 275, 300, 325, 350, 375, 400, 425, 450, 475, 500, 525, 550, 575, 600}, {1, 26, 51, 76, 101, 126, 151, 176, 201, 226, 251, 276, 301, 326, 351, 376, 401, 426, 451, 476, 501, 526, 551, 576, 601}, {2, 27, 52, 77, 102, 127, 152, 177, 202, 227, 252, 277, 302, 327, 352, 377, 402, 427, 452, 477, 502, 527, 552, 577, 602}, {3, 28, 53, 78, 103, 128, 153, 178, 203, 228, 253, 278, 303, 328, 353, 378, 403, 428, 453, 478, 503, 528, 553, 578, 603}, {4, 29, 54, 79, 104, 129, 154, 179, 204, 229, 254, 279, 304, 329, 354, 379, 404, 429, 454, 479, 504, 529, 554, 579, 604}, {5, 30, 55, 80, 105, 130, 155, 180, 205, 230, 255, 280, 305, 330, 355, 380, 405, 430, 455, 480, 505, 530, 555, 580, 605}, {6, 31, 56, 81, 106, 131, 156, 181, 206, 231, 256, 281, 306, 331, 356, 381, 406, 431, 456, 481, 506, 531, 556, 581, 606}, {7, 32, 57, 82, 107, 132, 157, 182, 207, 232, 257, 282, 307, 332, 357, 382, 407, 432, 457, 482, 507, 532, 557, 582, 607}, {8, 33, 58, 83, 108, 133, 158, 183, 208, 233, 258, 283, 308, 333, 358, 383, 408, 433, 458, 483, 508, 533, 558, 583, 608}, {9, 34, 59, 84, 109, 134, 159, 184, 209, 234, 259, 284, 309, 334, 359, 384, 409, 434, 459, 484, 509, 534, 559, 584, 609}, {10, 35, 60, 85, 110, 135, 160, 185, 210, 235, 260, 285, 310, 335, 360, 385, 410, 435, 460, 485, 510, 535, 560, 585, 610}, {11, 36, 61, 86, 111, 136, 161, 186, 211, 236, 261, 286, 311, 336, 361, 386, 411, 436, 461, 486, 511, 536, 561, 586, 611}, {12, 37, 62, 87, 112, 137, 162, 187, 212, 237, 262, 287, 312, 337, 362, 387, 412, 437, 462, 487, 512, 537, 562, 587, 612}, {13, 38, 63, 88, 113, 138, 163, 188, 213, 238, 263, 288, 313, 338, 363, 388, 413, 438, 463, 488, 513, 538, 563, 588, 613}, {14, 39, 64, 89, 114, 139, 164, 189, 214, 239, 264, 289, 314, 339, 364, 389, 414, 439, 464, 489, 514, 539, 564, 589, 614}, {15, 40, 65, 90, 115, 140, 165, 190, 215, 240, 265, 290, 315, 340, 365, 390, 415, 440, 465, 490, 515, 540, 565, 590, 615}, {16, 41, 66, 91, 116, 141, 166, 191, 216, 241, 266, 291, 316, 341, 366, 391, 416, 441, 466, 491, 516, 541, 566, 591, 616}, {17, 42, 67, 92, 117, 142, 167, 192, 217, 242, 267, 292, 317, 342, 367, 392, 417, 442, 467, 492, 517, 542, 567, 592, 617}, {18, 43, 68, 93, 118, 143, 168, 193, 218, 243, 268, 293, 318, 343, 368, 393, 418, 443, 468, 493, 518, 543, 568, 593, 618}, {19, 44, 69, 94, 119, 144, 169, 194, 219, 244, 269, 294, 319, 344, 369, 394, 419, 444, 469, 494, 519, 544, 569, 594, 619}, {20, 45, 70, 95, 120, 145, 170, 195, 220, 245, 270, 295, 320, 345, 370, 395, 420, 445, 470, 495, 520, 545, 570, 595, 620}, {21, 46, 71, 96, 121, 146, 171, 196, 221, 246, 271, 296, 321, 346, 371, 396, 421, 446, 471, 496, 521, 546, 571, 596, 621}, {22, 47, 72, 97, 122, 147, 172, 197, 222, 247, 272, 297, 322, 347, 372, 397, 422, 447, 472, 497, 522, 547, 572, 597, 622}, {23, 48, 73, 98, 123, 148, 173, 198, 223, 248, 273, 298, 323, 348, 373, 398, 423, 448, 473, 498, 523, 548, 573, 598, 623}, {24, 49, 74, 99, 124, 149, 174, 199, 224, 249, 274, 299, 324, 349, 374, 399, 424, 449, 474, 499, 524, 549, 574, 599, 624}}; const unsigned int Indexer::grid_index [5][5][25] = {{{0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}}, {{125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}}, {{250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}}, {{375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}}, {{500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}}}; const unsigned int Indexer::grid_coord_index [25][25][25] = {{{0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}}, {{0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}}, {{0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}}, {{0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}}, {{0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {0, 1, 2, 3, 4, 25, 26, 27, 28, 29, 50, 51, 52, 53, 54, 75, 76, 77, 78, 79, 100, 101, 102, 103, 104}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {5, 6, 7, 8, 9, 30, 31, 32, 33, 34, 55, 56, 57, 58, 59, 80, 81, 82, 83, 84, 105, 106, 107, 108, 109}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {10, 11, 12, 13, 14, 35, 36, 37, 38, 39, 60, 61, 62, 63, 64, 85, 86, 87, 88, 89, 110, 111, 112, 113, 114}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {15, 16, 17, 18, 19, 40, 41, 42, 43, 44, 65, 66, 67, 68, 69, 90, 91, 92, 93, 94, 115, 116, 117, 118, 119}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}, {20, 21, 22, 23, 24, 45, 46, 47, 48, 49, 70, 71, 72, 73, 74, 95, 96, 97, 98, 99, 120, 121, 122, 123, 124}}, {{125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}}, {{125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}}, {{125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}}, {{125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}}, {{125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {125, 126, 127, 128, 129, 150, 151, 152, 153, 154, 175, 176, 177, 178, 179, 200, 201, 202, 203, 204, 225, 226, 227, 228, 229}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {130, 131, 132, 133, 134, 155, 156, 157, 158, 159, 180, 181, 182, 183, 184, 205, 206, 207, 208, 209, 230, 231, 232, 233, 234}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {135, 136, 137, 138, 139, 160, 161, 162, 163, 164, 185, 186, 187, 188, 189, 210, 211, 212, 213, 214, 235, 236, 237, 238, 239}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {140, 141, 142, 143, 144, 165, 166, 167, 168, 169, 190, 191, 192, 193, 194, 215, 216, 217, 218, 219, 240, 241, 242, 243, 244}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}, {145, 146, 147, 148, 149, 170, 171, 172, 173, 174, 195, 196, 197, 198, 199, 220, 221, 222, 223, 224, 245, 246, 247, 248, 249}}, {{250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}}, {{250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}}, {{250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}}, {{250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}}, {{250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {250, 251, 252, 253, 254, 275, 276, 277, 278, 279, 300, 301, 302, 303, 304, 325, 326, 327, 328, 329, 350, 351, 352, 353, 354}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {255, 256, 257, 258, 259, 280, 281, 282, 283, 284, 305, 306, 307, 308, 309, 330, 331, 332, 333, 334, 355, 356, 357, 358, 359}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {260, 261, 262, 263, 264, 285, 286, 287, 288, 289, 310, 311, 312, 313, 314, 335, 336, 337, 338, 339, 360, 361, 362, 363, 364}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {265, 266, 267, 268, 269, 290, 291, 292, 293, 294, 315, 316, 317, 318, 319, 340, 341, 342, 343, 344, 365, 366, 367, 368, 369}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}, {270, 271, 272, 273, 274, 295, 296, 297, 298, 299, 320, 321, 322, 323, 324, 345, 346, 347, 348, 349, 370, 371, 372, 373, 374}}, {{375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}}, {{375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}}, {{375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}}, {{375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}}, {{375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {375, 376, 377, 378, 379, 400, 401, 402, 403, 404, 425, 426, 427, 428, 429, 450, 451, 452, 453, 454, 475, 476, 477, 478, 479}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {380, 381, 382, 383, 384, 405, 406, 407, 408, 409, 430, 431, 432, 433, 434, 455, 456, 457, 458, 459, 480, 481, 482, 483, 484}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {385, 386, 387, 388, 389, 410, 411, 412, 413, 414, 435, 436, 437, 438, 439, 460, 461, 462, 463, 464, 485, 486, 487, 488, 489}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {390, 391, 392, 393, 394, 415, 416, 417, 418, 419, 440, 441, 442, 443, 444, 465, 466, 467, 468, 469, 490, 491, 492, 493, 494}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}, {395, 396, 397, 398, 399, 420, 421, 422, 423, 424, 445, 446, 447, 448, 449, 470, 471, 472, 473, 474, 495, 496, 497, 498, 499}}, {{500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}}, {{500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}}, {{500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}}, {{500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}}, {{500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {500, 501, 502, 503, 504, 525, 526, 527, 528, 529, 550, 551, 552, 553, 554, 575, 576, 577, 578, 579, 600, 601, 602, 603, 604}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {505, 506, 507, 508, 509, 530, 531, 532, 533, 534, 555, 556, 557, 558, 559, 580, 581, 582, 583, 584, 605, 606, 607, 608, 609}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {510, 511, 512, 513, 514, 535, 536, 537, 538, 539, 560, 561, 562, 563, 564, 585, 586, 587, 588, 589, 610, 611, 612, 613, 614}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {515, 516, 517, 518, 519, 540, 541, 542, 543, 544, 565, 566, 567, 568, 569, 590, 591, 592, 593, 594, 615, 616, 617, 618, 619}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}, {520, 521, 522, 523, 524, 545, 546, 547, 548, 549, 570, 571, 572, 573, 574, 595, 596, 597, 598, 599, 620, 621, 622, 623, 624}}}; const unsigned int Indexer::neighbor_index [25][25][64] = {{{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 50, 75, 100, 125, 150, 175, 200, 225, 250, 275, 300, 325, 350, 375, 400, 425, 450, 475, 500, 525, 550, 575, 600, 26, 27, 28, 29, 51, 52, 53, 54, 76, 77, 78, 79, 101, 102, 103, 104}, {0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 26, 51, 76, 101, 126, 151, 176, 201, 226, 251, 276, 301, 326, 351, 376, 401, 426, 451, 476, 501, 526, 551, 576, 601, 25, 27, 28, 29, 50, 52, 53, 54, 75, 77, 78, 79, 100, 102, 103, 104}, {0, 1, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 27, 52, 77, 102, 127, 152, 177, 202, 227, 252, 277, 302, 327, 352, 377, 402, 427, 452, 477, 502, 527, 552, 577, 602, 25, 26, 28, 29, 50, 51, 53, 54, 75, 76, 78, 79, 100, 101, 103, 104}, {0, 1, 2, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 28, 53, 78, 103, 128, 153, 178, 203, 228, 253, 278, 303, 328, 353, 378, 403, 428, 453, 478, 503, 528, 553, 578, 603, 25, 26, 27, 29, 50, 51, 52, 54, 75, 76, 77, 79, 100, 101, 102, 104}, {0, 1, 2, 3, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 29, 54, 79, 104, 129, 154, 179, 204, 229, 254, 279, 304, 329, 354, 379, 404, 429, 454, 479, 504, 529, 554, 579, 604, 25, 26, 27, 28, 50, 51, 52, 53, 75, 76, 77, 78, 100, 101, 102, 103}, {0, 1, 2, 3, 4, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 30, 55, 80, 105, 130, 155, 180, 205, 230, 255, 280, 305, 330, 355, 380, 405, 430, 455, 480, 505, 530, 555, 580, 605, 31, 32, 33, 34, 56, 57, 58, 59, 81, 82, 83, 84, 106, 107, 108, 109}, {0, 1, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 31, 56, 81, 106, 131, 156, 181, 206, 231, 256, 281, 306, 331, 356, 381, 406, 431, 456, 481, 506, 531, 556, 581, 606, 30, 32, 33, 34, 55, 57, 58, 59, 80, 82, 83, 84, 105, 107, 108, 109}, {0, 1, 2, 3, 4, 5, 6, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 32, 57, 82, 107, 132, 157, 182, 207, 232, 257, 282, 307, 332, 357, 382, 407, 432, 457, 482, 507, 532, 557, 582, 607, 30, 31, 33, 34, 55, 56, 58, 59, 80, 81, 83, 84, 105, 106, 108, 109}, {0, 1, 2, 3, 4, 5, 6, 7, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 33, 58, 83, 108, 133, 158, 183, 208, 233, 258, 283, 308, 333, 358, 383, 408, 433, 458, 483, 508, 533, 558, 583, 608, 30, 31, 32, 34, 55, 56, 57, 59, 80, 81, 82, 84, 105, 106, 107, 109}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 34, 59, 84, 109, 134, 159, 184, 209, 234, 259, 284, 309, 334, 359, 384, 409, 434, 459, 484, 509, 534, 559, 584, 609, 30, 31, 32, 33, 55, 56, 57, 58, 80, 81, 82, 83, 105, 106, 107, 108}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 35, 60, 85, 110, 135, 160, 185, 210, 235, 260, 285, 310, 335, 360, 385, 410, 435, 460, 485, 510, 535, 560, 585, 610, 36, 37, 38, 39, 61, 62, 63, 64, 86, 87, 88, 89, 111, 112, 113, 114}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 36, 61, 86, 111, 136, 161, 186, 211, 236, 261, 286, 311, 336, 361, 386, 411, 436, 461, 486, 511, 536, 561, 586, 611, 35, 37, 38, 39, 60, 62, 63, 64, 85, 87, 88, 89, 110, 112, 113, 114}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 37, 62, 87, 112, 137, 162, 187, 212, 237, 262, 287, 312, 337, 362, 387, 412, 437, 462, 487, 512, 537, 562, 587, 612, 35, 36, 38, 39, 60, 61, 63, 64, 85, 86, 88, 89, 110, 111, 113, 114}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 38, 63, 88, 113, 138, 163, 188, 213, 238, 263, 288, 313, 338, 363, 388, 413, 438, 463, 488, 513, 538, 563, 588, 613, 35, 36, 37, 39, 60, 61, 62, 64, 85, 86, 87, 89, 110, 111, 112, 114}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 39, 64, 89, 114, 139, 164, 189, 214, 239, 264, 289, 314, 339, 364, 389, 414, 439, 464, 489, 514, 539, 564, 589, 614, 35, 36, 37, 38, 60, 61, 62, 63, 85, 86, 87, 88, 110, 111, 112, 113}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 18, 19, 20, 21, 22, 23, 24, 40, 65, 90, 115, 140, 165, 190, 215, 240, 265, 290, 315, 340, 365, 390, 415, 440, 465, 490, 515, 540, 565, 590, 615, 41, 42, 43, 44, 66, 67, 68, 69, 91, 92, 93, 94, 116, 117, 118, 119}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 17, 18, 19, 20, 21, 22, 23, 24, 41, 66, 91, 116, 141, 166, 191, 216, 241, 266, 291, 316, 341, 366, 391, 416, 441, 466, 491, 516, 541, 566, 591, 616, 40, 42, 43, 44, 65, 67, 68, 69, 90, 92, 93, 94, 115, 117, 118, 119}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 18, 19, 20, 21, 22, 23, 24, 42, 67, 92, 117, 142, 167, 192, 217, 242, 267, 292, 317, 342, 367, 392, 417, 442, 467, 492, 517, 542, 567, 592, 617, 40, 41, 43, 44, 65, 66, 68, 69, 90, 91, 93, 94, 115, 116, 118, 119}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 19, 20, 21, 22, 23, 24, 43, 68, 93, 118, 143, 168, 193, 218, 243, 268, 293, 318, 343, 368, 393, 418, 443, 468, 493, 518, 543, 568, 593, 618, 40, 41, 42, 44, 65, 66, 67, 69, 90, 91, 92, 94, 115, 116, 117, 119}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 20, 21, 22, 23, 24, 44, 69, 94, 119, 144, 169, 194, 219, 244, 269, 294, 319, 344, 369, 394, 419, 444, 469, 494, 519, 544, 569, 594, 619, 40, 41, 42, 43, 65, 66, 67, 68, 90, 91, 92, 93, 115, 116, 117, 118}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 21, 22, 23, 24, 45, 70, 95, 120, 145, 170, 195, 220, 245, 270, 295, 320, 345, 370, 395, 420, 445, 470, 495, 520, 545, 570, 595, 620, 46, 47, 48, 49, 71, 72, 73, 74, 96, 97, 98, 99, 121, 122, 123, 124}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 22, 23, 24, 46, 71, 96, 121, 146, 171, 196, 221, 246, 271, 296, 321, 346, 371, 396, 421, 446, 471, 496, 521, 546, 571, 596, 621, 45, 47, 48, 49, 70, 72, 73, 74, 95, 97, 98, 99, 120, 122, 123, 124}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 23, 24, 47, 72, 97, 122, 147, 172, 197, 222, 247, 272, 297, 322, 347, 372, 397, 422, 447, 472, 497, 522, 547, 572, 597, 622, 45, 46, 48, 49, 70, 71, 73, 74, 95, 96, 98, 99, 120, 121, 123, 124}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 24, 48, 73, 98, 123, 148, 173, 198, 223, 248, 273, 298, 323, 348, 373, 398, 423, 448, 473, 498, 523, 548, 573, 598, 623, 45, 46, 47, 49, 70, 71, 72, 74, 95, 96, 97, 99, 120, 121, 122, 124}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 49, 74, 99, 124, 149, 174, 199, 224, 249, 274, 299, 324, 349, 374, 399, 424, 449, 474, 499, 524, 549, 574, 599, 624, 45, 46, 47, 48, 70, 71, 72, 73, 95, 96, 97, 98, 120, 121, 122, 123}}, {{26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 0, 50, 75, 100, 125, 150, 175, 200, 225, 250, 275, 300, 325, 350, 375, 400, 425, 450, 475, 500, 525, 550, 575, 600, 1, 2, 3, 4, 51, 52, 53, 54, 76, 77, 78, 79, 101, 102, 103, 104}, {25, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 1, 51, 76, 101, 126, 151, 176, 201, 226, 251, 276, 301, 326, 351, 376, 401, 426, 451, 476, 501, 526, 551, 576, 601, 0, 2, 3, 4, 50, 52, 53, 54, 75, 77, 78, 79, 100, 102, 103, 104}, {25, 26, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 2, 52, 77, 102, 127, 152, 177, 202, 227, 252, 277, 302, 327, 352, 377, 402, 427, 452, 477, 502, 527, 552, 577, 602, 0, 1, 3, 4, 50, 51, 53, 54, 75, 76, 78, 79, 100, 101, 103, 104}, {25, 26, 27, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 3, 53, 78, 103, 128, 153, 178, 203, 228, 253, 278, 303, 328, 353, 378, 403, 428, 453, 478, 503, 528, 553, 578, 603, 0, 1, 2, 4, 50, 51, 52, 54, 75, 76, 77, 79, 100, 101, 102, 104}, {25, 26, 27, 28, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 4, 54, 79, 104, 129, 154, 179, 204, 229, 254, 279, 304, 329, 354, 379, 404, 429, 454, 479, 504, 529, 554, 579, 604, 0, 1, 2, 3, 50, 51, 52, 53, 75, 76, 77, 78, 100, 101, 102, 103}, {25, 26, 27, 28, 29, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 5, 55, 80, 105, 130, 155, 180, 205, 230, 255, 280, 305, 330, 355, 380, 405, 430, 455, 480, 505, 530, 555, 580, 605, 6, 7, 8, 9, 56, 57, 58, 59, 81, 82, 83, 84, 106, 107, 108, 109}, {25, 26, 27, 28, 29, 30, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 6, 56, 81, 106, 131, 156, 181, 206, 231, 256, 281, 306, 331, 356, 381, 406, 431, 456, 481, 506, 531, 556, 581, 606, 5, 7, 8, 9, 55, 57, 58, 59, 80, 82, 83, 84, 105, 107, 108, 109}, {25, 26, 27, 28, 29, 30, 31, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 7, 57, 82, 107, 132, 157, 182, 207, 232, 257, 282, 307, 332, 357, 382, 407, 432, 457, 482, 507, 532, 557, 582, 607, 5, 6, 8, 9, 55, 56, 58, 59, 80, 81, 83, 84, 105, 106, 108, 109}, {25, 26, 27, 28, 29, 30, 31, 32, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 8, 58, 83, 108, 133, 158, 183, 208, 233, 258, 283, 308, 333, 358, 383, 408, 433, 458, 483, 508, 533, 558, 583, 608, 5, 6, 7, 9, 55, 56, 57, 59, 80, 81, 82, 84, 105, 106, 107, 109}, {25, 26, 27, 28, 29, 30, 31, 32, 33, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 9, 59, 84, 109, 134, 159, 184, 209, 234, 259, 284, 309, 334, 359, 384, 409, 434, 459, 484, 509, 534, 559, 584, 609, 5, 6, 7, 8, 55, 56, 57, 58, 80, 81, 82, 83, 105, 106, 107, 108}, {25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 10, 60, 85, 110, 135, 160, 185, 210, 235, 260, 285, 310, 335, 360, 385, 410, 435, 460, 485, 510, 535, 560, 585, 610, 11, 12, 13, 14, 61, 62, 63, 64, 86, 87, 88, 89, 111, 112, 113, 114}, {25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 11, 61, 86, 111, 136, 161, 186, 211, 236, 261, 286, 311, 336, 361, 386, 411, 436, 461, 486, 511, 536, 561, 586, 611, 10, 12, 13, 14, 60, 62, 63, 64, 85, 87, 88, 89, 110, 112, 113, 114}, {25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 12, 62, 87, 112, 137, 162, 187, 212, 237, 262, 287, 312, 337, 362, 387, 412, 437, 462, 487, 512, 537, 562, 587, 612, 10, 11, 13, 14, 60, 61, 63, 64, 85, 86, 88, 89, 110, 111, 113, 114}, {25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 13, 63, 88, 113, 138, 163, 188, 213, 238, 263, 288, 313, 338, 363, 388, 413, 438, 463, 488, 513, 538, 563, 588, 613, 10, 11, 12, 14, 60, 61, 62, 64, 85, 86, 87, 89, 110, 111, 112, 114}, {25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 14, 64, 89, 114, 139, 164, 189, 214, 239, 264, 289, 314, 339, 364, 389, 414, 439, 464, 489, 514, 539, 564, 589, 614, 10, 11, 12, 13, 60, 61, 62, 63, 85, 86, 87, 88, 110, 111, 112, 113}, {25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 41, 42, 43, 44, 45, 46, 47, 48, 49, 15, 65, 90, 115, 140, 165, 190, 215, 240, 265, 290, 315, 340, 365, 390, 415, 440, 465, 490, 515, 540, 565, 590, 615, 16, 17, 18, 19, 66, 67, 68, 69, 91, 92, 93, 94, 116, 117, 118, 119}, {25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 42, 43, 44, 45, 46, 47, 48, 49, 16, 66, 91, 116, 141, 166, 191, 216, 241, 266, 291, 316, 341, 366, 391, 416, 441, 466, 491, 516, 541, 566, 591, 616, 15, 17, 18, 19, 65, 67, 68, 69, 90, 92, 93, 94, 115, 117, 118, 119}, {25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 43, 44, 45, 46, 47, 48, 49, 17, 67, 92, 117, 142, 167, 192, 217, 242, 267, 292, 317, 342, 367, 392, 417, 442, 467, 492, 517, 542, 567, 592, 617, 15, 16, 18, 19, 65, 66, 68, 69, 90, 91, 93, 94, 115, 116, 118, 119}, {25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 44, 45, 46, 47, 48, 49, 18, 68, 93, 118, 143, 168, 193, 218, 243, 268, 293, 318, 343, 368, 393, 418, 443, 468, 493, 518, 543, 568, 593, 618, 15, 16, 17, 19, 65, 66, 67, 69, 90, 91, 92, 94, 115, 116, 117, 119}, {25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 45, 46, 47, 48, 49, 19, 69, 94, 119, 144, 169, 194, 219, 244, 269, 294, 319, 344, 369, 394, 419, 444, 469, 494, 519, 544, 569, 594, 619, 15, 16, 17, 18, 65, 66, 67, 68, 90, 91, 92, 93, 115, 116, 117, 118}, {25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 46, 47, 48, 49, 20, 70, 95, 120, 145, 170, 195, 220, 245, 270, 295, 320, 345, 370, 395, 420, 445, 470, 495, 520, 545, 570, 595, 620, 21, 22, 23, 24, 71, 72, 73, 74, 96, 97, 98, 99, 121, 122, 123, 124}, {25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 47, 48, 49, 21, 71, 96, 121, 146, 171, 196, 221, 246, 271, 296, 321, 346, 371, 396, 421, 446, 471, 496, 521, 546, 571, 596, 621, 20, 22, 23, 24, 70, 72, 73, 74, 95, 97, 98, 99, 120, 122, 123, 124}, {25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 48, 49, 22, 72, 97, 122, 147, 172, 197, 222, 247, 272, 297, 322, 347, 372, 397, 422, 447, 472, 497, 522, 547, 572, 597, 622, 20, 21, 23, 24, 70, 71, 73, 74, 95, 96, 98, 99, 120, 121, 123, 124}, {25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 49, 23, 73, 98, 123, 148, 173, 198, 223, 248, 273, 298, 323, 348, 373, 398, 423, 448, 473, 498, 523, 548, 573, 598, 623, 20, 21, 22, 24, 70, 71, 72, 74, 95, 96, 97, 99, 120, 121, 122, 124}, {25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 24, 74, 99, 124, 149, 174, 199, 224, 249, 274, 299, 324, 349, 374, 399, 424, 449, 474, 499, 524, 549, 574, 599, 624, 20, 21, 22, 23, 70, 71, 72, 73, 95, 96, 97, 98, 120, 121, 122, 123}}, {{51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 0, 25, 75, 100, 125, 150, 175, 200, 225, 250, 275, 300, 325, 350, 375, 400, 425, 450, 475, 500, 525, 550, 575, 600, 1, 2, 3, 4, 26, 27, 28, 29, 76, 77, 78, 79, 101, 102, 103, 104}, {50, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 1, 26, 76, 101, 126, 151, 176, 201, 226, 251, 276, 301, 326, 351, 376, 401, 426, 451, 476, 501, 526, 551, 576, 601, 0, 2, 3, 4, 25, 27, 28, 29, 75, 77, 78, 79, 100, 102, 103, 104}, {50, 51, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 2, 27, 77, 102, 127, 152, 177, 202, 227, 252, 277, 302, 327, 352, 377, 402, 427, 452, 477, 502, 527, 552, 577, 602, 0, 1, 3, 4, 25, 26, 28, 29, 75, 76, 78, 79, 100, 101, 103, 104}, {50, 51, 52, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 3, 28, 78, 103, 128, 153, 178, 203, 228, 253, 278, 303, 328, 353, 378, 403, 428, 453, 478, 503, 528, 553, 578, 603, 0, 1, 2, 4, 25, 26, 27, 29, 75, 76, 77, 79, 100, 101, 102, 104}, {50, 51, 52, 53, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 4, 29, 79, 104, 129, 154, 179, 204, 229, 254, 279, 304, 329, 354, 379, 404, 429, 454, 479, 504, 529, 554, 579, 604, 0, 1, 2, 3, 25, 26, 27, 28, 75, 76, 77, 78, 100, 101, 102, 103}, {50, 51, 52, 53, 54, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 5, 30, 80, 105, 130, 155, 180, 205, 230, 255, 280, 305, 330, 355, 380, 405, 430, 455, 480, 505, 530, 555, 580, 605, 6, 7, 8, 9, 31, 32, 33, 34, 81, 82, 83, 84, 106, 107, 108, 109}, {50, 51, 52, 53, 54, 55, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 6, 31, 81, 106, 131, 156, 181, 206, 231, 256, 281, 306, 331, 356, 381, 406, 431, 456, 481, 506, 531, 556, 581, 606, 5, 7, 8, 9, 30, 32, 33, 34, 80, 82, 83, 84, 105, 107, 108, 109}, {50, 51, 52, 53, 54, 55, 56, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 7, 32, 82, 107, 132, 157, 182, 207, 232, 257, 282, 307, 332, 357, 382, 407, 432, 457, 482, 507, 532, 557, 582, 607, 5, 6, 8, 9, 30, 31, 33, 34, 80, 81, 83, 84, 105, 106, 108, 109}, {50, 51, 52, 53, 54, 55, 56, 57, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 8, 33, 83, 108, 133, 158, 183, 208, 233, 258, 283, 308, 333, 358, 383, 408, 433, 458, 483, 508, 533, 558, 583, 608, 5, 6, 7, 9, 30, 31, 32, 34, 80, 81, 82, 84, 105, 106, 107, 109}, {50, 51, 52, 53, 54, 55, 56, 57, 58, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 9, 34, 84, 109, 134, 159, 184, 209, 234, 259, 284, 309, 334, 359, 384, 409, 434, 459, 484, 509, 534, 559, 584, 609, 5, 6, 7, 8, 30, 31, 32, 33, 80, 81, 82, 83, 105, 106, 107, 108}, {50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 10, 35, 85, 110, 135, 160, 185, 210, 235, 260, 285, 310, 335, 360, 385, 410, 435, 460, 485, 510, 535, 560, 585, 610, 11, 12, 13, 14, 36, 37, 38, 39, 86, 87, 88, 89, 111, 112, 113, 114}, {50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 11, 36, 86, 111, 136, 161, 186, 211, 236, 261, 286, 311, 336, 361, 386, 411, 436, 461, 486, 511, 536, 561, 586, 611, 10, 12, 13, 14, 35, 37, 38, 39, 85, 87, 88, 89, 110, 112, 113, 114}, {50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 12, 37, 87, 112, 137, 162, 187, 212, 237, 262, 287, 312, 337, 362, 387, 412, 437, 462, 487, 512, 537, 562, 587, 612, 10, 11, 13, 14, 35, 36, 38, 39, 85, 86, 88, 89, 110, 111, 113, 114}, {50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 13, 38, 88, 113, 138, 163, 188, 213, 238, 263, 288, 313, 338, 363, 388, 413, 438, 463, 488, 513, 538, 563, 588, 613, 10, 11, 12, 14, 35, 36, 37, 39, 85, 86, 87, 89, 110, 111, 112, 114}, {50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 14, 39, 89, 114, 139, 164, 189, 214, 239, 264, 289, 314, 339, 364, 389, 414, 439, 464, 489, 514, 539, 564, 589, 614, 10, 11, 12, 13, 35, 36, 37, 38, 85, 86, 87, 88, 110, 111, 112, 113}, {50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 66, 67, 68, 69, 70, 71, 72, 73, 74, 15, 40, 90, 115, 140, 165, 190, 215, 240, 265, 290, 315, 340, 365, 390, 415, 440, 465, 490, 515, 540, 565, 590, 615, 16, 17, 18, 19, 41, 42, 43, 44, 91, 92, 93, 94, 116, 117, 118, 119}, {50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 67, 68, 69, 70, 71, 72, 73, 74, 16, 41, 91, 116, 141, 166, 191, 216, 241, 266, 291, 316, 341, 366, 391, 416, 441, 466, 491, 516, 541, 566, 591, 616, 15, 17, 18, 19, 40, 42, 43, 44, 90, 92, 93, 94, 115, 117, 118, 119}, {50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 68, 69, 70, 71, 72, 73, 74, 17, 42, 92, 117, 142, 167, 192, 217, 242, 267, 292, 317, 342, 367, 392, 417, 442, 467, 492, 517, 542, 567, 592, 617, 15, 16, 18, 19, 40, 41, 43, 44, 90, 91, 93, 94, 115, 116, 118, 119}, {50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 69, 70, 71, 72, 73, 74, 18, 43, 93, 118, 143, 168, 193, 218, 243, 268, 293, 318, 343, 368, 393, 418, 443, 468, 493, 518, 543, 568, 593, 618, 15, 16, 17, 19, 40, 41, 42, 44, 90, 91, 92, 94, 115, 116, 117, 119}, {50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 70, 71, 72, 73, 74, 19, 44, 94, 119, 144, 169, 194, 219, 244, 269, 294, 319, 344, 369, 394, 419, 444, 469, 494, 519, 544, 569, 594, 619, 15, 16, 17, 18, 40, 41, 42, 43, 90, 91, 92, 93, 115, 116, 117, 118}, {50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 71, 72, 73, 74, 20, 45, 95, 120, 145, 170, 195, 220, 245, 270, 295, 320, 345, 370, 395, 420, 445, 470, 495, 520, 545, 570, 595, 620, 21, 22, 23, 24, 46, 47, 48, 49, 96, 97, 98, 99, 121, 122, 123, 124}, {50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 72, 73, 74, 21, 46, 96, 121, 146, 171, 196, 221, 246, 271, 296, 321, 346, 371, 396, 421, 446, 471, 496, 521, 546, 571, 596, 621, 20, 22, 23, 24, 45, 47, 48, 49, 95, 97, 98, 99, 120, 122, 123, 124}, {50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 73, 74, 22, 47, 97, 122, 147, 172, 197, 222, 247, 272, 297, 322, 347, 372, 397, 422, 447, 472, 497, 522, 547, 572, 597, 622, 20, 21, 23, 24, 45, 46, 48, 49, 95, 96, 98, 99, 120, 121, 123, 124}, {50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 74, 23, 48, 98, 123, 148, 173, 198, 223, 248, 273, 298, 323, 348, 373, 398, 423, 448, 473, 498, 523, 548, 573, 598, 623, 20, 21, 22, 24, 45, 46, 47, 49, 95, 96, 97, 99, 120, 121, 122, 124}, {50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 24, 49, 99, 124, 149, 174, 199, 224, 249, 274, 299, 324, 349, 374, 399, 424, 449, 474, 499, 524, 549, 574, 599, 624, 20, 21, 22, 23, 45, 46, 47, 48, 95, 96, 97, 98, 120, 121, 122, 123}}, {{76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 0, 25, 50, 100, 125, 150, 175, 200, 225, 250, 275, 300, 325, 350, 375, 400, 425, 450, 475, 500, 525, 550, 575, 600, 1, 2, 3, 4, 26, 27, 28, 29, 51, 52, 53, 54, 101, 102, 103, 104}, {75, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 1, 26, 51, 101, 126, 151, 176, 201, 226, 251, 276, 301, 326, 351, 376, 401, 426, 451, 476, 501, 526, 551, 576, 601, 0, 2, 3, 4, 25, 27, 28, 29, 50, 52, 53, 54, 100, 102, 103, 104}, {75, 76, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 2, 27, 52, 102, 127, 152, 177, 202, 227, 252, 277, 302, 327, 352, 377, 402, 427, 452, 477, 502, 527, 552, 577, 602, 0, 1, 3, 4, 25, 26, 28, 29, 50, 51, 53, 54, 100, 101, 103, 104}, {75, 76, 77, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 3, 28, 53, 103, 128, 153, 178, 203, 228, 253, 278, 303, 328, 353, 378, 403, 428, 453, 478, 503, 528, 553, 578, 603, 0, 1, 2, 4, 25, 26, 27, 29, 50, 51, 52, 54, 100, 101, 102, 104}, {75, 76, 77, 78, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 4, 29, 54, 104, 129, 154, 179, 204, 229, 254, 279, 304, 329, 354, 379, 404, 429, 454, 479, 504, 529, 554, 579, 604, 0, 1, 2, 3, 25, 26, 27, 28, 50, 51, 52, 53, 100, 101, 102, 103}, {75, 76, 77, 78, 79, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 5, 30, 55, 105, 130, 155, 180, 205, 230, 255, 280, 305, 330, 355, 380, 405, 430, 455, 480, 505, 530, 555, 580, 605, 6, 7, 8, 9, 31, 32, 33, 34, 56, 57, 58, 59, 106, 107, 108, 109}, {75, 76, 77, 78, 79, 80, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 6, 31, 56, 106, 131, 156, 181, 206, 231, 256, 281, 306, 331, 356, 381, 406, 431, 456, 481, 506, 531, 556, 581, 606, 5, 7, 8, 9, 30, 32, 33, 34, 55, 57, 58, 59, 105, 107, 108, 109}, {75, 76, 77, 78, 79, 80, 81, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 7, 32, 57, 107, 132, 157, 182, 207, 232, 257, 282, 307, 332, 357, 382, 407, 432, 457, 482, 507, 532, 557, 582, 607, 5, 6, 8, 9, 30, 31, 33, 34, 55, 56, 58, 59, 105, 106, 108, 109}, {75, 76, 77, 78, 79, 80, 81, 82, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 8, 33, 58, 108, 133, 158, 183, 208, 233, 258, 283, 308, 333, 358, 383, 408, 433, 458, 483, 508, 533, 558, 583, 608, 5, 6, 7, 9, 30, 31, 32, 34, 55, 56, 57, 59, 105, 106, 107, 109}, {75, 76, 77, 78, 79, 80, 81, 82, 83, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 9, 34, 59, 109, 134, 159, 184, 209, 234, 259, 284, 309, 334, 359, 384, 409, 434, 459, 484, 509, 534, 559, 584, 609, 5, 6, 7, 8, 30, 31, 32, 33, 55, 56, 57, 58, 105, 106, 107, 108}, {75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 10, 35, 60, 110, 135, 160, 185, 210, 235, 260, 285, 310, 335, 360, 385, 410, 435, 460, 485, 510, 535, 560, 585, 610, 11, 12, 13, 14, 36, 37, 38, 39, 61, 62, 63, 64, 111, 112, 113, 114}, {75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 11, 36, 61, 111, 136, 161, 186, 211, 236, 261, 286, 311, 336, 361, 386, 411, 436, 461, 486, 511, 536, 561, 586, 611, 10, 12, 13, 14, 35, 37, 38, 39, 60, 62, 63, 64, 110, 112, 113, 114}, {75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 12, 37, 62, 112, 137, 162, 187, 212, 237, 262, 287, 312, 337, 362, 387, 412, 437, 462, 487, 512, 537, 562, 587, 612, 10, 11, 13, 14, 35, 36, 38, 39, 60, 61, 63, 64, 110, 111, 113, 114}, {75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 13, 38, 63, 113, 138, 163, 188, 213, 238, 263, 288, 313, 338, 363, 388, 413, 438, 463, 488, 513, 538, 563, 588, 613, 10, 11, 12, 14, 35, 36, 37, 39, 60, 61, 62, 64, 110, 111, 112, 114}, {75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 14, 39, 64, 114, 139, 164, 189, 214, 239, 264, 289, 314, 339, 364, 389, 414, 439, 464, 489, 514, 539, 564, 589, 614, 10, 11, 12, 13, 35, 36, 37, 38, 60, 61, 62, 63, 110, 111, 112, 113}, {75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 91, 92, 93, 94, 95, 96, 97, 98, 99, 15, 40, 65, 115, 140, 165, 190, 215, 240, 265, 290, 315, 340, 365, 390, 415, 440, 465, 490, 515, 540, 565, 590, 615, 16, 17, 18, 19, 41, 42, 43, 44, 66, 67, 68, 69, 116, 117, 118, 119}, {75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 92, 93, 94, 95, 96, 97, 98, 99, 16, 41, 66, 116, 141, 166, 191, 216, 241, 266, 291, 316, 341, 366, 391, 416, 441, 466, 491, 516, 541, 566, 591, 616, 15, 17, 18, 19, 40, 42, 43, 44, 65, 67, 68, 69, 115, 117, 118, 119}, {75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 93, 94, 95, 96, 97, 98, 99, 17, 42, 67, 117, 142, 167, 192, 217, 242, 267, 292, 317, 342, 367, 392, 417, 442, 467, 492, 517, 542, 567, 592, 617, 15, 16, 18, 19, 40, 41, 43, 44, 65, 66, 68, 69, 115, 116, 118, 119}, {75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 94, 95, 96, 97, 98, 99, 18, 43, 68, 118, 143, 168, 193, 218, 243, 268, 293, 318, 343, 368, 393, 418, 443, 468, 493, 518, 543, 568, 593, 618, 15, 16, 17, 19, 40, 41, 42, 44, 65, 66, 67, 69, 115, 116, 117, 119}, {75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 95, 96, 97, 98, 99, 19, 44, 69, 119, 144, 169, 194, 219, 244, 269, 294, 319, 344, 369, 394, 419, 444, 469, 494, 519, 544, 569, 594, 619, 15, 16, 17, 18, 40, 41, 42, 43, 65, 66, 67, 68, 115, 116, 117, 118}, {75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 96, 97, 98, 99, 20, 45, 70, 120, 145, 170, 195, 220, 245, 270, 295, 320, 345, 370, 395, 420, 445, 470, 495, 520, 545, 570, 595, 620, 21, 22, 23, 24, 46, 47, 48, 49, 71, 72, 73, 74, 121, 122, 123, 124}, {75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 97, 98, 99, 21, 46, 71, 121, 146, 171, 196, 221, 246, 271, 296, 321, 346, 371, 396, 421, 446, 471, 496, 521, 546, 571, 596, 621, 20, 22, 23, 24, 45, 47, 48, 49, 70, 72, 73, 74, 120, 122, 123, 124}, {75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 98, 99, 22, 47, 72, 122, 147, 172, 197, 222, 247, 272, 297, 322, 347, 372, 397, 422, 447, 472, 497, 522, 547, 572, 597, 622, 20, 21, 23, 24, 45, 46, 48, 49, 70, 71, 73, 74, 120, 121, 123, 124}, {75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 99, 23, 48, 73, 123, 148, 173, 198, 223, 248, 273, 298, 323, 348, 373, 398, 423, 448, 473, 498, 523, 548, 573, 598, 623, 20, 21, 22, 24, 45, 46, 47, 49, 70, 71, 72, 74, 120, 121, 122, 124}, {75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 24, 49, 74, 124, 149, 174, 199, 224, 249, 274, 299, 324, 349, 374, 399, 424, 449, 474, 499, 524, 549, 574, 599, 624, 20, 21, 22, 23, 45, 46, 47, 48, 70, 71, 72, 73, 120, 121, 122, 123}}, {{101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 0, 25, 50, 75, 125, 150, 175, 200, 225, 250, 275, 300, 325, 350, 375, 400, 425, 450, 475, 500, 525, 550, 575, 600, 1, 2, 3, 4, 26, 27, 28, 29, 51, 52, 53, 54, 76, 77, 78, 79}, {100, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 1, 26, 51, 76, 126, 151, 176, 201, 226, 251, 276, 301, 326, 351, 376, 401, 426, 451, 476, 501, 526, 551, 576, 601, 0, 2, 3, 4, 25, 27, 28, 29, 50, 52, 53, 54, 75, 77, 78, 79}, {100, 101, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 2, 27, 52, 77, 127, 152, 177, 202, 227, 252, 277, 302, 327, 352, 377, 402, 427, 452, 477, 502, 527, 552, 577, 602, 0, 1, 3, 4, 25, 26, 28, 29, 50, 51, 53, 54, 75, 76, 78, 79}, {100, 101, 102, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 3, 28, 53, 78, 128, 153, 178, 203, 228, 253, 278, 303, 328, 353, 378, 403, 428, 453, 478, 503, 528, 553, 578, 603, 0, 1, 2, 4, 25, 26, 27, 29, 50, 51, 52, 54, 75, 76, 77, 79}, {100, 101, 102, 103, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 4, 29, 54, 79, 129, 154, 179, 204, 229, 254, 279, 304, 329, 354, 379, 404, 429, 454, 479, 504, 529, 554, 579, 604, 0, 1, 2, 3, 25, 26, 27, 28, 50, 51, 52, 53, 75, 76, 77, 78}, {100, 101, 102, 103, 104, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 5, 30, 55, 80, 130, 155, 180, 205, 230, 255, 280, 305, 330, 355, 380, 405, 430, 455, 480, 505, 530, 555, 580, 605, 6, 7, 8, 9, 31, 32, 33, 34, 56, 57, 58, 59, 81, 82, 83, 84}, {100, 101, 102, 103, 104, 105, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 6, 31, 56, 81, 131, 156, 181, 206, 231, 256, 281, 306, 331, 356, 381, 406, 431, 456, 481, 506, 531, 556, 581, 606, 5, 7, 8, 9, 30, 32, 33, 34, 55, 57, 58, 59, 80, 82, 83, 84}, {100, 101, 102, 103, 104, 105, 106, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 7, 32, 57, 82, 132, 157, 182, 207, 232, 257, 282, 307, 332, 357, 382, 407, 432, 457, 482, 507, 532, 557, 582, 607, 5, 6, 8, 9, 30, 31, 33, 34, 55, 56, 58, 59, 80, 81, 83, 84}, {100, 101, 102, 103, 104, 105, 106, 107, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 8, 33, 58, 83, 133, 158, 183, 208, 233, 258, 283, 308, 333, 358, 383, 408, 433, 458, 483, 508, 533, 558, 583, 608, 5, 6, 7, 9, 30, 31, 32, 34, 55, 56, 57, 59, 80, 81, 82, 84}, {100, 101, 102, 103, 104, 105, 106, 107, 108, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 9, 34, 59, 84, 134, 159, 184, 209, 234, 259, 284, 309, 334, 359, 384, 409, 434, 459, 484, 509, 534, 559, 584, 609, 5, 6, 7, 8, 30, 31, 32, 33, 55, 56, 57, 58, 80, 81, 82, 83}, {100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 10, 35, 60, 85, 135, 160, 185, 210, 235, 260, 285, 310, 335, 360, 385, 410, 435, 460, 485, 510, 535, 560, 585, 610, 11, 12, 13, 14, 36, 37, 38, 39, 61, 62, 63, 64, 86, 87, 88, 89}, {100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 11, 36, 61, 86, 136, 161, 186, 211, 236, 261, 286, 311, 336, 361, 386, 411, 436, 461, 486, 511, 536, 561, 586, 611, 10, 12, 13, 14, 35, 37, 38, 39, 60, 62, 63, 64, 85, 87, 88, 89}, {100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 12, 37, 62, 87, 137, 162, 187, 212, 237, 262, 287, 312, 337, 362, 387, 412, 437, 462, 487, 512, 537, 562, 587, 612, 10, 11, 13, 14, 35, 36, 38, 39, 60, 61, 63, 64, 85, 86, 88, 89}, {100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 13, 38, 63, 88, 138, 163, 188, 213, 238, 263, 288, 313, 338, 363, 388, 413, 438, 463, 488, 513, 538, 563, 588, 613, 10, 11, 12, 14, 35, 36, 37, 39, 60, 61, 62, 64, 85, 86, 87, 89}, {100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 14, 39, 64, 89, 139, 164, 189, 214, 239, 264, 289, 314, 339, 364, 389, 414, 439, 464, 489, 514, 539, 564, 589, 614, 10, 11, 12, 13, 35, 36, 37, 38, 60, 61, 62, 63, 85, 86, 87, 88}, {100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 116, 117, 118, 119, 120, 121, 122, 123, 124, 15, 40, 65, 90, 140, 165, 190, 215, 240, 265, 290, 315, 340, 365, 390, 415, 440, 465, 490, 515, 540, 565, 590, 615, 16, 17, 18, 19, 41, 42, 43, 44, 66, 67, 68, 69, 91, 92, 93, 94}, {100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 117, 118, 119, 120, 121, 122, 123, 124, 16, 41, 66, 91, 141, 166, 191, 216, 241, 266, 291, 316, 341, 366, 391, 416, 441, 466, 491, 516, 541, 566, 591, 616, 15, 17, 18, 19, 40, 42, 43, 44, 65, 67, 68, 69, 90, 92, 93, 94}, {100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 118, 119, 120, 121, 122, 123, 124, 17, 42, 67, 92, 142, 167, 192, 217, 242, 267, 292, 317, 342, 367, 392, 417, 442, 467, 492, 517, 542, 567, 592, 617, 15, 16, 18, 19, 40, 41, 43, 44, 65, 66, 68, 69, 90, 91, 93, 94}, {100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 119, 120, 121, 122, 123, 124, 18, 43, 68, 93, 143, 168, 193, 218, 243, 268, 293, 318, 343, 368, 393, 418, 443, 468, 493, 518, 543, 568, 593, 618, 15, 16, 17, 19, 40, 41, 42, 44, 65, 66, 67, 69, 90, 91, 92, 94}, {100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 120, 121, 122, 123, 124, 19, 44, 69, 94, 144, 169, 194, 219, 244, 269, 294, 319, 344, 369, 394, 419, 444, 469, 494, 519, 544, 569, 594, 619, 15, 16, 17, 18, 40, 41, 42, 43, 65, 66, 67, 68, 90, 91, 92, 93}, {100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 121, 122, 123, 124, 20, 45, 70, 95, 145, 170, 195, 220, 245, 270, 295, 320, 345, 370, 395, 420, 445, 470, 495, 520, 545, 570, 595, 620, 21, 22, 23, 24, 46, 47, 48, 49, 71, 72, 73, 74, 96, 97, 98, 99}, {100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 122, 123, 124, 21, 46, 71, 96, 146, 171, 196, 221, 246, 271, 296, 321, 346, 371, 396, 421, 446, 471, 496, 521, 546, 571, 596, 621, 20, 22, 23, 24, 45, 47, 48, 49, 70, 72, 73, 74, 95, 97, 98, 99}, {100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 123, 124, 22, 47, 72, 97, 147, 172, 197, 222, 247, 272, 297, 322, 347, 372, 397, 422, 447, 472, 497, 522, 547, 572, 597, 622, 20, 21, 23, 24, 45, 46, 48, 49, 70, 71, 73, 74, 95, 96, 98, 99}, {100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 124, 23, 48, 73, 98, 148, 173, 198, 223, 248, 273, 298, 323, 348, 373, 398, 423, 448, 473, 498, 523, 548, 573, 598, 623, 20, 21, 22, 24, 45, 46, 47, 49, 70, 71, 72, 74, 95, 96, 97, 99}, {100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 24, 49, 74, 99, 149, 174, 199, 224, 249, 274, 299, 324, 349, 374, 399, 424, 449, 474, 499, 524, 549, 574, 599, 624, 20, 21, 22, 23, 45, 46, 47, 48, 70, 71, 72, 73, 95, 96, 97, 98}}, {{126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 0, 25, 50, 75, 100, 150, 175, 200, 225, 250, 275, 300, 325, 350, 375, 400, 425, 450, 475, 500, 525, 550, 575, 600, 151, 152, 153, 154, 176, 177, 178, 179, 201, 202, 203, 204, 226, 227, 228, 229}, {125, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 1, 26, 51, 76, 101, 151, 176, 201, 226, 251, 276, 301, 326, 351, 376, 401, 426, 451, 476, 501, 526, 551, 576, 601, 150, 152, 153, 154, 175, 177, 178, 179, 200, 202, 203, 204, 225, 227, 228, 229}, {125, 126, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 2, 27, 52, 77, 102, 152, 177, 202, 227, 252, 277, 302, 327, 352, 377, 402, 427, 452, 477, 502, 527, 552, 577, 602, 150, 151, 153, 154, 175, 176, 178, 179, 200, 201, 203, 204, 225, 226, 228, 229}, {125, 126, 127, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 3, 28, 53, 78, 103, 153, 178, 203, 228, 253, 278, 303, 328, 353, 378, 403, 428, 453, 478, 503, 528, 553, 578, 603, 150, 151, 152, 154, 175, 176, 177, 179, 200, 201, 202, 204, 225, 226, 227, 229}, {125, 126, 127, 128, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 4, 29, 54, 79, 104, 154, 179, 204, 229, 254, 279, 304, 329, 354, 379, 404, 429, 454, 479, 504, 529, 554, 579, 604, 150, 151, 152, 153, 175, 176, 177, 178, 200, 201, 202, 203, 225, 226, 227, 228}, {125, 126, 127, 128, 129, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 5, 30, 55, 80, 105, 155, 180, 205, 230, 255, 280, 305, 330, 355, 380, 405, 430, 455, 480, 505, 530, 555, 580, 605, 156, 157, 158, 159, 181, 182, 183, 184, 206, 207, 208, 209, 231, 232, 233, 234}, {125, 126, 127, 128, 129, 130, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 6, 31, 56, 81, 106, 156, 181, 206, 231, 256, 281, 306, 331, 356, 381, 406, 431, 456, 481, 506, 531, 556, 581, 606, 155, 157, 158, 159, 180, 182, 183, 184, 205, 207, 208, 209, 230, 232, 233, 234}, {125, 126, 127, 128, 129, 130, 131, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 7, 32, 57, 82, 107, 157, 182, 207, 232, 257, 282, 307, 332, 357, 382, 407, 432, 457, 482, 507, 532, 557, 582, 607, 155, 156, 158, 159, 180, 181, 183, 184, 205, 206, 208, 209, 230, 231, 233, 234}, {125, 126, 127, 128, 129, 130, 131, 132, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 8, 33, 58, 83, 108, 158, 183, 208, 233, 258, 283, 308, 333, 358, 383, 408, 433, 458, 483, 508, 533, 558, 583, 608, 155, 156, 157, 159, 180, 181, 182, 184, 205, 206, 207, 209, 230, 231, 232, 234}, {125, 126, 127, 128, 129, 130, 131, 132, 133, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 9, 34, 59, 84, 109, 159, 184, 209, 234, 259, 284, 309, 334, 359, 384, 409, 434, 459, 484, 509, 534, 559, 584, 609, 155, 156, 157, 158, 180, 181, 182, 183, 205, 206, 207, 208, 230, 231, 232, 233}, {125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 10, 35, 60, 85, 110, 160, 185, 210, 235, 260, 285, 310, 335, 360, 385, 410, 435, 460, 485, 510, 535, 560, 585, 610, 161, 162, 163, 164, 186, 187, 188, 189, 211, 212, 213, 214, 236, 237, 238, 239}, {125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 11, 36, 61, 86, 111, 161, 186, 211, 236, 261, 286, 311, 336, 361, 386, 411, 436, 461, 486, 511, 536, 561, 586, 611, 160, 162, 163, 164, 185, 187, 188, 189, 210, 212, 213, 214, 235, 237, 238, 239}, {125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 12, 37, 62, 87, 112, 162, 187, 212, 237, 262, 287, 312, 337, 362, 387, 412, 437, 462, 487, 512, 537, 562, 587, 612, 160, 161, 163, 164, 185, 186, 188, 189, 210, 211, 213, 214, 235, 236, 238, 239}, {125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 13, 38, 63, 88, 113, 163, 188, 213, 238, 263, 288, 313, 338, 363, 388, 413, 438, 463, 488, 513, 538, 563, 588, 613, 160, 161, 162, 164, 185, 186, 187, 189, 210, 211, 212, 214, 235, 236, 237, 239}, {125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 14, 39, 64, 89, 114, 164, 189, 214, 239, 264, 289, 314, 339, 364, 389, 414, 439, 464, 489, 514, 539, 564, 589, 614, 160, 161, 162, 163, 185, 186, 187, 188, 210, 211, 212, 213, 235, 236, 237, 238}, {125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 141, 142, 143, 144, 145, 146, 147, 148, 149, 15, 40, 65, 90, 115, 165, 190, 215, 240, 265, 290, 315, 340, 365, 390, 415, 440, 465, 490, 515, 540, 565, 590, 615, 166, 167, 168, 169, 191, 192, 193, 194, 216, 217, 218, 219, 241, 242, 243, 244}, {125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 142, 143, 144, 145, 146, 147, 148, 149, 16, 41, 66, 91, 116, 166, 191, 216, 241, 266, 291, 316, 341, 366, 391, 416, 441, 466, 491, 516, 541, 566, 591, 616, 165, 167, 168, 169, 190, 192, 193, 194, 215, 217, 218, 219, 240, 242, 243, 244}, {125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 143, 144, 145, 146, 147, 148, 149, 17, 42, 67, 92, 117, 167, 192, 217, 242, 267, 292, 317, 342, 367, 392, 417, 442, 467, 492, 517, 542, 567, 592, 617, 165, 166, 168, 169, 190, 191, 193, 194, 215, 216, 218, 219, 240, 241, 243, 244}, {125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 144, 145, 146, 147, 148, 149, 18, 43, 68, 93, 118, 168, 193, 218, 243, 268, 293, 318, 343, 368, 393, 418, 443, 468, 493, 518, 543, 568, 593, 618, 165, 166, 167, 169, 190, 191, 192, 194, 215, 216, 217, 219, 240, 241, 242, 244}, {125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 145, 146, 147, 148, 149, 19, 44, 69, 94, 119, 169, 194, 219, 244, 269, 294, 319, 344, 369, 394, 419, 444, 469, 494, 519, 544, 569, 594, 619, 165, 166, 167, 168, 190, 191, 192, 193, 215, 216, 217, 218, 240, 241, 242, 243}, {125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 146, 147, 148, 149, 20, 45, 70, 95, 120, 170, 195, 220, 245, 270, 295, 320, 345, 370, 395, 420, 445, 470, 495, 520, 545, 570, 595, 620, 171, 172, 173, 174, 196, 197, 198, 199, 221, 222, 223, 224, 246, 247, 248, 249}, {125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 147, 148, 149, 21, 46, 71, 96, 121, 171, 196, 221, 246, 271, 296, 321, 346, 371, 396, 421, 446, 471, 496, 521, 546, 571, 596, 621, 170, 172, 173, 174, 195, 197, 198, 199, 220, 222, 223, 224, 245, 247, 248, 249}, {125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 148, 149, 22, 47, 72, 97, 122, 172, 197, 222, 247, 272, 297, 322, 347, 372, 397, 422, 447, 472, 497, 522, 547, 572, 597, 622, 170, 171, 173, 174, 195, 196, 198, 199, 220, 221, 223, 224, 245, 246, 248, 249}, {125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 149, 23, 48, 73, 98, 123, 173, 198, 223, 248, 273, 298, 323, 348, 373, 398, 423, 448, 473, 498, 523, 548, 573, 598, 623, 170, 171, 172, 174, 195, 196, 197, 199, 220, 221, 222, 224, 245, 246, 247, 249}, {125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 24, 49, 74, 99, 124, 174, 199, 224, 249, 274, 299, 324, 349, 374, 399, 424, 449, 474, 499, 524, 549, 574, 599, 624, 170, 171, 172, 173, 195, 196, 197, 198, 220, 221, 222, 223, 245, 246, 247, 248}}, {{151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 0, 25, 50, 75, 100, 125, 175, 200, 225, 250, 275, 300, 325, 350, 375, 400, 425, 450, 475, 500, 525, 550, 575, 600, 126, 127, 128, 129, 176, 177, 178, 179, 201, 202, 203, 204, 226, 227, 228, 229}, {150, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 1, 26, 51, 76, 101, 126, 176, 201, 226, 251, 276, 301, 326, 351, 376, 401, 426, 451, 476, 501, 526, 551, 576, 601, 125, 127, 128, 129, 175, 177, 178, 179, 200, 202, 203, 204, 225, 227, 228, 229}, {150, 151, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 2, 27, 52, 77, 102, 127, 177, 202, 227, 252, 277, 302, 327, 352, 377, 402, 427, 452, 477, 502, 527, 552, 577, 602, 125, 126, 128, 129, 175, 176, 178, 179, 200, 201, 203, 204, 225, 226, 228, 229}, {150, 151, 152, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 3, 28, 53, 78, 103, 128, 178, 203, 228, 253, 278, 303, 328, 353, 378, 403, 428, 453, 478, 503, 528, 553, 578, 603, 125, 126, 127, 129, 175, 176, 177, 179, 200, 201, 202, 204, 225, 226, 227, 229}, {150, 151, 152, 153, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 4, 29, 54, 79, 104, 129, 179, 204, 229, 254, 279, 304, 329, 354, 379, 404, 429, 454, 479, 504, 529, 554, 579, 604, 125, 126, 127, 128, 175, 176, 177, 178, 200, 201, 202, 203, 225, 226, 227, 228}, {150, 151, 152, 153, 154, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 5, 30, 55, 80, 105, 130, 180, 205, 230, 255, 280, 305, 330, 355, 380, 405, 430, 455, 480, 505, 530, 555, 580, 605, 131, 132, 133, 134, 181, 182, 183, 184, 206, 207, 208, 209, 231, 232, 233, 234}, {150, 151, 152, 153, 154, 155, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 6, 31, 56, 81, 106, 131, 181, 206, 231, 256, 281, 306, 331, 356, 381, 406, 431, 456, 481, 506, 531, 556, 581, 606, 130, 132, 133, 134, 180, 182, 183, 184, 205, 207, 208, 209, 230, 232, 233, 234}, {150, 151, 152, 153, 154, 155, 156, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 7, 32, 57, 82, 107, 132, 182, 207, 232, 257, 282, 307, 332, 357, 382, 407, 432, 457, 482, 507, 532, 557, 582, 607, 130, 131, 133, 134, 180, 181, 183, 184, 205, 206, 208, 209, 230, 231, 233, 234}, {150, 151, 152, 153, 154, 155, 156, 157, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 8, 33, 58, 83, 108, 133, 183, 208, 233, 258, 283, 308, 333, 358, 383, 408, 433, 458, 483, 508, 533, 558, 583, 608, 130, 131, 132, 134, 180, 181, 182, 184, 205, 206, 207, 209, 230, 231, 232, 234}, {150, 151, 152, 153, 154, 155, 156, 157, 158, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 9, 34, 59, 84, 109, 134, 184, 209, 234, 259, 284, 309, 334, 359, 384, 409, 434, 459, 484, 509, 534, 559, 584, 609, 130, 131, 132, 133, 180, 181, 182, 183, 205, 206, 207, 208, 230, 231, 232, 233}, {150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 10, 35, 60, 85, 110, 135, 185, 210, 235, 260, 285, 310, 335, 360, 385, 410, 435, 460, 485, 510, 535, 560, 585, 610, 136, 137, 138, 139, 186, 187, 188, 189, 211, 212, 213, 214, 236, 237, 238, 239}, {150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 11, 36, 61, 86, 111, 136, 186, 211, 236, 261, 286, 311, 336, 361, 386, 411, 436, 461, 486, 511, 536, 561, 586, 611, 135, 137, 138, 139, 185, 187, 188, 189, 210, 212, 213, 214, 235, 237, 238, 239}, {150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 12, 37, 62, 87, 112, 137, 187, 212, 237, 262, 287, 312, 337, 362, 387, 412, 437, 462, 487, 512, 537, 562, 587, 612, 135, 136, 138, 139, 185, 186, 188, 189, 210, 211, 213, 214, 235, 236, 238, 239}, {150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 13, 38, 63, 88, 113, 138, 188, 213, 238, 263, 288, 313, 338, 363, 388, 413, 438, 463, 488, 513, 538, 563, 588, 613, 135, 136, 137, 139, 185, 186, 187, 189, 210, 211, 212, 214, 235, 236, 237, 239}, {150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 14, 39, 64, 89, 114, 139, 189, 214, 239, 264, 289, 314, 339, 364, 389, 414, 439, 464, 489, 514, 539, 564, 589, 614, 135, 136, 137, 138, 185, 186, 187, 188, 210, 211, 212, 213, 235, 236, 237, 238}, {150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 166, 167, 168, 169, 170, 171, 172, 173, 174, 15, 40, 65, 90, 115, 140, 190, 215, 240, 265, 290, 315, 340, 365, 390, 415, 440, 465, 490, 515, 540, 565, 590, 615, 141, 142, 143, 144, 191, 192, 193, 194, 216, 217, 218, 219, 241, 242, 243, 244}, {150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 167, 168, 169, 170, 171, 172, 173, 174, 16, 41, 66, 91, 116, 141, 191, 216, 241, 266, 291, 316, 341, 366, 391, 416, 441, 466, 491, 516, 541, 566, 591, 616, 140, 142, 143, 144, 190, 192, 193, 194, 215, 217, 218, 219, 240, 242, 243, 244}, {150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 168, 169, 170, 171, 172, 173, 174, 17, 42, 67, 92, 117, 142, 192, 217, 242, 267, 292, 317, 342, 367, 392, 417, 442, 467, 492, 517, 542, 567, 592, 617, 140, 141, 143, 144, 190, 191, 193, 194, 215, 216, 218, 219, 240, 241, 243, 244}, {150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 169, 170, 171, 172, 173, 174, 18, 43, 68, 93, 118, 143, 193, 218, 243, 268, 293, 318, 343, 368, 393, 418, 443, 468, 493, 518, 543, 568, 593, 618, 140, 141, 142, 144, 190, 191, 192, 194, 215, 216, 217, 219, 240, 241, 242, 244}, {150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 170, 171, 172, 173, 174, 19, 44, 69, 94, 119, 144, 194, 219, 244, 269, 294, 319, 344, 369, 394, 419, 444, 469, 494, 519, 544, 569, 594, 619, 140, 141, 142, 143, 190, 191, 192, 193, 215, 216, 217, 218, 240, 241, 242, 243}, {150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 171, 172, 173, 174, 20, 45, 70, 95, 120, 145, 195, 220, 245, 270, 295, 320, 345, 370, 395, 420, 445, 470, 495, 520, 545, 570, 595, 620, 146, 147, 148, 149, 196, 197, 198, 199, 221, 222, 223, 224, 246, 247, 248, 249}, {150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 172, 173, 174, 21, 46, 71, 96, 121, 146, 196, 221, 246, 271, 296, 321, 346, 371, 396, 421, 446, 471, 496, 521, 546, 571, 596, 621, 145, 147, 148, 149, 195, 197, 198, 199, 220, 222, 223, 224, 245, 247, 248, 249}, {150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 173, 174, 22, 47, 72, 97, 122, 147, 197, 222, 247, 272, 297, 322, 347, 372, 397, 422, 447, 472, 497, 522, 547, 572, 597, 622, 145, 146, 148, 149, 195, 196, 198, 199, 220, 221, 223, 224, 245, 246, 248, 249}, {150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 174, 23, 48, 73, 98, 123, 148, 198, 223, 248, 273, 298, 323, 348, 373, 398, 423, 448, 473, 498, 523, 548, 573, 598, 623, 145, 146, 147, 149, 195, 196, 197, 199, 220, 221, 222, 224, 245, 246, 247, 249}, {150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 24, 49, 74, 99, 124, 149, 199, 224, 249, 274, 299, 324, 349, 374, 399, 424, 449, 474, 499, 524, 549, 574, 599, 624, 145, 146, 147, 148, 195, 196, 197, 198, 220, 221, 222, 223, 245, 246, 247, 248}}, {{176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 0, 25, 50, 75, 100, 125, 150, 200, 225, 250, 275, 300, 325, 350, 375, 400, 425, 450, 475, 500, 525, 550, 575, 600, 126, 127, 128, 129, 151, 152, 153, 154, 201, 202, 203, 204, 226, 227, 228, 229}, {175, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 1, 26, 51, 76, 101, 126, 151, 201, 226, 251, 276, 301, 326, 351, 376, 401, 426, 451, 476, 501, 526, 551, 576, 601, 125, 127, 128, 129, 150, 152, 153, 154, 200, 202, 203, 204, 225, 227, 228, 229}, {175, 176, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 2, 27, 52, 77, 102, 127, 152, 202, 227, 252, 277, 302, 327, 352, 377, 402, 427, 452, 477, 502, 527, 552, 577, 602, 125, 126, 128, 129, 150, 151, 153, 154, 200, 201, 203, 204, 225, 226, 228, 229}, {175, 176, 177, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 3, 28, 53, 78, 103, 128, 153, 203, 228, 253, 278, 303, 328, 353, 378, 403, 428, 453, 478, 503, 528, 553, 578, 603, 125, 126, 127, 129, 150, 151, 152, 154, 200, 201, 202, 204, 225, 226, 227, 229}, {175, 176, 177, 178, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 4, 29, 54, 79, 104, 129, 154, 204, 229, 254, 279, 304, 329, 354, 379, 404, 429, 454, 479, 504, 529, 554, 579, 604, 125, 126, 127, 128, 150, 151, 152, 153, 200, 201, 202, 203, 225, 226, 227, 228}, {175, 176, 177, 178, 179, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 5, 30, 55, 80, 105, 130, 155, 205, 230, 255, 280, 305, 330, 355, 380, 405, 430, 455, 480, 505, 530, 555, 580, 605, 131, 132, 133, 134, 156, 157, 158, 159, 206, 207, 208, 209, 231, 232, 233, 234}, {175, 176, 177, 178, 179, 180, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 6, 31, 56, 81, 106, 131, 156, 206, 231, 256, 281, 306, 331, 356, 381, 406, 431, 456, 481, 506, 531, 556, 581, 606, 130, 132, 133, 134, 155, 157, 158, 159, 205, 207, 208, 209, 230, 232, 233, 234}, {175, 176, 177, 178, 179, 180, 181, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 7, 32, 57, 82, 107, 132, 157, 207, 232, 257, 282, 307, 332, 357, 382, 407, 432, 457, 482, 507, 532, 557, 582, 607, 130, 131, 133, 134, 155, 156, 158, 159, 205, 206, 208, 209, 230, 231, 233, 234}, {175, 176, 177, 178, 179, 180, 181, 182, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 8, 33, 58, 83, 108, 133, 158, 208, 233, 258, 283, 308, 333, 358, 383, 408, 433, 458, 483, 508, 533, 558, 583, 608, 130, 131, 132, 134, 155, 156, 157, 159, 205, 206, 207, 209, 230, 231, 232, 234}, {175, 176, 177, 178, 179, 180, 181, 182, 183, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 9, 34, 59, 84, 109, 134, 159, 209, 234, 259, 284, 309, 334, 359, 384, 409, 434, 459, 484, 509, 534, 559, 584, 609, 130, 131, 132, 133, 155, 156, 157, 158, 205, 206, 207, 208, 230, 231, 232, 233}, {175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 10, 35, 60, 85, 110, 135, 160, 210, 235, 260, 285, 310, 335, 360, 385, 410, 435, 460, 485, 510, 535, 560, 585, 610, 136, 137, 138, 139, 161, 162, 163, 164, 211, 212, 213, 214, 236, 237, 238, 239}, {175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 11, 36, 61, 86, 111, 136, 161, 211, 236, 261, 286, 311, 336, 361, 386, 411, 436, 461, 486, 511, 536, 561, 586, 611, 135, 137, 138, 139, 160, 162, 163, 164, 210, 212, 213, 214, 235, 237, 238, 239}, {175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 12, 37, 62, 87, 112, 137, 162, 212, 237, 262, 287, 312, 337, 362, 387, 412, 437, 462, 487, 512, 537, 562, 587, 612, 135, 136, 138, 139, 160, 161, 163, 164, 210, 211, 213, 214, 235, 236, 238, 239}, {175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 13, 38, 63, 88, 113, 138, 163, 213, 238, 263, 288, 313, 338, 363, 388, 413, 438, 463, 488, 513, 538, 563, 588, 613, 135, 136, 137, 139, 160, 161, 162, 164, 210, 211, 212, 214, 235, 236, 237, 239}, {175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 14, 39, 64, 89, 114, 139, 164, 214, 239, 264, 289, 314, 339, 364, 389, 414, 439, 464, 489, 514, 539, 564, 589, 614, 135, 136, 137, 138, 160, 161, 162, 163, 210, 211, 212, 213, 235, 236, 237, 238}, {175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 191, 192, 193, 194, 195, 196, 197, 198, 199, 15, 40, 65, 90, 115, 140, 165, 215, 240, 265, 290, 315, 340, 365, 390, 415, 440, 465, 490, 515, 540, 565, 590, 615, 141, 142, 143, 144, 166, 167, 168, 169, 216, 217, 218, 219, 241, 242, 243, 244}, {175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 192, 193, 194, 195, 196, 197, 198, 199, 16, 41, 66, 91, 116, 141, 166, 216, 241, 266, 291, 316, 341, 366, 391, 416, 441, 466, 491, 516, 541, 566, 591, 616, 140, 142, 143, 144, 165, 167, 168, 169, 215, 217, 218, 219, 240, 242, 243, 244}, {175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 193, 194, 195, 196, 197, 198, 199, 17, 42, 67, 92, 117, 142, 167, 217, 242, 267, 292, 317, 342, 367, 392, 417, 442, 467, 492, 517, 542, 567, 592, 617, 140, 141, 143, 144, 165, 166, 168, 169, 215, 216, 218, 219, 240, 241, 243, 244}, {175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 194, 195, 196, 197, 198, 199, 18, 43, 68, 93, 118, 143, 168, 218, 243, 268, 293, 318, 343, 368, 393, 418, 443, 468, 493, 518, 543, 568, 593, 618, 140, 141, 142, 144, 165, 166, 167, 169, 215, 216, 217, 219, 240, 241, 242, 244}, {175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 195, 196, 197, 198, 199, 19, 44, 69, 94, 119, 144, 169, 219, 244, 269, 294, 319, 344, 369, 394, 419, 444, 469, 494, 519, 544, 569, 594, 619, 140, 141, 142, 143, 165, 166, 167, 168, 215, 216, 217, 218, 240, 241, 242, 243}, {175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 196, 197, 198, 199, 20, 45, 70, 95, 120, 145, 170, 220, 245, 270, 295, 320, 345, 370, 395, 420, 445, 470, 495, 520, 545, 570, 595, 620, 146, 147, 148, 149, 171, 172, 173, 174, 221, 222, 223, 224, 246, 247, 248, 249}, {175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 197, 198, 199, 21, 46, 71, 96, 121, 146, 171, 221, 246, 271, 296, 321, 346, 371, 396, 421, 446, 471, 496, 521, 546, 571, 596, 621, 145, 147, 148, 149, 170, 172, 173, 174, 220, 222, 223, 224, 245, 247, 248, 249}, {175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 198, 199, 22, 47, 72, 97, 122, 147, 172, 222, 247, 272, 297, 322, 347, 372, 397, 422, 447, 472, 497, 522, 547, 572, 597, 622, 145, 146, 148, 149, 170, 171, 173, 174, 220, 221, 223, 224, 245, 246, 248, 249}, {175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 199, 23, 48, 73, 98, 123, 148, 173, 223, 248, 273, 298, 323, 348, 373, 398, 423, 448, 473, 498, 523, 548, 573, 598, 623, 145, 146, 147, 149, 170, 171, 172, 174, 220, 221, 222, 224, 245, 246, 247, 249}, {175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 24, 49, 74, 99, 124, 149, 174, 224, 249, 274, 299, 324, 349, 374, 399, 424, 449, 474, 499, 524, 549, 574, 599, 624, 145, 146, 147, 148, 170, 171, 172, 173, 220, 221, 222, 223, 245, 246, 247, 248}}, {{201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 0, 25, 50, 75, 100, 125, 150, 175, 225, 250, 275, 300, 325, 350, 375, 400, 425, 450, 475, 500, 525, 550, 575, 600, 126, 127, 128, 129, 151, 152, 153, 154, 176, 177, 178, 179, 226, 227, 228, 229}, {200, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 1, 26, 51, 76, 101, 126, 151, 176, 226, 251, 276, 301, 326, 351, 376, 401, 426, 451, 476, 501, 526, 551, 576, 601, 125, 127, 128, 129, 150, 152, 153, 154, 175, 177, 178, 179, 225, 227, 228, 229}, {200, 201, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 2, 27, 52, 77, 102, 127, 152, 177, 227, 252, 277, 302, 327, 352, 377, 402, 427, 452, 477, 502, 527, 552, 577, 602, 125, 126, 128, 129, 150, 151, 153, 154, 175, 176, 178, 179, 225, 226, 228, 229}, {200, 201, 202, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 3, 28, 53, 78, 103, 128, 153, 178, 228, 253, 278, 303, 328, 353, 378, 403, 428, 453, 478, 503, 528, 553, 578, 603, 125, 126, 127, 129, 150, 151, 152, 154, 175, 176, 177, 179, 225, 226, 227, 229}, {200, 201, 202, 203, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 4, 29, 54, 79, 104, 129, 154, 179, 229, 254, 279, 304, 329, 354, 379, 404, 429, 454, 479, 504, 529, 554, 579, 604, 125, 126, 127, 128, 150, 151, 152, 153, 175, 176, 177, 178, 225, 226, 227, 228}, {200, 201, 202, 203, 204, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 5, 30, 55, 80, 105, 130, 155, 180, 230, 255, 280, 305, 330, 355, 380, 405, 430, 455, 480, 505, 530, 555, 580, 605, 131, 132, 133, 134, 156, 157, 158, 159, 181, 182, 183, 184, 231, 232, 233, 234}, {200, 201, 202, 203, 204, 205, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 6, 31, 56, 81, 106, 131, 156, 181, 231, 256, 281, 306, 331, 356, 381, 406, 431, 456, 481, 506, 531, 556, 581, 606, 130, 132, 133, 134, 155, 157, 158, 159, 180, 182, 183, 184, 230, 232, 233, 234}, {200, 201, 202, 203, 204, 205, 206, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 7, 32, 57, 82, 107, 132, 157, 182, 232, 257, 282, 307, 332, 357, 382, 407, 432, 457, 482, 507, 532, 557, 582, 607, 130, 131, 133, 134, 155, 156, 158, 159, 180, 181, 183, 184, 230, 231, 233, 234}, {200, 201, 202, 203, 204, 205, 206, 207, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 8, 33, 58, 83, 108, 133, 158, 183, 233, 258, 283, 308, 333, 358, 383, 408, 433, 458, 483, 508, 533, 558, 583, 608, 130, 131, 132, 134, 155, 156, 157, 159, 180, 181, 182, 184, 230, 231, 232, 234}, {200, 201, 202, 203, 204, 205, 206, 207, 208, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 9, 34, 59, 84, 109, 134, 159, 184, 234, 259, 284, 309, 334, 359, 384, 409, 434, 459, 484, 509, 534, 559, 584, 609, 130, 131, 132, 133, 155, 156, 157, 158, 180, 181, 182, 183, 230, 231, 232, 233}, {200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 10, 35, 60, 85, 110, 135, 160, 185, 235, 260, 285, 310, 335, 360, 385, 410, 435, 460, 485, 510, 535, 560, 585, 610, 136, 137, 138, 139, 161, 162, 163, 164, 186, 187, 188, 189, 236, 237, 238, 239}, {200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 11, 36, 61, 86, 111, 136, 161, 186, 236, 261, 286, 311, 336, 361, 386, 411, 436, 461, 486, 511, 536, 561, 586, 611, 135, 137, 138, 139, 160, 162, 163, 164, 185, 187, 188, 189, 235, 237, 238, 239}, {200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 12, 37, 62, 87, 112, 137, 162, 187, 237, 262, 287, 312, 337, 362, 387, 412, 437, 462, 487, 512, 537, 562, 587, 612, 135, 136, 138, 139, 160, 161, 163, 164, 185, 186, 188, 189, 235, 236, 238, 239}, {200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 13, 38, 63, 88, 113, 138, 163, 188, 238, 263, 288, 313, 338, 363, 388, 413, 438, 463, 488, 513, 538, 563, 588, 613, 135, 136, 137, 139, 160, 161, 162, 164, 185, 186, 187, 189, 235, 236, 237, 239}, {200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 14, 39, 64, 89, 114, 139, 164, 189, 239, 264, 289, 314, 339, 364, 389, 414, 439, 464, 489, 514, 539, 564, 589, 614, 135, 136, 137, 138, 160, 161, 162, 163, 185, 186, 187, 188, 235, 236, 237, 238}, {200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 216, 217, 218, 219, 220, 221, 222, 223, 224, 15, 40, 65, 90, 115, 140, 165, 190, 240, 265, 290, 315, 340, 365, 390, 415, 440, 465, 490, 515, 540, 565, 590, 615, 141, 142, 143, 144, 166, 167, 168, 169, 191, 192, 193, 194, 241, 242, 243, 244}, {200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 217, 218, 219, 220, 221, 222, 223, 224, 16, 41, 66, 91, 116, 141, 166, 191, 241, 266, 291, 316, 341, 366, 391, 416, 441, 466, 491, 516, 541, 566, 591, 616, 140, 142, 143, 144, 165, 167, 168, 169, 190, 192, 193, 194, 240, 242, 243, 244}, {200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 218, 219, 220, 221, 222, 223, 224, 17, 42, 67, 92, 117, 142, 167, 192, 242, 267, 292, 317, 342, 367, 392, 417, 442, 467, 492, 517, 542, 567, 592, 617, 140, 141, 143, 144, 165, 166, 168, 169, 190, 191, 193, 194, 240, 241, 243, 244}, {200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 219, 220, 221, 222, 223, 224, 18, 43, 68, 93, 118, 143, 168, 193, 243, 268, 293, 318, 343, 368, 393, 418, 443, 468, 493, 518, 543, 568, 593, 618, 140, 141, 142, 144, 165, 166, 167, 169, 190, 191, 192, 194, 240, 241, 242, 244}, {200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 220, 221, 222, 223, 224, 19, 44, 69, 94, 119, 144, 169, 194, 244, 269, 294, 319, 344, 369, 394, 419, 444, 469, 494, 519, 544, 569, 594, 619, 140, 141, 142, 143, 165, 166, 167, 168, 190, 191, 192, 193, 240, 241, 242, 243}, {200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 221, 222, 223, 224, 20, 45, 70, 95, 120, 145, 170, 195, 245, 270, 295, 320, 345, 370, 395, 420, 445, 470, 495, 520, 545, 570, 595, 620, 146, 147, 148, 149, 171, 172, 173, 174, 196, 197, 198, 199, 246, 247, 248, 249}, {200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 222, 223, 224, 21, 46, 71, 96, 121, 146, 171, 196, 246, 271, 296, 321, 346, 371, 396, 421, 446, 471, 496, 521, 546, 571, 596, 621, 145, 147, 148, 149, 170, 172, 173, 174, 195, 197, 198, 199, 245, 247, 248, 249}, {200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 223, 224, 22, 47, 72, 97, 122, 147, 172, 197, 247, 272, 297, 322, 347, 372, 397, 422, 447, 472, 497, 522, 547, 572, 597, 622, 145, 146, 148, 149, 170, 171, 173, 174, 195, 196, 198, 199, 245, 246, 248, 249}, {200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 224, 23, 48, 73, 98, 123, 148, 173, 198, 248, 273, 298, 323, 348, 373, 398, 423, 448, 473, 498, 523, 548, 573, 598, 623, 145, 146, 147, 149, 170, 171, 172, 174, 195, 196, 197, 199, 245, 246, 247, 249}, {200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 24, 49, 74, 99, 124, 149, 174, 199, 249, 274, 299, 324, 349, 374, 399, 424, 449, 474, 499, 524, 549, 574, 599, 624, 145, 146, 147, 148, 170, 171, 172, 173, 195, 196, 197, 198, 245, 246, 247, 248}}, {{226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 0, 25, 50, 75, 100, 125, 150, 175, 200, 250, 275, 300, 325, 350, 375, 400, 425, 450, 475, 500, 525, 550, 575, 600, 126, 127, 128, 129, 151, 152, 153, 154, 176, 177, 178, 179, 201, 202, 203, 204}, {225, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 1, 26, 51, 76, 101, 126, 151, 176, 201, 251, 276, 301, 326, 351, 376, 401, 426, 451, 476, 501, 526, 551, 576, 601, 125, 127, 128, 129, 150, 152, 153, 154, 175, 177, 178, 179, 200, 202, 203, 204}, {225, 226, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 2, 27, 52, 77, 102, 127, 152, 177, 202, 252, 277, 302, 327, 352, 377, 402, 427, 452, 477, 502, 527, 552, 577, 602, 125, 126, 128, 129, 150, 151, 153, 154, 175, 176, 178, 179, 200, 201, 203, 204}, {225, 226, 227, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 3, 28, 53, 78, 103, 128, 153, 178, 203, 253, 278, 303, 328, 353, 378, 403, 428, 453, 478, 503, 528, 553, 578, 603, 125, 126, 127, 129, 150, 151, 152, 154, 175, 176, 177, 179, 200, 201, 202, 204}, {225, 226, 227, 228, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 4, 29, 54, 79, 104, 129, 154, 179, 204, 254, 279, 304, 329, 354, 379, 404, 429, 454, 479, 504, 529, 554, 579, 604, 125, 126, 127, 128, 150, 151, 152, 153, 175, 176, 177, 178, 200, 201, 202, 203}, {225, 226, 227, 228, 229, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 5, 30, 55, 80, 105, 130, 155, 180, 205, 255, 280, 305, 330, 355, 380, 405, 430, 455, 480, 505, 530, 555, 580, 605, 131, 132, 133, 134, 156, 157, 158, 159, 181, 182, 183, 184, 206, 207, 208, 209}, {225, 226, 227, 228, 229, 230, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 6, 31, 56, 81, 106, 131, 156, 181, 206, 256, 281, 306, 331, 356, 381, 406, 431, 456, 481, 506, 531, 556, 581, 606, 130, 132, 133, 134, 155, 157, 158, 159, 180, 182, 183, 184, 205, 207, 208, 209}, {225, 226, 227, 228, 229, 230, 231, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 7, 32, 57, 82, 107, 132, 157, 182, 207, 257, 282, 307, 332, 357, 382, 407, 432, 457, 482, 507, 532, 557, 582, 607, 130, 131, 133, 134, 155, 156, 158, 159, 180, 181, 183, 184, 205, 206, 208, 209}, {225, 226, 227, 228, 229, 230, 231, 232, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 8, 33, 58, 83, 108, 133, 158, 183, 208, 258, 283, 308, 333, 358, 383, 408, 433, 458, 483, 508, 533, 558, 583, 608, 130, 131, 132, 134, 155, 156, 157, 159, 180, 181, 182, 184, 205, 206, 207, 209}, {225, 226, 227, 228, 229, 230, 231, 232, 233, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 9, 34, 59, 84, 109, 134, 159, 184, 209, 259, 284, 309, 334, 359, 384, 409, 434, 459, 484, 509, 534, 559, 584, 609, 130, 131, 132, 133, 155, 156, 157, 158, 180, 181, 182, 183, 205, 206, 207, 208}, {225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 10, 35, 60, 85, 110, 135, 160, 185, 210, 260, 285, 310, 335, 360, 385, 410, 435, 460, 485, 510, 535, 560, 585, 610, 136, 137, 138, 139, 161, 162, 163, 164, 186, 187, 188, 189, 211, 212, 213, 214}, {225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 11, 36, 61, 86, 111, 136, 161, 186, 211, 261, 286, 311, 336, 361, 386, 411, 436, 461, 486, 511, 536, 561, 586, 611, 135, 137, 138, 139, 160, 162, 163, 164, 185, 187, 188, 189, 210, 212, 213, 214}, {225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 12, 37, 62, 87, 112, 137, 162, 187, 212, 262, 287, 312, 337, 362, 387, 412, 437, 462, 487, 512, 537, 562, 587, 612, 135, 136, 138, 139, 160, 161, 163, 164, 185, 186, 188, 189, 210, 211, 213, 214}, {225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 13, 38, 63, 88, 113, 138, 163, 188, 213, 263, 288, 313, 338, 363, 388, 413, 438, 463, 488, 513, 538, 563, 588, 613, 135, 136, 137, 139, 160, 161, 162, 164, 185, 186, 187, 189, 210, 211, 212, 214}, {225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 14, 39, 64, 89, 114, 139, 164, 189, 214, 264, 289, 314, 339, 364, 389, 414, 439, 464, 489, 514, 539, 564, 589, 614, 135, 136, 137, 138, 160, 161, 162, 163, 185, 186, 187, 188, 210, 211, 212, 213}, {225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 241, 242, 243, 244, 245, 246, 247, 248, 249, 15, 40, 65, 90, 115, 140, 165, 190, 215, 265, 290, 315, 340, 365, 390, 415, 440, 465, 490, 515, 540, 565, 590, 615, 141, 142, 143, 144, 166, 167, 168, 169, 191, 192, 193, 194, 216, 217, 218, 219}, {225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 242, 243, 244, 245, 246, 247, 248, 249, 16, 41, 66, 91, 116, 141, 166, 191, 216, 266, 291, 316, 341, 366, 391, 416, 441, 466, 491, 516, 541, 566, 591, 616, 140, 142, 143, 144, 165, 167, 168, 169, 190, 192, 193, 194, 215, 217, 218, 219}, {225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 243, 244, 245, 246, 247, 248, 249, 17, 42, 67, 92, 117, 142, 167, 192, 217, 267, 292, 317, 342, 367, 392, 417, 442, 467, 492, 517, 542, 567, 592, 617, 140, 141, 143, 144, 165, 166, 168, 169, 190, 191, 193, 194, 215, 216, 218, 219}, {225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 244, 245, 246, 247, 248, 249, 18, 43, 68, 93, 118, 143, 168, 193, 218, 268, 293, 318, 343, 368, 393, 418, 443, 468, 493, 518, 543, 568, 593, 618, 140, 141, 142, 144, 165, 166, 167, 169, 190, 191, 192, 194, 215, 216, 217, 219}, {225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 245, 246, 247, 248, 249, 19, 44, 69, 94, 119, 144, 169, 194, 219, 269, 294, 319, 344, 369, 394, 419, 444, 469, 494, 519, 544, 569, 594, 619, 140, 141, 142, 143, 165, 166, 167, 168, 190, 191, 192, 193, 215, 216, 217, 218}, {225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 246, 247, 248, 249, 20, 45, 70, 95, 120, 145, 170, 195, 220, 270, 295, 320, 345, 370, 395, 420, 445, 470, 495, 520, 545, 570, 595, 620, 146, 147, 148, 149, 171, 172, 173, 174, 196, 197, 198, 199, 221, 222, 223, 224}, {225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 247, 248, 249, 21, 46, 71, 96, 121, 146, 171, 196, 221, 271, 296, 321, 346, 371, 396, 421, 446, 471, 496, 521, 546, 571, 596, 621, 145, 147, 148, 149, 170, 172, 173, 174, 195, 197, 198, 199, 220, 222, 223, 224}, {225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 248, 249, 22, 47, 72, 97, 122, 147, 172, 197, 222, 272, 297, 322, 347, 372, 397, 422, 447, 472, 497, 522, 547, 572, 597, 622, 145, 146, 148, 149, 170, 171, 173, 174, 195, 196, 198, 199, 220, 221, 223, 224}, {225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 249, 23, 48, 73, 98, 123, 148, 173, 198, 223, 273, 298, 323, 348, 373, 398, 423, 448, 473, 498, 523, 548, 573, 598, 623, 145, 146, 147, 149, 170, 171, 172, 174, 195, 196, 197, 199, 220, 221, 222, 224}, {225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 24, 49, 74, 99, 124, 149, 174, 199, 224, 274, 299, 324, 349, 374, 399, 424, 449, 474, 499, 524, 549, 574, 599, 624, 145, 146, 147, 148, 170, 171, 172, 173, 195, 196, 197, 198, 220, 221, 222, 223}}, {{251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 0, 25, 50, 75, 100, 125, 150, 175, 200, 225, 275, 300, 325, 350, 375, 400, 425, 450, 475, 500, 525, 550, 575, 600, 276, 277, 278, 279, 301, 302, 303, 304, 326, 327, 328, 329, 351, 352, 353, 354}, {250, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 1, 26, 51, 76, 101, 126, 151, 176, 201, 226, 276, 301, 326, 351, 376, 401, 426, 451, 476, 501, 526, 551, 576, 601, 275, 277, 278, 279, 300, 302, 303, 304, 325, 327, 328, 329, 350, 352, 353, 354}, {250, 251, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 2, 27, 52, 77, 102, 127, 152, 177, 202, 227, 277, 302, 327, 352, 377, 402, 427, 452, 477, 502, 527, 552, 577, 602, 275, 276, 278, 279, 300, 301, 303, 304, 325, 326, 328, 329, 350, 351, 353, 354}, {250, 251, 252, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 3, 28, 53, 78, 103, 128, 153, 178, 203, 228, 278, 303, 328, 353, 378, 403, 428, 453, 478, 503, 528, 553, 578, 603, 275, 276, 277, 279, 300, 301, 302, 304, 325, 326, 327, 329, 350, 351, 352, 354}, {250, 251, 252, 253, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 4, 29, 54, 79, 104, 129, 154, 179, 204, 229, 279, 304, 329, 354, 379, 404, 429, 454, 479, 504, 529, 554, 579, 604, 275, 276, 277, 278, 300, 301, 302, 303, 325, 326, 327, 328, 350, 351, 352, 353}, {250, 251, 252, 253, 254, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 5, 30, 55, 80, 105, 130, 155, 180, 205, 230, 280, 305, 330, 355, 380, 405, 430, 455, 480, 505, 530, 555, 580, 605, 281, 282, 283, 284, 306, 307, 308, 309, 331, 332, 333, 334, 356, 357, 358, 359}, {250, 251, 252, 253, 254, 255, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 6, 31, 56, 81, 106, 131, 156, 181, 206, 231, 281, 306, 331, 356, 381, 406, 431, 456, 481, 506, 531, 556, 581, 606, 280, 282, 283, 284, 305, 307, 308, 309, 330, 332, 333, 334, 355, 357, 358, 359}, {250, 251, 252, 253, 254, 255, 256, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 7, 32, 57, 82, 107, 132, 157, 182, 207, 232, 282, 307, 332, 357, 382, 407, 432, 457, 482, 507, 532, 557, 582, 607, 280, 281, 283, 284, 305, 306, 308, 309, 330, 331, 333, 334, 355, 356, 358, 359}, {250, 251, 252, 253, 254, 255, 256, 257, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 8, 33, 58, 83, 108, 133, 158, 183, 208, 233, 283, 308, 333, 358, 383, 408, 433, 458, 483, 508, 533, 558, 583, 608, 280, 281, 282, 284, 305, 306, 307, 309, 330, 331, 332, 334, 355, 356, 357, 359}, {250, 251, 252, 253, 254, 255, 256, 257, 258, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 9, 34, 59, 84, 109, 134, 159, 184, 209, 234, 284, 309, 334, 359, 384, 409, 434, 459, 484, 509, 534, 559, 584, 609, 280, 281, 282, 283, 305, 306, 307, 308, 330, 331, 332, 333, 355, 356, 357, 358}, {250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 10, 35, 60, 85, 110, 135, 160, 185, 210, 235, 285, 310, 335, 360, 385, 410, 435, 460, 485, 510, 535, 560, 585, 610, 286, 287, 288, 289, 311, 312, 313, 314, 336, 337, 338, 339, 361, 362, 363, 364}, {250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 11, 36, 61, 86, 111, 136, 161, 186, 211, 236, 286, 311, 336, 361, 386, 411, 436, 461, 486, 511, 536, 561, 586, 611, 285, 287, 288, 289, 310, 312, 313, 314, 335, 337, 338, 339, 360, 362, 363, 364}, {250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 12, 37, 62, 87, 112, 137, 162, 187, 212, 237, 287, 312, 337, 362, 387, 412, 437, 462, 487, 512, 537, 562, 587, 612, 285, 286, 288, 289, 310, 311, 313, 314, 335, 336, 338, 339, 360, 361, 363, 364}, {250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 13, 38, 63, 88, 113, 138, 163, 188, 213, 238, 288, 313, 338, 363, 388, 413, 438, 463, 488, 513, 538, 563, 588, 613, 285, 286, 287, 289, 310, 311, 312, 314, 335, 336, 337, 339, 360, 361, 362, 364}, {250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 14, 39, 64, 89, 114, 139, 164, 189, 214, 239, 289, 314, 339, 364, 389, 414, 439, 464, 489, 514, 539, 564, 589, 614, 285, 286, 287, 288, 310, 311, 312, 313, 335, 336, 337, 338, 360, 361, 362, 363}, {250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 266, 267, 268, 269, 270, 271, 272, 273, 274, 15, 40, 65, 90, 115, 140, 165, 190, 215, 240, 290, 315, 340, 365, 390, 415, 440, 465, 490, 515, 540, 565, 590, 615, 291, 292, 293, 294, 316, 317, 318, 319, 341, 342, 343, 344, 366, 367, 368, 369}, {250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 267, 268, 269, 270, 271, 272, 273, 274, 16, 41, 66, 91, 116, 141, 166, 191, 216, 241, 291, 316, 341, 366, 391, 416, 441, 466, 491, 516, 541, 566, 591, 616, 290, 292, 293, 294, 315, 317, 318, 319, 340, 342, 343, 344, 365, 367, 368, 369}, {250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 268, 269, 270, 271, 272, 273, 274, 17, 42, 67, 92, 117, 142, 167, 192, 217, 242, 292, 317, 342, 367, 392, 417, 442, 467, 492, 517, 542, 567, 592, 617, 290, 291, 293, 294, 315, 316, 318, 319, 340, 341, 343, 344, 365, 366, 368, 369}, {250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 269, 270, 271, 272, 273, 274, 18, 43, 68, 93, 118, 143, 168, 193, 218, 243, 293, 318, 343, 368, 393, 418, 443, 468, 493, 518, 543, 568, 593, 618, 290, 291, 292, 294, 315, 316, 317, 319, 340, 341, 342, 344, 365, 366, 367, 369}, {250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 270, 271, 272, 273, 274, 19, 44, 69, 94, 119, 144, 169, 194, 219, 244, 294, 319, 344, 369, 394, 419, 444, 469, 494, 519, 544, 569, 594, 619, 290, 291, 292, 293, 315, 316, 317, 318, 340, 341, 342, 343, 365, 366, 367, 368}, {250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 271, 272, 273, 274, 20, 45, 70, 95, 120, 145, 170, 195, 220, 245, 295, 320, 345, 370, 395, 420, 445, 470, 495, 520, 545, 570, 595, 620, 296, 297, 298, 299, 321, 322, 323, 324, 346, 347, 348, 349, 371, 372, 373, 374}, {250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 272, 273, 274, 21, 46, 71, 96, 121, 146, 171, 196, 221, 246, 296, 321, 346, 371, 396, 421, 446, 471, 496, 521, 546, 571, 596, 621, 295, 297, 298, 299, 320, 322, 323, 324, 345, 347, 348, 349, 370, 372, 373, 374}, {250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 273, 274, 22, 47, 72, 97, 122, 147, 172, 197, 222, 247, 297, 322, 347, 372, 397, 422, 447, 472, 497, 522, 547, 572, 597, 622, 295, 296, 298, 299, 320, 321, 323, 324, 345, 346, 348, 349, 370, 371, 373, 374}, {250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 274, 23, 48, 73, 98, 123, 148, 173, 198, 223, 248, 298, 323, 348, 373, 398, 423, 448, 473, 498, 523, 548, 573, 598, 623, 295, 296, 297, 299, 320, 321, 322, 324, 345, 346, 347, 349, 370, 371, 372, 374}, {250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 24, 49, 74, 99, 124, 149, 174, 199, 224, 249, 299, 324, 349, 374, 399, 424, 449, 474, 499, 524, 549, 574, 599, 624, 295, 296, 297, 298, 320, 321, 322, 323, 345, 346, 347, 348, 370, 371, 372, 373}}, {{276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 0, 25, 50, 75, 100, 125, 150, 175, 200, 225, 250, 300, 325, 350, 375, 400, 425, 450, 475, 500, 525, 550, 575, 600, 251, 252, 253, 254, 301, 302, 303, 304, 326, 327, 328, 329, 351, 352, 353, 354}, {275, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 1, 26, 51, 76, 101, 126, 151, 176, 201, 226, 251, 301, 326, 351, 376, 401, 426, 451, 476, 501, 526, 551, 576, 601, 250, 252, 253, 254, 300, 302, 303, 304, 325, 327, 328, 329, 350, 352, 353, 354}, {275, 276, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 2, 27, 52, 77, 102, 127, 152, 177, 202, 227, 252, 302, 327, 352, 377, 402, 427, 452, 477, 502, 527, 552, 577, 602, 250, 251, 253, 254, 300, 301, 303, 304, 325, 326, 328, 329, 350, 351, 353, 354}, {275, 276, 277, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 3, 28, 53, 78, 103, 128, 153, 178, 203, 228, 253, 303, 328, 353, 378, 403, 428, 453, 478, 503, 528, 553, 578, 603, 250, 251, 252, 254, 300, 301, 302, 304, 325, 326, 327, 329, 350, 351, 352, 354}, {275, 276, 277, 278, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 4, 29, 54, 79, 104, 129, 154, 179, 204, 229, 254, 304, 329, 354, 379, 404, 429, 454, 479, 504, 529, 554, 579, 604, 250, 251, 252, 253, 300, 301, 302, 303, 325, 326, 327, 328, 350, 351, 352, 353}, {275, 276, 277, 278, 279, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 5, 30, 55, 80, 105, 130, 155, 180, 205, 230, 255, 305, 330, 355, 380, 405, 430, 455, 480, 505, 530, 555, 580, 605, 256, 257, 258, 259, 306, 307, 308, 309, 331, 332, 333, 334, 356, 357, 358, 359}, {275, 276, 277, 278, 279, 280, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 6, 31, 56, 81, 106, 131, 156, 181, 206, 231, 256, 306, 331, 356, 381, 406, 431, 456, 481, 506, 531, 556, 581, 606, 255, 257, 258, 259, 305, 307, 308, 309, 330, 332, 333, 334, 355, 357, 358, 359}, {275, 276, 277, 278, 279, 280, 281, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 7, 32, 57, 82, 107, 132, 157, 182, 207, 232, 257, 307, 332, 357, 382, 407, 432, 457, 482, 507, 532, 557, 582, 607, 255, 256, 258, 259, 305, 306, 308, 309, 330, 331, 333, 334, 355, 356, 358, 359}, {275, 276, 277, 278, 279, 280, 281, 282, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 8, 33, 58, 83, 108, 133, 158, 183, 208, 233, 258, 308, 333, 358, 383, 408, 433, 458, 483, 508, 533, 558, 583, 608, 255, 256, 257, 259, 305, 306, 307, 309, 330, 331, 332, 334, 355, 356, 357, 359}, {275, 276, 277, 278, 279, 280, 281, 282, 283, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 9, 34, 59, 84, 109, 134, 159, 184, 209, 234, 259, 309, 334, 359, 384, 409, 434, 459, 484, 509, 534, 559, 584, 609, 255, 256, 257, 258, 305, 306, 307, 308, 330, 331, 332, 333, 355, 356, 357, 358}, {275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 10, 35, 60, 85, 110, 135, 160, 185, 210, 235, 260, 310, 335, 360, 385, 410, 435, 460, 485, 510, 535, 560, 585, 610, 261, 262, 263, 264, 311, 312, 313, 314, 336, 337, 338, 339, 361, 362, 363, 364}, {275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 11, 36, 61, 86, 111, 136, 161, 186, 211, 236, 261, 311, 336, 361, 386, 411, 436, 461, 486, 511, 536, 561, 586, 611, 260, 262, 263, 264, 310, 312, 313, 314, 335, 337, 338, 339, 360, 362, 363, 364}, {275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 12, 37, 62, 87, 112, 137, 162, 187, 212, 237, 262, 312, 337, 362, 387, 412, 437, 462, 487, 512, 537, 562, 587, 612, 260, 261, 263, 264, 310, 311, 313, 314, 335, 336, 338, 339, 360, 361, 363, 364}, {275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 13, 38, 63, 88, 113, 138, 163, 188, 213, 238, 263, 313, 338, 363, 388, 413, 438, 463, 488, 513, 538, 563, 588, 613, 260, 261, 262, 264, 310, 311, 312, 314, 335, 336, 337, 339, 360, 361, 362, 364}, {275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 14, 39, 64, 89, 114, 139, 164, 189, 214, 239, 264, 314, 339, 364, 389, 414, 439, 464, 489, 514, 539, 564, 589, 614, 260, 261, 262, 263, 310, 311, 312, 313, 335, 336, 337, 338, 360, 361, 362, 363}, {275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 291, 292, 293, 294, 295, 296, 297, 298, 299, 15, 40, 65, 90, 115, 140, 165, 190, 215, 240, 265, 315, 340, 365, 390, 415, 440, 465, 490, 515, 540, 565, 590, 615, 266, 267, 268, 269, 316, 317, 318, 319, 341, 342, 343, 344, 366, 367, 368, 369}, {275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 292, 293, 294, 295, 296, 297, 298, 299, 16, 41, 66, 91, 116, 141, 166, 191, 216, 241, 266, 316, 341, 366, 391, 416, 441, 466, 491, 516, 541, 566, 591, 616, 265, 267, 268, 269, 315, 317, 318, 319, 340, 342, 343, 344, 365, 367, 368, 369}, {275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 293, 294, 295, 296, 297, 298, 299, 17, 42, 67, 92, 117, 142, 167, 192, 217, 242, 267, 317, 342, 367, 392, 417, 442, 467, 492, 517, 542, 567, 592, 617, 265, 266, 268, 269, 315, 316, 318, 319, 340, 341, 343, 344, 365, 366, 368, 369}, {275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 294, 295, 296, 297, 298, 299, 18, 43, 68, 93, 118, 143, 168, 193, 218, 243, 268, 318, 343, 368, 393, 418, 443, 468, 493, 518, 543, 568, 593, 618, 265, 266, 267, 269, 315, 316, 317, 319, 340, 341, 342, 344, 365, 366, 367, 369}, {275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 295, 296, 297, 298, 299, 19, 44, 69, 94, 119, 144, 169, 194, 219, 244, 269, 319, 344, 369, 394, 419, 444, 469, 494, 519, 544, 569, 594, 619, 265, 266, 267, 268, 315, 316, 317, 318, 340, 341, 342, 343, 365, 366, 367, 368}, {275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 296, 297, 298, 299, 20, 45, 70, 95, 120, 145, 170, 195, 220, 245, 270, 320, 345, 370, 395, 420, 445, 470, 495, 520, 545, 570, 595, 620, 271, 272, 273, 274, 321, 322, 323, 324, 346, 347, 348, 349, 371, 372, 373, 374}, {275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 297, 298, 299, 21, 46, 71, 96, 121, 146, 171, 196, 221, 246, 271, 321, 346, 371, 396, 421, 446, 471, 496, 521, 546, 571, 596, 621, 270, 272, 273, 274, 320, 322, 323, 324, 345, 347, 348, 349, 370, 372, 373, 374}, {275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 298, 299, 22, 47, 72, 97, 122, 147, 172, 197, 222, 247, 272, 322, 347, 372, 397, 422, 447, 472, 497, 522, 547, 572, 597, 622, 270, 271, 273, 274, 320, 321, 323, 324, 345, 346, 348, 349, 370, 371, 373, 374}, {275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 299, 23, 48, 73, 98, 123, 148, 173, 198, 223, 248, 273, 323, 348, 373, 398, 423, 448, 473, 498, 523, 548, 573, 598, 623, 270, 271, 272, 274, 320, 321, 322, 324, 345, 346, 347, 349, 370, 371, 372, 374}, {275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 24, 49, 74, 99, 124, 149, 174, 199, 224, 249, 274, 324, 349, 374, 399, 424, 449, 474, 499, 524, 549, 574, 599, 624, 270, 271, 272, 273, 320, 321, 322, 323, 345, 346, 347, 348, 370, 371, 372, 373}}, {{301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 0, 25, 50, 75, 100, 125, 150, 175, 200, 225, 250, 275, 325, 350, 375, 400, 425, 450, 475, 500, 525, 550, 575, 600, 251, 252, 253, 254, 276, 277, 278, 279, 326, 327, 328, 329, 351, 352, 353, 354}, {300, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 1, 26, 51, 76, 101, 126, 151, 176, 201, 226, 251, 276, 326, 351, 376, 401, 426, 451, 476, 501, 526, 551, 576, 601, 250, 252, 253, 254, 275, 277, 278, 279, 325, 327, 328, 329, 350, 352, 353, 354}, {300, 301, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 2, 27, 52, 77, 102, 127, 152, 177, 202, 227, 252, 277, 327, 352, 377, 402, 427, 452, 477, 502, 527, 552, 577, 602, 250, 251, 253, 254, 275, 276, 278, 279, 325, 326, 328, 329, 350, 351, 353, 354}, {300, 301, 302, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 3, 28, 53, 78, 103, 128, 153, 178, 203, 228, 253, 278, 328, 353, 378, 403, 428, 453, 478, 503, 528, 553, 578, 603, 250, 251, 252, 254, 275, 276, 277, 279, 325, 326, 327, 329, 350, 351, 352, 354}, {300, 301, 302, 303, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 4, 29, 54, 79, 104, 129, 154, 179, 204, 229, 254, 279, 329, 354, 379, 404, 429, 454, 479, 504, 529, 554, 579, 604, 250, 251, 252, 253, 275, 276, 277, 278, 325, 326, 327, 328, 350, 351, 352, 353}, {300, 301, 302, 303, 304, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 5, 30, 55, 80, 105, 130, 155, 180, 205, 230, 255, 280, 330, 355, 380, 405, 430, 455, 480, 505, 530, 555, 580, 605, 256, 257, 258, 259, 281, 282, 283, 284, 331, 332, 333, 334, 356, 357, 358, 359}, {300, 301, 302, 303, 304, 305, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 6, 31, 56, 81, 106, 131, 156, 181, 206, 231, 256, 281, 331, 356, 381, 406, 431, 456, 481, 506, 531, 556, 581, 606, 255, 257, 258, 259, 280, 282, 283, 284, 330, 332, 333, 334, 355, 357, 358, 359}, {300, 301, 302, 303, 304, 305, 306, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 7, 32, 57, 82, 107, 132, 157, 182, 207, 232, 257, 282, 332, 357, 382, 407, 432, 457, 482, 507, 532, 557, 582, 607, 255, 256, 258, 259, 280, 281, 283, 284, 330, 331, 333, 334, 355, 356, 358, 359}, {300, 301, 302, 303, 304, 305, 306, 307, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 8, 33, 58, 83, 108, 133, 158, 183, 208, 233, 258, 283, 333, 358, 383, 408, 433, 458, 483, 508, 533, 558, 583, 608, 255, 256, 257, 259, 280, 281, 282, 284, 330, 331, 332, 334, 355, 356, 357, 359}, {300, 301, 302, 303, 304, 305, 306, 307, 308, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 9, 34, 59, 84, 109, 134, 159, 184, 209, 234, 259, 284, 334, 359, 384, 409, 434, 459, 484, 509, 534, 559, 584, 609, 255, 256, 257, 258, 280, 281, 282, 283, 330, 331, 332, 333, 355, 356, 357, 358}, {300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 10, 35, 60, 85, 110, 135, 160, 185, 210, 235, 260, 285, 335, 360, 385, 410, 435, 460, 485, 510, 535, 560, 585, 610, 261, 262, 263, 264, 286, 287, 288, 289, 336, 337, 338, 339, 361, 362, 363, 364}, {300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 11, 36, 61, 86, 111, 136, 161, 186, 211, 236, 261, 286, 336, 361, 386, 411, 436, 461, 486, 511, 536, 561, 586, 611, 260, 262, 263, 264, 285, 287, 288, 289, 335, 337, 338, 339, 360, 362, 363, 364}, {300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 12, 37, 62, 87, 112, 137, 162, 187, 212, 237, 262, 287, 337, 362, 387, 412, 437, 462, 487, 512, 537, 562, 587, 612, 260, 261, 263, 264, 285, 286, 288, 289, 335, 336, 338, 339, 360, 361, 363, 364}, {300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 13, 38, 63, 88, 113, 138, 163, 188, 213, 238, 263, 288, 338, 363, 388, 413, 438, 463, 488, 513, 538, 563, 588, 613, 260, 261, 262, 264, 285, 286, 287, 289, 335, 336, 337, 339, 360, 361, 362, 364}, {300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 14, 39, 64, 89, 114, 139, 164, 189, 214, 239, 264, 289, 339, 364, 389, 414, 439, 464, 489, 514, 539, 564, 589, 614, 260, 261, 262, 263, 285, 286, 287, 288, 335, 336, 337, 338, 360, 361, 362, 363}, {300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 316, 317, 318, 319, 320, 321, 322, 323, 324, 15, 40, 65, 90, 115, 140, 165, 190, 215, 240, 265, 290, 340, 365, 390, 415, 440, 465, 490, 515, 540, 565, 590, 615, 266, 267, 268, 269, 291, 292, 293, 294, 341, 342, 343, 344, 366, 367, 368, 369}, {300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 317, 318, 319, 320, 321, 322, 323, 324, 16, 41, 66, 91, 116, 141, 166, 191, 216, 241, 266, 291, 341, 366, 391, 416, 441, 466, 491, 516, 541, 566, 591, 616, 265, 267, 268, 269, 290, 292, 293, 294, 340, 342, 343, 344, 365, 367, 368, 369}, {300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 318, 319, 320, 321, 322, 323, 324, 17, 42, 67, 92, 117, 142, 167, 192, 217, 242, 267, 292, 342, 367, 392, 417, 442, 467, 492, 517, 542, 567, 592, 617, 265, 266, 268, 269, 290, 291, 293, 294, 340, 341, 343, 344, 365, 366, 368, 369}, {300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 319, 320, 321, 322, 323, 324, 18, 43, 68, 93, 118, 143, 168, 193, 218, 243, 268, 293, 343, 368, 393, 418, 443, 468, 493, 518, 543, 568, 593, 618, 265, 266, 267, 269, 290, 291, 292, 294, 340, 341, 342, 344, 365, 366, 367, 369}, {300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 320, 321, 322, 323, 324, 19, 44, 69, 94, 119, 144, 169, 194, 219, 244, 269, 294, 344, 369, 394, 419, 444, 469, 494, 519, 544, 569, 594, 619, 265, 266, 267, 268, 290, 291, 292, 293, 340, 341, 342, 343, 365, 366, 367, 368}, {300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 321, 322, 323, 324, 20, 45, 70, 95, 120, 145, 170, 195, 220, 245, 270, 295, 345, 370, 395, 420, 445, 470, 495, 520, 545, 570, 595, 620, 271, 272, 273, 274, 296, 297, 298, 299, 346, 347, 348, 349, 371, 372, 373, 374}, {300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 322, 323, 324, 21, 46, 71, 96, 121, 146, 171, 196, 221, 246, 271, 296, 346, 371, 396, 421, 446, 471, 496, 521, 546, 571, 596, 621, 270, 272, 273, 274, 295, 297, 298, 299, 345, 347, 348, 349, 370, 372, 373, 374}, {300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 323, 324, 22, 47, 72, 97, 122, 147, 172, 197, 222, 247, 272, 297, 347, 372, 397, 422, 447, 472, 497, 522, 547, 572, 597, 622, 270, 271, 273, 274, 295, 296, 298, 299, 345, 346, 348, 349, 370, 371, 373, 374}, {300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 324, 23, 48, 73, 98, 123, 148, 173, 198, 223, 248, 273, 298, 348, 373, 398, 423, 448, 473, 498, 523, 548, 573, 598, 623, 270, 271, 272, 274, 295, 296, 297, 299, 345, 346, 347, 349, 370, 371, 372, 374}, {300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 24, 49, 74, 99, 124, 149, 174, 199, 224, 249, 274, 299, 349, 374, 399, 424, 449, 474, 499, 524, 549, 574, 599, 624, 270, 271, 272, 273, 295, 296, 297, 298, 345, 346, 347, 348, 370, 371, 372, 373}}, {{326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 0, 25, 50, 75, 100, 125, 150, 175, 200, 225, 250, 275, 300, 350, 375, 400, 425, 450, 475, 500, 525, 550, 575, 600, 251, 252, 253, 254, 276, 277, 278, 279, 301, 302, 303, 304, 351, 352, 353, 354}, {325, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 1, 26, 51, 76, 101, 126, 151, 176, 201, 226, 251, 276, 301, 351, 376, 401, 426, 451, 476, 501, 526, 551, 576, 601, 250, 252, 253, 254, 275, 277, 278, 279, 300, 302, 303, 304, 350, 352, 353, 354}, {325, 326, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 2, 27, 52, 77, 102, 127, 152, 177, 202, 227, 252, 277, 302, 352, 377, 402, 427, 452, 477, 502, 527, 552, 577, 602, 250, 251, 253, 254, 275, 276, 278, 279, 300, 301, 303, 304, 350, 351, 353, 354}, {325, 326, 327, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 3, 28, 53, 78, 103, 128, 153, 178, 203, 228, 253, 278, 303, 353, 378, 403, 428, 453, 478, 503, 528, 553, 578, 603, 250, 251, 252, 254, 275, 276, 277, 279, 300, 301, 302, 304, 350, 351, 352, 354}, {325, 326, 327, 328, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 4, 29, 54, 79, 104, 129, 154, 179, 204, 229, 254, 279, 304, 354, 379, 404, 429, 454, 479, 504, 529, 554, 579, 604, 250, 251, 252, 253, 275, 276, 277, 278, 300, 301, 302, 303, 350, 351, 352, 353}, {325, 326, 327, 328, 329, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 5, 30, 55, 80, 105, 130, 155, 180, 205, 230, 255, 280, 305, 355, 380, 405, 430, 455, 480, 505, 530, 555, 580, 605, 256, 257, 258, 259, 281, 282, 283, 284, 306, 307, 308, 309, 356, 357, 358, 359}, {325, 326, 327, 328, 329, 330, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 6, 31, 56, 81, 106, 131, 156, 181, 206, 231, 256, 281, 306, 356, 381, 406, 431, 456, 481, 506, 531, 556, 581, 606, 255, 257, 258, 259, 280, 282, 283, 284, 305, 307, 308, 309, 355, 357, 358, 359}, {325, 326, 327, 328, 329, 330, 331, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 7, 32, 57, 82, 107, 132, 157, 182, 207, 232, 257, 282, 307, 357, 382, 407, 432, 457, 482, 507, 532, 557, 582, 607, 255, 256, 258, 259, 280, 281, 283, 284, 305, 306, 308, 309, 355, 356, 358, 359}, {325, 326, 327, 328, 329, 330, 331, 332, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 8, 33, 58, 83, 108, 133, 158, 183, 208, 233, 258, 283, 308, 358, 383, 408, 433, 458, 483, 508, 533, 558, 583, 608, 255, 256, 257, 259, 280, 281, 282, 284, 305, 306, 307, 309, 355, 356, 357, 359}, {325, 326, 327, 328, 329, 330, 331, 332, 333, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 9, 34, 59, 84, 109, 134, 159, 184, 209, 234, 259, 284, 309, 359, 384, 409, 434, 459, 484, 509, 534, 559, 584, 609, 255, 256, 257, 258, 280, 281, 282, 283, 305, 306, 307, 308, 355, 356, 357, 358}, {325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 10, 35, 60, 85, 110, 135, 160, 185, 210, 235, 260, 285, 310, 360, 385, 410, 435, 460, 485, 510, 535, 560, 585, 610, 261, 262, 263, 264, 286, 287, 288, 289, 311, 312, 313, 314, 361, 362, 363, 364}, {325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 11, 36, 61, 86, 111, 136, 161, 186, 211, 236, 261, 286, 311, 361, 386, 411, 436, 461, 486, 511, 536, 561, 586, 611, 260, 262, 263, 264, 285, 287, 288, 289, 310, 312, 313, 314, 360, 362, 363, 364}, {325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 12, 37, 62, 87, 112, 137, 162, 187, 212, 237, 262, 287, 312, 362, 387, 412, 437, 462, 487, 512, 537, 562, 587, 612, 260, 261, 263, 264, 285, 286, 288, 289, 310, 311, 313, 314, 360, 361, 363, 364}, {325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 13, 38, 63, 88, 113, 138, 163, 188, 213, 238, 263, 288, 313, 363, 388, 413, 438, 463, 488, 513, 538, 563, 588, 613, 260, 261, 262, 264, 285, 286, 287, 289, 310, 311, 312, 314, 360, 361, 362, 364}, {325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 14, 39, 64, 89, 114, 139, 164, 189, 214, 239, 264, 289, 314, 364, 389, 414, 439, 464, 489, 514, 539, 564, 589, 614, 260, 261, 262, 263, 285, 286, 287, 288, 310, 311, 312, 313, 360, 361, 362, 363}, {325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 341, 342, 343, 344, 345, 346, 347, 348, 349, 15, 40, 65, 90, 115, 140, 165, 190, 215, 240, 265, 290, 315, 365, 390, 415, 440, 465, 490, 515, 540, 565, 590, 615, 266, 267, 268, 269, 291, 292, 293, 294, 316, 317, 318, 319, 366, 367, 368, 369}, {325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 342, 343, 344, 345, 346, 347, 348, 349, 16, 41, 66, 91, 116, 141, 166, 191, 216, 241, 266, 291, 316, 366, 391, 416, 441, 466, 491, 516, 541, 566, 591, 616, 265, 267, 268, 269, 290, 292, 293, 294, 315, 317, 318, 319, 365, 367, 368, 369}, {325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 343, 344, 345, 346, 347, 348, 349, 17, 42, 67, 92, 117, 142, 167, 192, 217, 242, 267, 292, 317, 367, 392, 417, 442, 467, 492, 517, 542, 567, 592, 617, 265, 266, 268, 269, 290, 291, 293, 294, 315, 316, 318, 319, 365, 366, 368, 369}, {325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 344, 345, 346, 347, 348, 349, 18, 43, 68, 93, 118, 143, 168, 193, 218, 243, 268, 293, 318, 368, 393, 418, 443, 468, 493, 518, 543, 568, 593, 618, 265, 266, 267, 269, 290, 291, 292, 294, 315, 316, 317, 319, 365, 366, 367, 369}, {325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 345, 346, 347, 348, 349, 19, 44, 69, 94, 119, 144, 169, 194, 219, 244, 269, 294, 319, 369, 394, 419, 444, 469, 494, 519, 544, 569, 594, 619, 265, 266, 267, 268, 290, 291, 292, 293, 315, 316, 317, 318, 365, 366, 367, 368}, {325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 346, 347, 348, 349, 20, 45, 70, 95, 120, 145, 170, 195, 220, 245, 270, 295, 320, 370, 395, 420, 445, 470, 495, 520, 545, 570, 595, 620, 271, 272, 273, 274, 296, 297, 298, 299, 321, 322, 323, 324, 371, 372, 373, 374}, {325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 347, 348, 349, 21, 46, 71, 96, 121, 146, 171, 196, 221, 246, 271, 296, 321, 371, 396, 421, 446, 471, 496, 521, 546, 571, 596, 621, 270, 272, 273, 274, 295, 297, 298, 299, 320, 322, 323, 324, 370, 372, 373, 374}, {325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 348, 349, 22, 47, 72, 97, 122, 147, 172, 197, 222, 247, 272, 297, 322, 372, 397, 422, 447, 472, 497, 522, 547, 572, 597, 622, 270, 271, 273, 274, 295, 296, 298, 299, 320, 321, 323, 324, 370, 371, 373, 374}, {325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 349, 23, 48, 73, 98, 123, 148, 173, 198, 223, 248, 273, 298, 323, 373, 398, 423, 448, 473, 498, 523, 548, 573, 598, 623, 270, 271, 272, 274, 295, 296, 297, 299, 320, 321, 322, 324, 370, 371, 372, 374}, {325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 24, 49, 74, 99, 124, 149, 174, 199, 224, 249, 274, 299, 324, 374, 399, 424, 449, 474, 499, 524, 549, 574, 599, 624, 270, 271, 272, 273, 295, 296, 297, 298, 320, 321, 322, 323, 370, 371, 372, 373}}, {{351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 0, 25, 50, 75, 100, 125, 150, 175, 200, 225, 250, 275, 300, 325, 375, 400, 425, 450, 475, 500, 525, 550, 575, 600, 251, 252, 253, 254, 276, 277, 278, 279, 301, 302, 303, 304, 326, 327, 328, 329}, {350, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 1, 26, 51, 76, 101, 126, 151, 176, 201, 226, 251, 276, 301, 326, 376, 401, 426, 451, 476, 501, 526, 551, 576, 601, 250, 252, 253, 254, 275, 277, 278, 279, 300, 302, 303, 304, 325, 327, 328, 329}, {350, 351, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 2, 27, 52, 77, 102, 127, 152, 177, 202, 227, 252, 277, 302, 327, 377, 402, 427, 452, 477, 502, 527, 552, 577, 602, 250, 251, 253, 254, 275, 276, 278, 279, 300, 301, 303, 304, 325, 326, 328, 329}, {350, 351, 352, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 3, 28, 53, 78, 103, 128, 153, 178, 203, 228, 253, 278, 303, 328, 378, 403, 428, 453, 478, 503, 528, 553, 578, 603, 250, 251, 252, 254, 275, 276, 277, 279, 300, 301, 302, 304, 325, 326, 327, 329}, {350, 351, 352, 353, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 4, 29, 54, 79, 104, 129, 154, 179, 204, 229, 254, 279, 304, 329, 379, 404, 429, 454, 479, 504, 529, 554, 579, 604, 250, 251, 252, 253, 275, 276, 277, 278, 300, 301, 302, 303, 325, 326, 327, 328}, {350, 351, 352, 353, 354, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 5, 30, 55, 80, 105, 130, 155, 180, 205, 230, 255, 280, 305, 330, 380, 405, 430, 455, 480, 505, 530, 555, 580, 605, 256, 257, 258, 259, 281, 282, 283, 284, 306, 307, 308, 309, 331, 332, 333, 334}, {350, 351, 352, 353, 354, 355, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 6, 31, 56, 81, 106, 131, 156, 181, 206, 231, 256, 281, 306, 331, 381, 406, 431, 456, 481, 506, 531, 556, 581, 606, 255, 257, 258, 259, 280, 282, 283, 284, 305, 307, 308, 309, 330, 332, 333, 334}, {350, 351, 352, 353, 354, 355, 356, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 7, 32, 57, 82, 107, 132, 157, 182, 207, 232, 257, 282, 307, 332, 382, 407, 432, 457, 482, 507, 532, 557, 582, 607, 255, 256, 258, 259, 280, 281, 283, 284, 305, 306, 308, 309, 330, 331, 333, 334}, {350, 351, 352, 353, 354, 355, 356, 357, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 8, 33, 58, 83, 108, 133, 158, 183, 208, 233, 258, 283, 308, 333, 383, 408, 433, 458, 483, 508, 533, 558, 583, 608, 255, 256, 257, 259, 280, 281, 282, 284, 305, 306, 307, 309, 330, 331, 332, 334}, {350, 351, 352, 353, 354, 355, 356, 357, 358, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 9, 34, 59, 84, 109, 134, 159, 184, 209, 234, 259, 284, 309, 334, 384, 409, 434, 459, 484, 509, 534, 559, 584, 609, 255, 256, 257, 258, 280, 281, 282, 283, 305, 306, 307, 308, 330, 331, 332, 333}, {350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 10, 35, 60, 85, 110, 135, 160, 185, 210, 235, 260, 285, 310, 335, 385, 410, 435, 460, 485, 510, 535, 560, 585, 610, 261, 262, 263, 264, 286, 287, 288, 289, 311, 312, 313, 314, 336, 337, 338, 339}, {350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 11, 36, 61, 86, 111, 136, 161, 186, 211, 236, 261, 286, 311, 336, 386, 411, 436, 461, 486, 511, 536, 561, 586, 611, 260, 262, 263, 264, 285, 287, 288, 289, 310, 312, 313, 314, 335, 337, 338, 339}, {350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 12, 37, 62, 87, 112, 137, 162, 187, 212, 237, 262, 287, 312, 337, 387, 412, 437, 462, 487, 512, 537, 562, 587, 612, 260, 261, 263, 264, 285, 286, 288, 289, 310, 311, 313, 314, 335, 336, 338, 339}, {350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 13, 38, 63, 88, 113, 138, 163, 188, 213, 238, 263, 288, 313, 338, 388, 413, 438, 463, 488, 513, 538, 563, 588, 613, 260, 261, 262, 264, 285, 286, 287, 289, 310, 311, 312, 314, 335, 336, 337, 339}, {350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 14, 39, 64, 89, 114, 139, 164, 189, 214, 239, 264, 289, 314, 339, 389, 414, 439, 464, 489, 514, 539, 564, 589, 614, 260, 261, 262, 263, 285, 286, 287, 288, 310, 311, 312, 313, 335, 336, 337, 338}, {350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 366, 367, 368, 369, 370, 371, 372, 373, 374, 15, 40, 65, 90, 115, 140, 165, 190, 215, 240, 265, 290, 315, 340, 390, 415, 440, 465, 490, 515, 540, 565, 590, 615, 266, 267, 268, 269, 291, 292, 293, 294, 316, 317, 318, 319, 341, 342, 343, 344}, {350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 367, 368, 369, 370, 371, 372, 373, 374, 16, 41, 66, 91, 116, 141, 166, 191, 216, 241, 266, 291, 316, 341, 391, 416, 441, 466, 491, 516, 541, 566, 591, 616, 265, 267, 268, 269, 290, 292, 293, 294, 315, 317, 318, 319, 340, 342, 343, 344}, {350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 368, 369, 370, 371, 372, 373, 374, 17, 42, 67, 92, 117, 142, 167, 192, 217, 242, 267, 292, 317, 342, 392, 417, 442, 467, 492, 517, 542, 567, 592, 617, 265, 266, 268, 269, 290, 291, 293, 294, 315, 316, 318, 319, 340, 341, 343, 344}, {350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 369, 370, 371, 372, 373, 374, 18, 43, 68, 93, 118, 143, 168, 193, 218, 243, 268, 293, 318, 343, 393, 418, 443, 468, 493, 518, 543, 568, 593, 618, 265, 266, 267, 269, 290, 291, 292, 294, 315, 316, 317, 319, 340, 341, 342, 344}, {350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 370, 371, 372, 373, 374, 19, 44, 69, 94, 119, 144, 169, 194, 219, 244, 269, 294, 319, 344, 394, 419, 444, 469, 494, 519, 544, 569, 594, 619, 265, 266, 267, 268, 290, 291, 292, 293, 315, 316, 317, 318, 340, 341, 342, 343}, {350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 371, 372, 373, 374, 20, 45, 70, 95, 120, 145, 170, 195, 220, 245, 270, 295, 320, 345, 395, 420, 445, 470, 495, 520, 545, 570, 595, 620, 271, 272, 273, 274, 296, 297, 298, 299, 321, 322, 323, 324, 346, 347, 348, 349}, {350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 372, 373, 374, 21, 46, 71, 96, 121, 146, 171, 196, 221, 246, 271, 296, 321, 346, 396, 421, 446, 471, 496, 521, 546, 571, 596, 621, 270, 272, 273, 274, 295, 297, 298, 299, 320, 322, 323, 324, 345, 347, 348, 349}, {350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 373, 374, 22, 47, 72, 97, 122, 147, 172, 197, 222, 247, 272, 297, 322, 347, 397, 422, 447, 472, 497, 522, 547, 572, 597, 622, 270, 271, 273, 274, 295, 296, 298, 299, 320, 321, 323, 324, 345, 346, 348, 349}, {350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 374, 23, 48, 73, 98, 123, 148, 173, 198, 223, 248, 273, 298, 323, 348, 398, 423, 448, 473, 498, 523, 548, 573, 598, 623, 270, 271, 272, 274, 295, 296, 297, 299, 320, 321, 322, 324, 345, 346, 347, 349}, {350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 24, 49, 74, 99, 124, 149, 174, 199, 224, 249, 274, 299, 324, 349, 399, 424, 449, 474, 499, 524, 549, 574, 599, 624, 270, 271, 272, 273, 295, 296, 297, 298, 320, 321, 322, 323, 345, 346, 347, 348}}, {{376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 0, 25, 50, 75, 100, 125, 150, 175, 200, 225, 250, 275, 300, 325, 350, 400, 425, 450, 475, 500, 525, 550, 575, 600, 401, 402, 403, 404, 426, 427, 428, 429, 451, 452, 453, 454, 476, 477, 478, 479}, {375, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 1, 26, 51, 76, 101, 126, 151, 176, 201, 226, 251, 276, 301, 326, 351, 401, 426, 451, 476, 501, 526, 551, 576, 601, 400, 402, 403, 404, 425, 427, 428, 429, 450, 452, 453, 454, 475, 477, 478, 479}, {375, 376, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 2, 27, 52, 77, 102, 127, 152, 177, 202, 227, 252, 277, 302, 327, 352, 402, 427, 452, 477, 502, 527, 552, 577, 602, 400, 401, 403, 404, 425, 426, 428, 429, 450, 451, 453, 454, 475, 476, 478, 479}, {375, 376, 377, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 3, 28, 53, 78, 103, 128, 153, 178, 203, 228, 253, 278, 303, 328, 353, 403, 428, 453, 478, 503, 528, 553, 578, 603, 400, 401, 402, 404, 425, 426, 427, 429, 450, 451, 452, 454, 475, 476, 477, 479}, {375, 376, 377, 378, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 4, 29, 54, 79, 104, 129, 154, 179, 204, 229, 254, 279, 304, 329, 354, 404, 429, 454, 479, 504, 529, 554, 579, 604, 400, 401, 402, 403, 425, 426, 427, 428, 450, 451, 452, 453, 475, 476, 477, 478}, {375, 376, 377, 378, 379, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 5, 30, 55, 80, 105, 130, 155, 180, 205, 230, 255, 280, 305, 330, 355, 405, 430, 455, 480, 505, 530, 555, 580, 605, 406, 407, 408, 409, 431, 432, 433, 434, 456, 457, 458, 459, 481, 482, 483, 484}, {375, 376, 377, 378, 379, 380, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 6, 31, 56, 81, 106, 131, 156, 181, 206, 231, 256, 281, 306, 331, 356, 406, 431, 456, 481, 506, 531, 556, 581, 606, 405, 407, 408, 409, 430, 432, 433, 434, 455, 457, 458, 459, 480, 482, 483, 484}, {375, 376, 377, 378, 379, 380, 381, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 7, 32, 57, 82, 107, 132, 157, 182, 207, 232, 257, 282, 307, 332, 357, 407, 432, 457, 482, 507, 532, 557, 582, 607, 405, 406, 408, 409, 430, 431, 433, 434, 455, 456, 458, 459, 480, 481, 483, 484}, {375, 376, 377, 378, 379, 380, 381, 382, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 8, 33, 58, 83, 108, 133, 158, 183, 208, 233, 258, 283, 308, 333, 358, 408, 433, 458, 483, 508, 533, 558, 583, 608, 405, 406, 407, 409, 430, 431, 432, 434, 455, 456, 457, 459, 480, 481, 482, 484}, {375, 376, 377, 378, 379, 380, 381, 382, 383, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 9, 34, 59, 84, 109, 134, 159, 184, 209, 234, 259, 284, 309, 334, 359, 409, 434, 459, 484, 509, 534, 559, 584, 609, 405, 406, 407, 408, 430, 431, 432, 433, 455, 456, 457, 458, 480, 481, 482, 483}, {375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 10, 35, 60, 85, 110, 135, 160, 185, 210, 235, 260, 285, 310, 335, 360, 410, 435, 460, 485, 510, 535, 560, 585, 610, 411, 412, 413, 414, 436, 437, 438, 439, 461, 462, 463, 464, 486, 487, 488, 489}, {375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 11, 36, 61, 86, 111, 136, 161, 186, 211, 236, 261, 286, 311, 336, 361, 411, 436, 461, 486, 511, 536, 561, 586, 611, 410, 412, 413, 414, 435, 437, 438, 439, 460, 462, 463, 464, 485, 487, 488, 489}, {375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 12, 37, 62, 87, 112, 137, 162, 187, 212, 237, 262, 287, 312, 337, 362, 412, 437, 462, 487, 512, 537, 562, 587, 612, 410, 411, 413, 414, 435, 436, 438, 439, 460, 461, 463, 464, 485, 486, 488, 489}, {375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 13, 38, 63, 88, 113, 138, 163, 188, 213, 238, 263, 288, 313, 338, 363, 413, 438, 463, 488, 513, 538, 563, 588, 613, 410, 411, 412, 414, 435, 436, 437, 439, 460, 461, 462, 464, 485, 486, 487, 489}, {375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 14, 39, 64, 89, 114, 139, 164, 189, 214, 239, 264, 289, 314, 339, 364, 414, 439, 464, 489, 514, 539, 564, 589, 614, 410, 411, 412, 413, 435, 436, 437, 438, 460, 461, 462, 463, 485, 486, 487, 488}, {375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 391, 392, 393, 394, 395, 396, 397, 398, 399, 15, 40, 65, 90, 115, 140, 165, 190, 215, 240, 265, 290, 315, 340, 365, 415, 440, 465, 490, 515, 540, 565, 590, 615, 416, 417, 418, 419, 441, 442, 443, 444, 466, 467, 468, 469, 491, 492, 493, 494}, {375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 392, 393, 394, 395, 396, 397, 398, 399, 16, 41, 66, 91, 116, 141, 166, 191, 216, 241, 266, 291, 316, 341, 366, 416, 441, 466, 491, 516, 541, 566, 591, 616, 415, 417, 418, 419, 440, 442, 443, 444, 465, 467, 468, 469, 490, 492, 493, 494}, {375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 393, 394, 395, 396, 397, 398, 399, 17, 42, 67, 92, 117, 142, 167, 192, 217, 242, 267, 292, 317, 342, 367, 417, 442, 467, 492, 517, 542, 567, 592, 617, 415, 416, 418, 419, 440, 441, 443, 444, 465, 466, 468, 469, 490, 491, 493, 494}, {375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 394, 395, 396, 397, 398, 399, 18, 43, 68, 93, 118, 143, 168, 193, 218, 243, 268, 293, 318, 343, 368, 418, 443, 468, 493, 518, 543, 568, 593, 618, 415, 416, 417, 419, 440, 441, 442, 444, 465, 466, 467, 469, 490, 491, 492, 494}, {375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 395, 396, 397, 398, 399, 19, 44, 69, 94, 119, 144, 169, 194, 219, 244, 269, 294, 319, 344, 369, 419, 444, 469, 494, 519, 544, 569, 594, 619, 415, 416, 417, 418, 440, 441, 442, 443, 465, 466, 467, 468, 490, 491, 492, 493}, {375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 396, 397, 398, 399, 20, 45, 70, 95, 120, 145, 170, 195, 220, 245, 270, 295, 320, 345, 370, 420, 445, 470, 495, 520, 545, 570, 595, 620, 421, 422, 423, 424, 446, 447, 448, 449, 471, 472, 473, 474, 496, 497, 498, 499}, {375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 397, 398, 399, 21, 46, 71, 96, 121, 146, 171, 196, 221, 246, 271, 296, 321, 346, 371, 421, 446, 471, 496, 521, 546, 571, 596, 621, 420, 422, 423, 424, 445, 447, 448, 449, 470, 472, 473, 474, 495, 497, 498, 499}, {375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 398, 399, 22, 47, 72, 97, 122, 147, 172, 197, 222, 247, 272, 297, 322, 347, 372, 422, 447, 472, 497, 522, 547, 572, 597, 622, 420, 421, 423, 424, 445, 446, 448, 449, 470, 471, 473, 474, 495, 496, 498, 499}, {375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 399, 23, 48, 73, 98, 123, 148, 173, 198, 223, 248, 273, 298, 323, 348, 373, 423, 448, 473, 498, 523, 548, 573, 598, 623, 420, 421, 422, 424, 445, 446, 447, 449, 470, 471, 472, 474, 495, 496, 497, 499}, {375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 24, 49, 74, 99, 124, 149, 174, 199, 224, 249, 274, 299, 324, 349, 374, 424, 449, 474, 499, 524, 549, 574, 599, 624, 420, 421, 422, 423, 445, 446, 447, 448, 470, 471, 472, 473, 495, 496, 497, 498}}, {{401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 0, 25, 50, 75, 100, 125, 150, 175, 200, 225, 250, 275, 300, 325, 350, 375, 425, 450, 475, 500, 525, 550, 575, 600, 376, 377, 378, 379, 426, 427, 428, 429, 451, 452, 453, 454, 476, 477, 478, 479}, {400, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 1, 26, 51, 76, 101, 126, 151, 176, 201, 226, 251, 276, 301, 326, 351, 376, 426, 451, 476, 501, 526, 551, 576, 601, 375, 377, 378, 379, 425, 427, 428, 429, 450, 452, 453, 454, 475, 477, 478, 479}, {400, 401, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 2, 27, 52, 77, 102, 127, 152, 177, 202, 227, 252, 277, 302, 327, 352, 377, 427, 452, 477, 502, 527, 552, 577, 602, 375, 376, 378, 379, 425, 426, 428, 429, 450, 451, 453, 454, 475, 476, 478, 479}, {400, 401, 402, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 3, 28, 53, 78, 103, 128, 153, 178, 203, 228, 253, 278, 303, 328, 353, 378, 428, 453, 478, 503, 528, 553, 578, 603, 375, 376, 377, 379, 425, 426, 427, 429, 450, 451, 452, 454, 475, 476, 477, 479}, {400, 401, 402, 403, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 4, 29, 54, 79, 104, 129, 154, 179, 204, 229, 254, 279, 304, 329, 354, 379, 429, 454, 479, 504, 529, 554, 579, 604, 375, 376, 377, 378, 425, 426, 427, 428, 450, 451, 452, 453, 475, 476, 477, 478}, {400, 401, 402, 403, 404, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 5, 30, 55, 80, 105, 130, 155, 180, 205, 230, 255, 280, 305, 330, 355, 380, 430, 455, 480, 505, 530, 555, 580, 605, 381, 382, 383, 384, 431, 432, 433, 434, 456, 457, 458, 459, 481, 482, 483, 484}, {400, 401, 402, 403, 404, 405, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 6, 31, 56, 81, 106, 131, 156, 181, 206, 231, 256, 281, 306, 331, 356, 381, 431, 456, 481, 506, 531, 556, 581, 606, 380, 382, 383, 384, 430, 432, 433, 434, 455, 457, 458, 459, 480, 482, 483, 484}, {400, 401, 402, 403, 404, 405, 406, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 7, 32, 57, 82, 107, 132, 157, 182, 207, 232, 257, 282, 307, 332, 357, 382, 432, 457, 482, 507, 532, 557, 582, 607, 380, 381, 383, 384, 430, 431, 433, 434, 455, 456, 458, 459, 480, 481, 483, 484}, {400, 401, 402, 403, 404, 405, 406, 407, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 8, 33, 58, 83, 108, 133, 158, 183, 208, 233, 258, 283, 308, 333, 358, 383, 433, 458, 483, 508, 533, 558, 583, 608, 380, 381, 382, 384, 430, 431, 432, 434, 455, 456, 457, 459, 480, 481, 482, 484}, {400, 401, 402, 403, 404, 405, 406, 407, 408, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 9, 34, 59, 84, 109, 134, 159, 184, 209, 234, 259, 284, 309, 334, 359, 384, 434, 459, 484, 509, 534, 559, 584, 609, 380, 381, 382, 383, 430, 431, 432, 433, 455, 456, 457, 458, 480, 481, 482, 483}, {400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 10, 35, 60, 85, 110, 135, 160, 185, 210, 235, 260, 285, 310, 335, 360, 385, 435, 460, 485, 510, 535, 560, 585, 610, 386, 387, 388, 389, 436, 437, 438, 439, 461, 462, 463, 464, 486, 487, 488, 489}, {400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 11, 36, 61, 86, 111, 136, 161, 186, 211, 236, 261, 286, 311, 336, 361, 386, 436, 461, 486, 511, 536, 561, 586, 611, 385, 387, 388, 389, 435, 437, 438, 439, 460, 462, 463, 464, 485, 487, 488, 489}, {400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 12, 37, 62, 87, 112, 137, 162, 187, 212, 237, 262, 287, 312, 337, 362, 387, 437, 462, 487, 512, 537, 562, 587, 612, 385, 386, 388, 389, 435, 436, 438, 439, 460, 461, 463, 464, 485, 486, 488, 489}, {400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 13, 38, 63, 88, 113, 138, 163, 188, 213, 238, 263, 288, 313, 338, 363, 388, 438, 463, 488, 513, 538, 563, 588, 613, 385, 386, 387, 389, 435, 436, 437, 439, 460, 461, 462, 464, 485, 486, 487, 489}, {400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 14, 39, 64, 89, 114, 139, 164, 189, 214, 239, 264, 289, 314, 339, 364, 389, 439, 464, 489, 514, 539, 564, 589, 614, 385, 386, 387, 388, 435, 436, 437, 438, 460, 461, 462, 463, 485, 486, 487, 488}, {400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 416, 417, 418, 419, 420, 421, 422, 423, 424, 15, 40, 65, 90, 115, 140, 165, 190, 215, 240, 265, 290, 315, 340, 365, 390, 440, 465, 490, 515, 540, 565, 590, 615, 391, 392, 393, 394, 441, 442, 443, 444, 466, 467, 468, 469, 491, 492, 493, 494}, {400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 417, 418, 419, 420, 421, 422, 423, 424, 16, 41, 66, 91, 116, 141, 166, 191, 216, 241, 266, 291, 316, 341, 366, 391, 441, 466, 491, 516, 541, 566, 591, 616, 390, 392, 393, 394, 440, 442, 443, 444, 465, 467, 468, 469, 490, 492, 493, 494}, {400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 418, 419, 420, 421, 422, 423, 424, 17, 42, 67, 92, 117, 142, 167, 192, 217, 242, 267, 292, 317, 342, 367, 392, 442, 467, 492, 517, 542, 567, 592, 617, 390, 391, 393, 394, 440, 441, 443, 444, 465, 466, 468, 469, 490, 491, 493, 494}, {400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 419, 420, 421, 422, 423, 424, 18, 43, 68, 93, 118, 143, 168, 193, 218, 243, 268, 293, 318, 343, 368, 393, 443, 468, 493, 518, 543, 568, 593, 618, 390, 391, 392, 394, 440, 441, 442, 444, 465, 466, 467, 469, 490, 491, 492, 494}, {400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 420, 421, 422, 423, 424, 19, 44, 69, 94, 119, 144, 169, 194, 219, 244, 269, 294, 319, 344, 369, 394, 444, 469, 494, 519, 544, 569, 594, 619, 390, 391, 392, 393, 440, 441, 442, 443, 465, 466, 467, 468, 490, 491, 492, 493}, {400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 421, 422, 423, 424, 20, 45, 70, 95, 120, 145, 170, 195, 220, 245, 270, 295, 320, 345, 370, 395, 445, 470, 495, 520, 545, 570, 595, 620, 396, 397, 398, 399, 446, 447, 448, 449, 471, 472, 473, 474, 496, 497, 498, 499}, {400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 422, 423, 424, 21, 46, 71, 96, 121, 146, 171, 196, 221, 246, 271, 296, 321, 346, 371, 396, 446, 471, 496, 521, 546, 571, 596, 621, 395, 397, 398, 399, 445, 447, 448, 449, 470, 472, 473, 474, 495, 497, 498, 499}, {400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 423, 424, 22, 47, 72, 97, 122, 147, 172, 197, 222, 247, 272, 297, 322, 347, 372, 397, 447, 472, 497, 522, 547, 572, 597, 622, 395, 396, 398, 399, 445, 446, 448, 449, 470, 471, 473, 474, 495, 496, 498, 499}, {400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 424, 23, 48, 73, 98, 123, 148, 173, 198, 223, 248, 273, 298, 323, 348, 373, 398, 448, 473, 498, 523, 548, 573, 598, 623, 395, 396, 397, 399, 445, 446, 447, 449, 470, 471, 472, 474, 495, 496, 497, 499}, {400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 24, 49, 74, 99, 124, 149, 174, 199, 224, 249, 274, 299, 324, 349, 374, 399, 449, 474, 499, 524, 549, 574, 599, 624, 395, 396, 397, 398, 445, 446, 447, 448, 470, 471, 472, 473, 495, 496, 497, 498}}, {{426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 0, 25, 50, 75, 100, 125, 150, 175, 200, 225, 250, 275, 300, 325, 350, 375, 400, 450, 475, 500, 525, 550, 575, 600, 376, 377, 378, 379, 401, 402, 403, 404, 451, 452, 453, 454, 476, 477, 478, 479}, {425, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 1, 26, 51, 76, 101, 126, 151, 176, 201, 226, 251, 276, 301, 326, 351, 376, 401, 451, 476, 501, 526, 551, 576, 601, 375, 377, 378, 379, 400, 402, 403, 404, 450, 452, 453, 454, 475, 477, 478, 479}, {425, 426, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 2, 27, 52, 77, 102, 127, 152, 177, 202, 227, 252, 277, 302, 327, 352, 377, 402, 452, 477, 502, 527, 552, 577, 602, 375, 376, 378, 379, 400, 401, 403, 404, 450, 451, 453, 454, 475, 476, 478, 479}, {425, 426, 427, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 3, 28, 53, 78, 103, 128, 153, 178, 203, 228, 253, 278, 303, 328, 353, 378, 403, 453, 478, 503, 528, 553, 578, 603, 375, 376, 377, 379, 400, 401, 402, 404, 450, 451, 452, 454, 475, 476, 477, 479}, {425, 426, 427, 428, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 4, 29, 54, 79, 104, 129, 154, 179, 204, 229, 254, 279, 304, 329, 354, 379, 404, 454, 479, 504, 529, 554, 579, 604, 375, 376, 377, 378, 400, 401, 402, 403, 450, 451, 452, 453, 475, 476, 477, 478}, {425, 426, 427, 428, 429, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 5, 30, 55, 80, 105, 130, 155, 180, 205, 230, 255, 280, 305, 330, 355, 380, 405, 455, 480, 505, 530, 555, 580, 605, 381, 382, 383, 384, 406, 407, 408, 409, 456, 457, 458, 459, 481, 482, 483, 484}, {425, 426, 427, 428, 429, 430, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 6, 31, 56, 81, 106, 131, 156, 181, 206, 231, 256, 281, 306, 331, 356, 381, 406, 456, 481, 506, 531, 556, 581, 606, 380, 382, 383, 384, 405, 407, 408, 409, 455, 457, 458, 459, 480, 482, 483, 484}, {425, 426, 427, 428, 429, 430, 431, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 7, 32, 57, 82, 107, 132, 157, 182, 207, 232, 257, 282, 307, 332, 357, 382, 407, 457, 482, 507, 532, 557, 582, 607, 380, 381, 383, 384, 405, 406, 408, 409, 455, 456, 458, 459, 480, 481, 483, 484}, {425, 426, 427, 428, 429, 430, 431, 432, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 8, 33, 58, 83, 108, 133, 158, 183, 208, 233, 258, 283, 308, 333, 358, 383, 408, 458, 483, 508, 533, 558, 583, 608, 380, 381, 382, 384, 405, 406, 407, 409, 455, 456, 457, 459, 480, 481, 482, 484}, {425, 426, 427, 428, 429, 430, 431, 432, 433, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 9, 34, 59, 84, 109, 134, 159, 184, 209, 234, 259, 284, 309, 334, 359, 384, 409, 459, 484, 509, 534, 559, 584, 609, 380, 381, 382, 383, 405, 406, 407, 408, 455, 456, 457, 458, 480, 481, 482, 483}, {425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 10, 35, 60, 85, 110, 135, 160, 185, 210, 235, 260, 285, 310, 335, 360, 385, 410, 460, 485, 510, 535, 560, 585, 610, 386, 387, 388, 389, 411, 412, 413, 414, 461, 462, 463, 464, 486, 487, 488, 489}, {425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 11, 36, 61, 86, 111, 136, 161, 186, 211, 236, 261, 286, 311, 336, 361, 386, 411, 461, 486, 511, 536, 561, 586, 611, 385, 387, 388, 389, 410, 412, 413, 414, 460, 462, 463, 464, 485, 487, 488, 489}, {425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 12, 37, 62, 87, 112, 137, 162, 187, 212, 237, 262, 287, 312, 337, 362, 387, 412, 462, 487, 512, 537, 562, 587, 612, 385, 386, 388, 389, 410, 411, 413, 414, 460, 461, 463, 464, 485, 486, 488, 489}, {425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 13, 38, 63, 88, 113, 138, 163, 188, 213, 238, 263, 288, 313, 338, 363, 388, 413, 463, 488, 513, 538, 563, 588, 613, 385, 386, 387, 389, 410, 411, 412, 414, 460, 461, 462, 464, 485, 486, 487, 489}, {425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 14, 39, 64, 89, 114, 139, 164, 189, 214, 239, 264, 289, 314, 339, 364, 389, 414, 464, 489, 514, 539, 564, 589, 614, 385, 386, 387, 388, 410, 411, 412, 413, 460, 461, 462, 463, 485, 486, 487, 488}, {425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 441, 442, 443, 444, 445, 446, 447, 448, 449, 15, 40, 65, 90, 115, 140, 165, 190, 215, 240, 265, 290, 315, 340, 365, 390, 415, 465, 490, 515, 540, 565, 590, 615, 391, 392, 393, 394, 416, 417, 418, 419, 466, 467, 468, 469, 491, 492, 493, 494}, {425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 442, 443, 444, 445, 446, 447, 448, 449, 16, 41, 66, 91, 116, 141, 166, 191, 216, 241, 266, 291, 316, 341, 366, 391, 416, 466, 491, 516, 541, 566, 591, 616, 390, 392, 393, 394, 415, 417, 418, 419, 465, 467, 468, 469, 490, 492, 493, 494}, {425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 443, 444, 445, 446, 447, 448, 449, 17, 42, 67, 92, 117, 142, 167, 192, 217, 242, 267, 292, 317, 342, 367, 392, 417, 467, 492, 517, 542, 567, 592, 617, 390, 391, 393, 394, 415, 416, 418, 419, 465, 466, 468, 469, 490, 491, 493, 494}, {425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 444, 445, 446, 447, 448, 449, 18, 43, 68, 93, 118, 143, 168, 193, 218, 243, 268, 293, 318, 343, 368, 393, 418, 468, 493, 518, 543, 568, 593, 618, 390, 391, 392, 394, 415, 416, 417, 419, 465, 466, 467, 469, 490, 491, 492, 494}, {425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 445, 446, 447, 448, 449, 19, 44, 69, 94, 119, 144, 169, 194, 219, 244, 269, 294, 319, 344, 369, 394, 419, 469, 494, 519, 544, 569, 594, 619, 390, 391, 392, 393, 415, 416, 417, 418, 465, 466, 467, 468, 490, 491, 492, 493}, {425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 446, 447, 448, 449, 20, 45, 70, 95, 120, 145, 170, 195, 220, 245, 270, 295, 320, 345, 370, 395, 420, 470, 495, 520, 545, 570, 595, 620, 396, 397, 398, 399, 421, 422, 423, 424, 471, 472, 473, 474, 496, 497, 498, 499}, {425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 447, 448, 449, 21, 46, 71, 96, 121, 146, 171, 196, 221, 246, 271, 296, 321, 346, 371, 396, 421, 471, 496, 521, 546, 571, 596, 621, 395, 397, 398, 399, 420, 422, 423, 424, 470, 472, 473, 474, 495, 497, 498, 499}, {425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 448, 449, 22, 47, 72, 97, 122, 147, 172, 197, 222, 247, 272, 297, 322, 347, 372, 397, 422, 472, 497, 522, 547, 572, 597, 622, 395, 396, 398, 399, 420, 421, 423, 424, 470, 471, 473, 474, 495, 496, 498, 499}, {425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 449, 23, 48, 73, 98, 123, 148, 173, 198, 223, 248, 273, 298, 323, 348, 373, 398, 423, 473, 498, 523, 548, 573, 598, 623, 395, 396, 397, 399, 420, 421, 422, 424, 470, 471, 472, 474, 495, 496, 497, 499}, {425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 24, 49, 74, 99, 124, 149, 174, 199, 224, 249, 274, 299, 324, 349, 374, 399, 424, 474, 499, 524, 549, 574, 599, 624, 395, 396, 397, 398, 420, 421, 422, 423, 470, 471, 472, 473, 495, 496, 497, 498}}, {{451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 0, 25, 50, 75, 100, 125, 150, 175, 200, 225, 250, 275, 300, 325, 350, 375, 400, 425, 475, 500, 525, 550, 575, 600, 376, 377, 378, 379, 401, 402, 403, 404, 426, 427, 428, 429, 476, 477, 478, 479}, {450, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 1, 26, 51, 76, 101, 126, 151, 176, 201, 226, 251, 276, 301, 326, 351, 376, 401, 426, 476, 501, 526, 551, 576, 601, 375, 377, 378, 379, 400, 402, 403, 404, 425, 427, 428, 429, 475, 477, 478, 479}, {450, 451, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 2, 27, 52, 77, 102, 127, 152, 177, 202, 227, 252, 277, 302, 327, 352, 377, 402, 427, 477, 502, 527, 552, 577, 602, 375, 376, 378, 379, 400, 401, 403, 404, 425, 426, 428, 429, 475, 476, 478, 479}, {450, 451, 452, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 3, 28, 53, 78, 103, 128, 153, 178, 203, 228, 253, 278, 303, 328, 353, 378, 403, 428, 478, 503, 528, 553, 578, 603, 375, 376, 377, 379, 400, 401, 402, 404, 425, 426, 427, 429, 475, 476, 477, 479}, {450, 451, 452, 453, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 4, 29, 54, 79, 104, 129, 154, 179, 204, 229, 254, 279, 304, 329, 354, 379, 404, 429, 479, 504, 529, 554, 579, 604, 375, 376, 377, 378, 400, 401, 402, 403, 425, 426, 427, 428, 475, 476, 477, 478}, {450, 451, 452, 453, 454, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 5, 30, 55, 80, 105, 130, 155, 180, 205, 230, 255, 280, 305, 330, 355, 380, 405, 430, 480, 505, 530, 555, 580, 605, 381, 382, 383, 384, 406, 407, 408, 409, 431, 432, 433, 434, 481, 482, 483, 484}, {450, 451, 452, 453, 454, 455, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 6, 31, 56, 81, 106, 131, 156, 181, 206, 231, 256, 281, 306, 331, 356, 381, 406, 431, 481, 506, 531, 556, 581, 606, 380, 382, 383, 384, 405, 407, 408, 409, 430, 432, 433, 434, 480, 482, 483, 484}, {450, 451, 452, 453, 454, 455, 456, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 7, 32, 57, 82, 107, 132, 157, 182, 207, 232, 257, 282, 307, 332, 357, 382, 407, 432, 482, 507, 532, 557, 582, 607, 380, 381, 383, 384, 405, 406, 408, 409, 430, 431, 433, 434, 480, 481, 483, 484}, {450, 451, 452, 453, 454, 455, 456, 457, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 8, 33, 58, 83, 108, 133, 158, 183, 208, 233, 258, 283, 308, 333, 358, 383, 408, 433, 483, 508, 533, 558, 583, 608, 380, 381, 382, 384, 405, 406, 407, 409, 430, 431, 432, 434, 480, 481, 482, 484}, {450, 451, 452, 453, 454, 455, 456, 457, 458, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 9, 34, 59, 84, 109, 134, 159, 184, 209, 234, 259, 284, 309, 334, 359, 384, 409, 434, 484, 509, 534, 559, 584, 609, 380, 381, 382, 383, 405, 406, 407, 408, 430, 431, 432, 433, 480, 481, 482, 483}, {450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 10, 35, 60, 85, 110, 135, 160, 185, 210, 235, 260, 285, 310, 335, 360, 385, 410, 435, 485, 510, 535, 560, 585, 610, 386, 387, 388, 389, 411, 412, 413, 414, 436, 437, 438, 439, 486, 487, 488, 489}, {450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 11, 36, 61, 86, 111, 136, 161, 186, 211, 236, 261, 286, 311, 336, 361, 386, 411, 436, 486, 511, 536, 561, 586, 611, 385, 387, 388, 389, 410, 412, 413, 414, 435, 437, 438, 439, 485, 487, 488, 489}, {450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 12, 37, 62, 87, 112, 137, 162, 187, 212, 237, 262, 287, 312, 337, 362, 387, 412, 437, 487, 512, 537, 562, 587, 612, 385, 386, 388, 389, 410, 411, 413, 414, 435, 436, 438, 439, 485, 486, 488, 489}, {450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 13, 38, 63, 88, 113, 138, 163, 188, 213, 238, 263, 288, 313, 338, 363, 388, 413, 438, 488, 513, 538, 563, 588, 613, 385, 386, 387, 389, 410, 411, 412, 414, 435, 436, 437, 439, 485, 486, 487, 489}, {450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 14, 39, 64, 89, 114, 139, 164, 189, 214, 239, 264, 289, 314, 339, 364, 389, 414, 439, 489, 514, 539, 564, 589, 614, 385, 386, 387, 388, 410, 411, 412, 413, 435, 436, 437, 438, 485, 486, 487, 488}, {450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 466, 467, 468, 469, 470, 471, 472, 473, 474, 15, 40, 65, 90, 115, 140, 165, 190, 215, 240, 265, 290, 315, 340, 365, 390, 415, 440, 490, 515, 540, 565, 590, 615, 391, 392, 393, 394, 416, 417, 418, 419, 441, 442, 443, 444, 491, 492, 493, 494}, {450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 467, 468, 469, 470, 471, 472, 473, 474, 16, 41, 66, 91, 116, 141, 166, 191, 216, 241, 266, 291, 316, 341, 366, 391, 416, 441, 491, 516, 541, 566, 591, 616, 390, 392, 393, 394, 415, 417, 418, 419, 440, 442, 443, 444, 490, 492, 493, 494}, {450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 468, 469, 470, 471, 472, 473, 474, 17, 42, 67, 92, 117, 142, 167, 192, 217, 242, 267, 292, 317, 342, 367, 392, 417, 442, 492, 517, 542, 567, 592, 617, 390, 391, 393, 394, 415, 416, 418, 419, 440, 441, 443, 444, 490, 491, 493, 494}, {450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 469, 470, 471, 472, 473, 474, 18, 43, 68, 93, 118, 143, 168, 193, 218, 243, 268, 293, 318, 343, 368, 393, 418, 443, 493, 518, 543, 568, 593, 618, 390, 391, 392, 394, 415, 416, 417, 419, 440, 441, 442, 444, 490, 491, 492, 494}, {450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 470, 471, 472, 473, 474, 19, 44, 69, 94, 119, 144, 169, 194, 219, 244, 269, 294, 319, 344, 369, 394, 419, 444, 494, 519, 544, 569, 594, 619, 390, 391, 392, 393, 415, 416, 417, 418, 440, 441, 442, 443, 490, 491, 492, 493}, {450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 471, 472, 473, 474, 20, 45, 70, 95, 120, 145, 170, 195, 220, 245, 270, 295, 320, 345, 370, 395, 420, 445, 495, 520, 545, 570, 595, 620, 396, 397, 398, 399, 421, 422, 423, 424, 446, 447, 448, 449, 496, 497, 498, 499}, {450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 472, 473, 474, 21, 46, 71, 96, 121, 146, 171, 196, 221, 246, 271, 296, 321, 346, 371, 396, 421, 446, 496, 521, 546, 571, 596, 621, 395, 397, 398, 399, 420, 422, 423, 424, 445, 447, 448, 449, 495, 497, 498, 499}, {450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 473, 474, 22, 47, 72, 97, 122, 147, 172, 197, 222, 247, 272, 297, 322, 347, 372, 397, 422, 447, 497, 522, 547, 572, 597, 622, 395, 396, 398, 399, 420, 421, 423, 424, 445, 446, 448, 449, 495, 496, 498, 499}, {450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 474, 23, 48, 73, 98, 123, 148, 173, 198, 223, 248, 273, 298, 323, 348, 373, 398, 423, 448, 498, 523, 548, 573, 598, 623, 395, 396, 397, 399, 420, 421, 422, 424, 445, 446, 447, 449, 495, 496, 497, 499}, {450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 24, 49, 74, 99, 124, 149, 174, 199, 224, 249, 274, 299, 324, 349, 374, 399, 424, 449, 499, 524, 549, 574, 599, 624, 395, 396, 397, 398, 420, 421, 422, 423, 445, 446, 447, 448, 495, 496, 497, 498}}, {{476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 0, 25, 50, 75, 100, 125, 150, 175, 200, 225, 250, 275, 300, 325, 350, 375, 400, 425, 450, 500, 525, 550, 575, 600, 376, 377, 378, 379, 401, 402, 403, 404, 426, 427, 428, 429, 451, 452, 453, 454}, {475, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 1, 26, 51, 76, 101, 126, 151, 176, 201, 226, 251, 276, 301, 326, 351, 376, 401, 426, 451, 501, 526, 551, 576, 601, 375, 377, 378, 379, 400, 402, 403, 404, 425, 427, 428, 429, 450, 452, 453, 454}, {475, 476, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 2, 27, 52, 77, 102, 127, 152, 177, 202, 227, 252, 277, 302, 327, 352, 377, 402, 427, 452, 502, 527, 552, 577, 602, 375, 376, 378, 379, 400, 401, 403, 404, 425, 426, 428, 429, 450, 451, 453, 454}, {475, 476, 477, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 3, 28, 53, 78, 103, 128, 153, 178, 203, 228, 253, 278, 303, 328, 353, 378, 403, 428, 453, 503, 528, 553, 578, 603, 375, 376, 377, 379, 400, 401, 402, 404, 425, 426, 427, 429, 450, 451, 452, 454}, {475, 476, 477, 478, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 4, 29, 54, 79, 104, 129, 154, 179, 204, 229, 254, 279, 304, 329, 354, 379, 404, 429, 454, 504, 529, 554, 579, 604, 375, 376, 377, 378, 400, 401, 402, 403, 425, 426, 427, 428, 450, 451, 452, 453}, {475, 476, 477, 478, 479, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 5, 30, 55, 80, 105, 130, 155, 180, 205, 230, 255, 280, 305, 330, 355, 380, 405, 430, 455, 505, 530, 555, 580, 605, 381, 382, 383, 384, 406, 407, 408, 409, 431, 432, 433, 434, 456, 457, 458, 459}, {475, 476, 477, 478, 479, 480, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 6, 31, 56, 81, 106, 131, 156, 181, 206, 231, 256, 281, 306, 331, 356, 381, 406, 431, 456, 506, 531, 556, 581, 606, 380, 382, 383, 384, 405, 407, 408, 409, 430, 432, 433, 434, 455, 457, 458, 459}, {475, 476, 477, 478, 479, 480, 481, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 7, 32, 57, 82, 107, 132, 157, 182, 207, 232, 257, 282, 307, 332, 357, 382, 407, 432, 457, 507, 532, 557, 582, 607, 380, 381, 383, 384, 405, 406, 408, 409, 430, 431, 433, 434, 455, 456, 458, 459}, {475, 476, 477, 478, 479, 480, 481, 482, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 8, 33, 58, 83, 108, 133, 158, 183, 208, 233, 258, 283, 308, 333, 358, 383, 408, 433, 458, 508, 533, 558, 583, 608, 380, 381, 382, 384, 405, 406, 407, 409, 430, 431, 432, 434, 455, 456, 457, 459}, {475, 476, 477, 478, 479, 480, 481, 482, 483, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 9, 34, 59, 84, 109, 134, 159, 184, 209, 234, 259, 284, 309, 334, 359, 384, 409, 434, 459, 509, 534, 559, 584, 609, 380, 381, 382, 383, 405, 406, 407, 408, 430, 431, 432, 433, 455, 456, 457, 458}, {475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 10, 35, 60, 85, 110, 135, 160, 185, 210, 235, 260, 285, 310, 335, 360, 385, 410, 435, 460, 510, 535, 560, 585, 610, 386, 387, 388, 389, 411, 412, 413, 414, 436, 437, 438, 439, 461, 462, 463, 464}, {475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 11, 36, 61, 86, 111, 136, 161, 186, 211, 236, 261, 286, 311, 336, 361, 386, 411, 436, 461, 511, 536, 561, 586, 611, 385, 387, 388, 389, 410, 412, 413, 414, 435, 437, 438, 439, 460, 462, 463, 464}, {475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 12, 37, 62, 87, 112, 137, 162, 187, 212, 237, 262, 287, 312, 337, 362, 387, 412, 437, 462, 512, 537, 562, 587, 612, 385, 386, 388, 389, 410, 411, 413, 414, 435, 436, 438, 439, 460, 461, 463, 464}, {475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 13, 38, 63, 88, 113, 138, 163, 188, 213, 238, 263, 288, 313, 338, 363, 388, 413, 438, 463, 513, 538, 563, 588, 613, 385, 386, 387, 389, 410, 411, 412, 414, 435, 436, 437, 439, 460, 461, 462, 464}, {475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 14, 39, 64, 89, 114, 139, 164, 189, 214, 239, 264, 289, 314, 339, 364, 389, 414, 439, 464, 514, 539, 564, 589, 614, 385, 386, 387, 388, 410, 411, 412, 413, 435, 436, 437, 438, 460, 461, 462, 463}, {475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 491, 492, 493, 494, 495, 496, 497, 498, 499, 15, 40, 65, 90, 115, 140, 165, 190, 215, 240, 265, 290, 315, 340, 365, 390, 415, 440, 465, 515, 540, 565, 590, 615, 391, 392, 393, 394, 416, 417, 418, 419, 441, 442, 443, 444, 466, 467, 468, 469}, {475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 492, 493, 494, 495, 496, 497, 498, 499, 16, 41, 66, 91, 116, 141, 166, 191, 216, 241, 266, 291, 316, 341, 366, 391, 416, 441, 466, 516, 541, 566, 591, 616, 390, 392, 393, 394, 415, 417, 418, 419, 440, 442, 443, 444, 465, 467, 468, 469}, {475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 493, 494, 495, 496, 497, 498, 499, 17, 42, 67, 92, 117, 142, 167, 192, 217, 242, 267, 292, 317, 342, 367, 392, 417, 442, 467, 517, 542, 567, 592, 617, 390, 391, 393, 394, 415, 416, 418, 419, 440, 441, 443, 444, 465, 466, 468, 469}, {475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 494, 495, 496, 497, 498, 499, 18, 43, 68, 93, 118, 143, 168, 193, 218, 243, 268, 293, 318, 343, 368, 393, 418, 443, 468, 518, 543, 568, 593, 618, 390, 391, 392, 394, 415, 416, 417, 419, 440, 441, 442, 444, 465, 466, 467, 469}, {475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 495, 496, 497, 498, 499, 19, 44, 69, 94, 119, 144, 169, 194, 219, 244, 269, 294, 319, 344, 369, 394, 419, 444, 469, 519, 544, 569, 594, 619, 390, 391, 392, 393, 415, 416, 417, 418, 440, 441, 442, 443, 465, 466, 467, 468}, {475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 496, 497, 498, 499, 20, 45, 70, 95, 120, 145, 170, 195, 220, 245, 270, 295, 320, 345, 370, 395, 420, 445, 470, 520, 545, 570, 595, 620, 396, 397, 398, 399, 421, 422, 423, 424, 446, 447, 448, 449, 471, 472, 473, 474}, {475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 497, 498, 499, 21, 46, 71, 96, 121, 146, 171, 196, 221, 246, 271, 296, 321, 346, 371, 396, 421, 446, 471, 521, 546, 571, 596, 621, 395, 397, 398, 399, 420, 422, 423, 424, 445, 447, 448, 449, 470, 472, 473, 474}, {475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 498, 499, 22, 47, 72, 97, 122, 147, 172, 197, 222, 247, 272, 297, 322, 347, 372, 397, 422, 447, 472, 522, 547, 572, 597, 622, 395, 396, 398, 399, 420, 421, 423, 424, 445, 446, 448, 449, 470, 471, 473, 474}, {475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 499, 23, 48, 73, 98, 123, 148, 173, 198, 223, 248, 273, 298, 323, 348, 373, 398, 423, 448, 473, 523, 548, 573, 598, 623, 395, 396, 397, 399, 420, 421, 422, 424, 445, 446, 447, 449, 470, 471, 472, 474}, {475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 24, 49, 74, 99, 124, 149, 174, 199, 224, 249, 274, 299, 324, 349, 374, 399, 424, 449, 474, 524, 549, 574, 599, 624, 395, 396, 397, 398, 420, 421, 422, 423, 445, 446, 447, 448, 470, 471, 472, 473}}, {{501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 0, 25, 50, 75, 100, 125, 150, 175, 200, 225, 250, 275, 300, 325, 350, 375, 400, 425, 450, 475, 525, 550, 575, 600, 526, 527, 528, 529, 551, 552, 553, 554, 576, 577, 578, 579, 601, 602, 603, 604}, {500, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 1, 26, 51, 76, 101, 126, 151, 176, 201, 226, 251, 276, 301, 326, 351, 376, 401, 426, 451, 476, 526, 551, 576, 601, 525, 527, 528, 529, 550, 552, 553, 554, 575, 577, 578, 579, 600, 602, 603, 604}, {500, 501, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 2, 27, 52, 77, 102, 127, 152, 177, 202, 227, 252, 277, 302, 327, 352, 377, 402, 427, 452, 477, 527, 552, 577, 602, 525, 526, 528, 529, 550, 551, 553, 554, 575, 576, 578, 579, 600, 601, 603, 604}, {500, 501, 502, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 3, 28, 53, 78, 103, 128, 153, 178, 203, 228, 253, 278, 303, 328, 353, 378, 403, 428, 453, 478, 528, 553, 578, 603, 525, 526, 527, 529, 550, 551, 552, 554, 575, 576, 577, 579, 600, 601, 602, 604}, {500, 501, 502, 503, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 4, 29, 54, 79, 104, 129, 154, 179, 204, 229, 254, 279, 304, 329, 354, 379, 404, 429, 454, 479, 529, 554, 579, 604, 525, 526, 527, 528, 550, 551, 552, 553, 575, 576, 577, 578, 600, 601, 602, 603}, {500, 501, 502, 503, 504, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 5, 30, 55, 80, 105, 130, 155, 180, 205, 230, 255, 280, 305, 330, 355, 380, 405, 430, 455, 480, 530, 555, 580, 605, 531, 532, 533, 534, 556, 557, 558, 559, 581, 582, 583, 584, 606, 607, 608, 609}, {500, 501, 502, 503, 504, 505, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 6, 31, 56, 81, 106, 131, 156, 181, 206, 231, 256, 281, 306, 331, 356, 381, 406, 431, 456, 481, 531, 556, 581, 606, 530, 532, 533, 534, 555, 557, 558, 559, 580, 582, 583, 584, 605, 607, 608, 609}, {500, 501, 502, 503, 504, 505, 506, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 7, 32, 57, 82, 107, 132, 157, 182, 207, 232, 257, 282, 307, 332, 357, 382, 407, 432, 457, 482, 532, 557, 582, 607, 530, 531, 533, 534, 555, 556, 558, 559, 580, 581, 583, 584, 605, 606, 608, 609}, {500, 501, 502, 503, 504, 505, 506, 507, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 8, 33, 58, 83, 108, 133, 158, 183, 208, 233, 258, 283, 308, 333, 358, 383, 408, 433, 458, 483, 533, 558, 583, 608, 530, 531, 532, 534, 555, 556, 557, 559, 580, 581, 582, 584, 605, 606, 607, 609}, {500, 501, 502, 503, 504, 505, 506, 507, 508, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 9, 34, 59, 84, 109, 134, 159, 184, 209, 234, 259, 284, 309, 334, 359, 384, 409, 434, 459, 484, 534, 559, 584, 609, 530, 531, 532, 533, 555, 556, 557, 558, 580, 581, 582, 583, 605, 606, 607, 608}, {500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 10, 35, 60, 85, 110, 135, 160, 185, 210, 235, 260, 285, 310, 335, 360, 385, 410, 435, 460, 485, 535, 560, 585, 610, 536, 537, 538, 539, 561, 562, 563, 564, 586, 587, 588, 589, 611, 612, 613, 614}, {500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 11, 36, 61, 86, 111, 136, 161, 186, 211, 236, 261, 286, 311, 336, 361, 386, 411, 436, 461, 486, 536, 561, 586, 611, 535, 537, 538, 539, 560, 562, 563, 564, 585, 587, 588, 589, 610, 612, 613, 614}, {500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 12, 37, 62, 87, 112, 137, 162, 187, 212, 237, 262, 287, 312, 337, 362, 387, 412, 437, 462, 487, 537, 562, 587, 612, 535, 536, 538, 539, 560, 561, 563, 564, 585, 586, 588, 589, 610, 611, 613, 614}, {500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 13, 38, 63, 88, 113, 138, 163, 188, 213, 238, 263, 288, 313, 338, 363, 388, 413, 438, 463, 488, 538, 563, 588, 613, 535, 536, 537, 539, 560, 561, 562, 564, 585, 586, 587, 589, 610, 611, 612, 614}, {500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 14, 39, 64, 89, 114, 139, 164, 189, 214, 239, 264, 289, 314, 339, 364, 389, 414, 439, 464, 489, 539, 564, 589, 614, 535, 536, 537, 538, 560, 561, 562, 563, 585, 586, 587, 588, 610, 611, 612, 613}, {500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 516, 517, 518, 519, 520, 521, 522, 523, 524, 15, 40, 65, 90, 115, 140, 165, 190, 215, 240, 265, 290, 315, 340, 365, 390, 415, 440, 465, 490, 540, 565, 590, 615, 541, 542, 543, 544, 566, 567, 568, 569, 591, 592, 593, 594, 616, 617, 618, 619}, {500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 517, 518, 519, 520, 521, 522, 523, 524, 16, 41, 66, 91, 116, 141, 166, 191, 216, 241, 266, 291, 316, 341, 366, 391, 416, 441, 466, 491, 541, 566, 591, 616, 540, 542, 543, 544, 565, 567, 568, 569, 590, 592, 593, 594, 615, 617, 618, 619}, {500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 518, 519, 520, 521, 522, 523, 524, 17, 42, 67, 92, 117, 142, 167, 192, 217, 242, 267, 292, 317, 342, 367, 392, 417, 442, 467, 492, 542, 567, 592, 617, 540, 541, 543, 544, 565, 566, 568, 569, 590, 591, 593, 594, 615, 616, 618, 619}, {500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 519, 520, 521, 522, 523, 524, 18, 43, 68, 93, 118, 143, 168, 193, 218, 243, 268, 293, 318, 343, 368, 393, 418, 443, 468, 493, 543, 568, 593, 618, 540, 541, 542, 544, 565, 566, 567, 569, 590, 591, 592, 594, 615, 616, 617, 619}, {500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 520, 521, 522, 523, 524, 19, 44, 69, 94, 119, 144, 169, 194, 219, 244, 269, 294, 319, 344, 369, 394, 419, 444, 469, 494, 544, 569, 594, 619, 540, 541, 542, 543, 565, 566, 567, 568, 590, 591, 592, 593, 615, 616, 617, 618}, {500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 521, 522, 523, 524, 20, 45, 70, 95, 120, 145, 170, 195, 220, 245, 270, 295, 320, 345, 370, 395, 420, 445, 470, 495, 545, 570, 595, 620, 546, 547, 548, 549, 571, 572, 573, 574, 596, 597, 598, 599, 621, 622, 623, 624}, {500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 522, 523, 524, 21, 46, 71, 96, 121, 146, 171, 196, 221, 246, 271, 296, 321, 346, 371, 396, 421, 446, 471, 496, 546, 571, 596, 621, 545, 547, 548, 549, 570, 572, 573, 574, 595, 597, 598, 599, 620, 622, 623, 624}, {500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 523, 524, 22, 47, 72, 97, 122, 147, 172, 197, 222, 247, 272, 297, 322, 347, 372, 397, 422, 447, 472, 497, 547, 572, 597, 622, 545, 546, 548, 549, 570, 571, 573, 574, 595, 596, 598, 599, 620, 621, 623, 624}, {500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 524, 23, 48, 73, 98, 123, 148, 173, 198, 223, 248, 273, 298, 323, 348, 373, 398, 423, 448, 473, 498, 548, 573, 598, 623, 545, 546, 547, 549, 570, 571, 572, 574, 595, 596, 597, 599, 620, 621, 622, 624}, {500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 24, 49, 74, 99, 124, 149, 174, 199, 224, 249, 274, 299, 324, 349, 374, 399, 424, 449, 474, 499, 549, 574, 599, 624, 545, 546, 547, 548, 570, 571, 572, 573, 595, 596, 597, 598, 620, 621, 622, 623}}, {{526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 0, 25, 50, 75, 100, 125, 150, 175, 200, 225, 250, 275, 300, 325, 350, 375, 400, 425, 450, 475, 500, 550, 575, 600, 501, 502, 503, 504, 551, 552, 553, 554, 576, 577, 578, 579, 601, 602, 603, 604}, {525, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 1, 26, 51, 76, 101, 126, 151, 176, 201, 226, 251, 276, 301, 326, 351, 376, 401, 426, 451, 476, 501, 551, 576, 601, 500, 502, 503, 504, 550, 552, 553, 554, 575, 577, 578, 579, 600, 602, 603, 604}, {525, 526, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 2, 27, 52, 77, 102, 127, 152, 177, 202, 227, 252, 277, 302, 327, 352, 377, 402, 427, 452, 477, 502, 552, 577, 602, 500, 501, 503, 504, 550, 551, 553, 554, 575, 576, 578, 579, 600, 601, 603, 604}, {525, 526, 527, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 3, 28, 53, 78, 103, 128, 153, 178, 203, 228, 253, 278, 303, 328, 353, 378, 403, 428, 453, 478, 503, 553, 578, 603, 500, 501, 502, 504, 550, 551, 552, 554, 575, 576, 577, 579, 600, 601, 602, 604}, {525, 526, 527, 528, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 4, 29, 54, 79, 104, 129, 154, 179, 204, 229, 254, 279, 304, 329, 354, 379, 404, 429, 454, 479, 504, 554, 579, 604, 500, 501, 502, 503, 550, 551, 552, 553, 575, 576, 577, 578, 600, 601, 602, 603}, {525, 526, 527, 528, 529, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 5, 30, 55, 80, 105, 130, 155, 180, 205, 230, 255, 280, 305, 330, 355, 380, 405, 430, 455, 480, 505, 555, 580, 605, 506, 507, 508, 509, 556, 557, 558, 559, 581, 582, 583, 584, 606, 607, 608, 609}, {525, 526, 527, 528, 529, 530, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 6, 31, 56, 81, 106, 131, 156, 181, 206, 231, 256, 281, 306, 331, 356, 381, 406, 431, 456, 481, 506, 556, 581, 606, 505, 507, 508, 509, 555, 557, 558, 559, 580, 582, 583, 584, 605, 607, 608, 609}, {525, 526, 527, 528, 529, 530, 531, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 7, 32, 57, 82, 107, 132, 157, 182, 207, 232, 257, 282, 307, 332, 357, 382, 407, 432, 457, 482, 507, 557, 582, 607, 505, 506, 508, 509, 555, 556, 558, 559, 580, 581, 583, 584, 605, 606, 608, 609}, {525, 526, 527, 528, 529, 530, 531, 532, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 8, 33, 58, 83, 108, 133, 158, 183, 208, 233, 258, 283, 308, 333, 358, 383, 408, 433, 458, 483, 508, 558, 583, 608, 505, 506, 507, 509, 555, 556, 557, 559, 580, 581, 582, 584, 605, 606, 607, 609}, {525, 526, 527, 528, 529, 530, 531, 532, 533, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 9, 34, 59, 84, 109, 134, 159, 184, 209, 234, 259, 284, 309, 334, 359, 384, 409, 434, 459, 484, 509, 559, 584, 609, 505, 506, 507, 508, 555, 556, 557, 558, 580, 581, 582, 583, 605, 606, 607, 608}, {525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 10, 35, 60, 85, 110, 135, 160, 185, 210, 235, 260, 285, 310, 335, 360, 385, 410, 435, 460, 485, 510, 560, 585, 610, 511, 512, 513, 514, 561, 562, 563, 564, 586, 587, 588, 589, 611, 612, 613, 614}, {525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 11, 36, 61, 86, 111, 136, 161, 186, 211, 236, 261, 286, 311, 336, 361, 386, 411, 436, 461, 486, 511, 561, 586, 611, 510, 512, 513, 514, 560, 562, 563, 564, 585, 587, 588, 589, 610, 612, 613, 614}, {525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 12, 37, 62, 87, 112, 137, 162, 187, 212, 237, 262, 287, 312, 337, 362, 387, 412, 437, 462, 487, 512, 562, 587, 612, 510, 511, 513, 514, 560, 561, 563, 564, 585, 586, 588, 589, 610, 611, 613, 614}, {525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 13, 38, 63, 88, 113, 138, 163, 188, 213, 238, 263, 288, 313, 338, 363, 388, 413, 438, 463, 488, 513, 563, 588, 613, 510, 511, 512, 514, 560, 561, 562, 564, 585, 586, 587, 589, 610, 611, 612, 614}, {525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 14, 39, 64, 89, 114, 139, 164, 189, 214, 239, 264, 289, 314, 339, 364, 389, 414, 439, 464, 489, 514, 564, 589, 614, 510, 511, 512, 513, 560, 561, 562, 563, 585, 586, 587, 588, 610, 611, 612, 613}, {525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 541, 542, 543, 544, 545, 546, 547, 548, 549, 15, 40, 65, 90, 115, 140, 165, 190, 215, 240, 265, 290, 315, 340, 365, 390, 415, 440, 465, 490, 515, 565, 590, 615, 516, 517, 518, 519, 566, 567, 568, 569, 591, 592, 593, 594, 616, 617, 618, 619}, {525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 542, 543, 544, 545, 546, 547, 548, 549, 16, 41, 66, 91, 116, 141, 166, 191, 216, 241, 266, 291, 316, 341, 366, 391, 416, 441, 466, 491, 516, 566, 591, 616, 515, 517, 518, 519, 565, 567, 568, 569, 590, 592, 593, 594, 615, 617, 618, 619}, {525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 543, 544, 545, 546, 547, 548, 549, 17, 42, 67, 92, 117, 142, 167, 192, 217, 242, 267, 292, 317, 342, 367, 392, 417, 442, 467, 492, 517, 567, 592, 617, 515, 516, 518, 519, 565, 566, 568, 569, 590, 591, 593, 594, 615, 616, 618, 619}, {525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 544, 545, 546, 547, 548, 549, 18, 43, 68, 93, 118, 143, 168, 193, 218, 243, 268, 293, 318, 343, 368, 393, 418, 443, 468, 493, 518, 568, 593, 618, 515, 516, 517, 519, 565, 566, 567, 569, 590, 591, 592, 594, 615, 616, 617, 619}, {525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 545, 546, 547, 548, 549, 19, 44, 69, 94, 119, 144, 169, 194, 219, 244, 269, 294, 319, 344, 369, 394, 419, 444, 469, 494, 519, 569, 594, 619, 515, 516, 517, 518, 565, 566, 567, 568, 590, 591, 592, 593, 615, 616, 617, 618}, {525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 546, 547, 548, 549, 20, 45, 70, 95, 120, 145, 170, 195, 220, 245, 270, 295, 320, 345, 370, 395, 420, 445, 470, 495, 520, 570, 595, 620, 521, 522, 523, 524, 571, 572, 573, 574, 596, 597, 598, 599, 621, 622, 623, 624}, {525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 547, 548, 549, 21, 46, 71, 96, 121, 146, 171, 196, 221, 246, 271, 296, 321, 346, 371, 396, 421, 446, 471, 496, 521, 571, 596, 621, 520, 522, 523, 524, 570, 572, 573, 574, 595, 597, 598, 599, 620, 622, 623, 624}, {525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 548, 549, 22, 47, 72, 97, 122, 147, 172, 197, 222, 247, 272, 297, 322, 347, 372, 397, 422, 447, 472, 497, 522, 572, 597, 622, 520, 521, 523, 524, 570, 571, 573, 574, 595, 596, 598, 599, 620, 621, 623, 624}, {525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 549, 23, 48, 73, 98, 123, 148, 173, 198, 223, 248, 273, 298, 323, 348, 373, 398, 423, 448, 473, 498, 523, 573, 598, 623, 520, 521, 522, 524, 570, 571, 572, 574, 595, 596, 597, 599, 620, 621, 622, 624}, {525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 24, 49, 74, 99, 124, 149, 174, 199, 224, 249, 274, 299, 324, 349, 374, 399, 424, 449, 474, 499, 524, 574, 599, 624, 520, 521, 522, 523, 570, 571, 572, 573, 595, 596, 597, 598, 620, 621, 622, 623}}, {{551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 0, 25, 50, 75, 100, 125, 150, 175, 200, 225, 250, 275, 300, 325, 350, 375, 400, 425, 450, 475, 500, 525, 575, 600, 501, 502, 503, 504, 526, 527, 528, 529, 576, 577, 578, 579, 601, 602, 603, 604}, {550, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 1, 26, 51, 76, 101, 126, 151, 176, 201, 226, 251, 276, 301, 326, 351, 376, 401, 426, 451, 476, 501, 526, 576, 601, 500, 502, 503, 504, 525, 527, 528, 529, 575, 577, 578, 579, 600, 602, 603, 604}, {550, 551, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 2, 27, 52, 77, 102, 127, 152, 177, 202, 227, 252, 277, 302, 327, 352, 377, 402, 427, 452, 477, 502, 527, 577, 602, 500, 501, 503, 504, 525, 526, 528, 529, 575, 576, 578, 579, 600, 601, 603, 604}, {550, 551, 552, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 3, 28, 53, 78, 103, 128, 153, 178, 203, 228, 253, 278, 303, 328, 353, 378, 403, 428, 453, 478, 503, 528, 578, 603, 500, 501, 502, 504, 525, 526, 527, 529, 575, 576, 577, 579, 600, 601, 602, 604}, {550, 551, 552, 553, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 4, 29, 54, 79, 104, 129, 154, 179, 204, 229, 254, 279, 304, 329, 354, 379, 404, 429, 454, 479, 504, 529, 579, 604, 500, 501, 502, 503, 525, 526, 527, 528, 575, 576, 577, 578, 600, 601, 602, 603}, {550, 551, 552, 553, 554, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 5, 30, 55, 80, 105, 130, 155, 180, 205, 230, 255, 280, 305, 330, 355, 380, 405, 430, 455, 480, 505, 530, 580, 605, 506, 507, 508, 509, 531, 532, 533, 534, 581, 582, 583, 584, 606, 607, 608, 609}, {550, 551, 552, 553, 554, 555, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 6, 31, 56, 81, 106, 131, 156, 181, 206, 231, 256, 281, 306, 331, 356, 381, 406, 431, 456, 481, 506, 531, 581, 606, 505, 507, 508, 509, 530, 532, 533, 534, 580, 582, 583, 584, 605, 607, 608, 609}, {550, 551, 552, 553, 554, 555, 556, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 7, 32, 57, 82, 107, 132, 157, 182, 207, 232, 257, 282, 307, 332, 357, 382, 407, 432, 457, 482, 507, 532, 582, 607, 505, 506, 508, 509, 530, 531, 533, 534, 580, 581, 583, 584, 605, 606, 608, 609}, {550, 551, 552, 553, 554, 555, 556, 557, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 8, 33, 58, 83, 108, 133, 158, 183, 208, 233, 258, 283, 308, 333, 358, 383, 408, 433, 458, 483, 508, 533, 583, 608, 505, 506, 507, 509, 530, 531, 532, 534, 580, 581, 582, 584, 605, 606, 607, 609}, {550, 551, 552, 553, 554, 555, 556, 557, 558, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 9, 34, 59, 84, 109, 134, 159, 184, 209, 234, 259, 284, 309, 334, 359, 384, 409, 434, 459, 484, 509, 534, 584, 609, 505, 506, 507, 508, 530, 531, 532, 533, 580, 581, 582, 583, 605, 606, 607, 608}, {550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 10, 35, 60, 85, 110, 135, 160, 185, 210, 235, 260, 285, 310, 335, 360, 385, 410, 435, 460, 485, 510, 535, 585, 610, 511, 512, 513, 514, 536, 537, 538, 539, 586, 587, 588, 589, 611, 612, 613, 614}, {550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 11, 36, 61, 86, 111, 136, 161, 186, 211, 236, 261, 286, 311, 336, 361, 386, 411, 436, 461, 486, 511, 536, 586, 611, 510, 512, 513, 514, 535, 537, 538, 539, 585, 587, 588, 589, 610, 612, 613, 614}, {550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 12, 37, 62, 87, 112, 137, 162, 187, 212, 237, 262, 287, 312, 337, 362, 387, 412, 437, 462, 487, 512, 537, 587, 612, 510, 511, 513, 514, 535, 536, 538, 539, 585, 586, 588, 589, 610, 611, 613, 614}, {550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 13, 38, 63, 88, 113, 138, 163, 188, 213, 238, 263, 288, 313, 338, 363, 388, 413, 438, 463, 488, 513, 538, 588, 613, 510, 511, 512, 514, 535, 536, 537, 539, 585, 586, 587, 589, 610, 611, 612, 614}, {550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 14, 39, 64, 89, 114, 139, 164, 189, 214, 239, 264, 289, 314, 339, 364, 389, 414, 439, 464, 489, 514, 539, 589, 614, 510, 511, 512, 513, 535, 536, 537, 538, 585, 586, 587, 588, 610, 611, 612, 613}, {550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 566, 567, 568, 569, 570, 571, 572, 573, 574, 15, 40, 65, 90, 115, 140, 165, 190, 215, 240, 265, 290, 315, 340, 365, 390, 415, 440, 465, 490, 515, 540, 590, 615, 516, 517, 518, 519, 541, 542, 543, 544, 591, 592, 593, 594, 616, 617, 618, 619}, {550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 567, 568, 569, 570, 571, 572, 573, 574, 16, 41, 66, 91, 116, 141, 166, 191, 216, 241, 266, 291, 316, 341, 366, 391, 416, 441, 466, 491, 516, 541, 591, 616, 515, 517, 518, 519, 540, 542, 543, 544, 590, 592, 593, 594, 615, 617, 618, 619}, {550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 568, 569, 570, 571, 572, 573, 574, 17, 42, 67, 92, 117, 142, 167, 192, 217, 242, 267, 292, 317, 342, 367, 392, 417, 442, 467, 492, 517, 542, 592, 617, 515, 516, 518, 519, 540, 541, 543, 544, 590, 591, 593, 594, 615, 616, 618, 619}, {550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 569, 570, 571, 572, 573, 574, 18, 43, 68, 93, 118, 143, 168, 193, 218, 243, 268, 293, 318, 343, 368, 393, 418, 443, 468, 493, 518, 543, 593, 618, 515, 516, 517, 519, 540, 541, 542, 544, 590, 591, 592, 594, 615, 616, 617, 619}, {550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 570, 571, 572, 573, 574, 19, 44, 69, 94, 119, 144, 169, 194, 219, 244, 269, 294, 319, 344, 369, 394, 419, 444, 469, 494, 519, 544, 594, 619, 515, 516, 517, 518, 540, 541, 542, 543, 590, 591, 592, 593, 615, 616, 617, 618}, {550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 571, 572, 573, 574, 20, 45, 70, 95, 120, 145, 170, 195, 220, 245, 270, 295, 320, 345, 370, 395, 420, 445, 470, 495, 520, 545, 595, 620, 521, 522, 523, 524, 546, 547, 548, 549, 596, 597, 598, 599, 621, 622, 623, 624}, {550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 572, 573, 574, 21, 46, 71, 96, 121, 146, 171, 196, 221, 246, 271, 296, 321, 346, 371, 396, 421, 446, 471, 496, 521, 546, 596, 621, 520, 522, 523, 524, 545, 547, 548, 549, 595, 597, 598, 599, 620, 622, 623, 624}, {550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 573, 574, 22, 47, 72, 97, 122, 147, 172, 197, 222, 247, 272, 297, 322, 347, 372, 397, 422, 447, 472, 497, 522, 547, 597, 622, 520, 521, 523, 524, 545, 546, 548, 549, 595, 596, 598, 599, 620, 621, 623, 624}, {550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 574, 23, 48, 73, 98, 123, 148, 173, 198, 223, 248, 273, 298, 323, 348, 373, 398, 423, 448, 473, 498, 523, 548, 598, 623, 520, 521, 522, 524, 545, 546, 547, 549, 595, 596, 597, 599, 620, 621, 622, 624}, {550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 24, 49, 74, 99, 124, 149, 174, 199, 224, 249, 274, 299, 324, 349, 374, 399, 424, 449, 474, 499, 524, 549, 599, 624, 520, 521, 522, 523, 545, 546, 547, 548, 595, 596, 597, 598, 620, 621, 622, 623}}, {{576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 0, 25, 50, 75, 100, 125, 150, 175, 200, 225, 250, 275, 300, 325, 350, 375, 400, 425, 450, 475, 500, 525, 550, 600, 501, 502, 503, 504, 526, 527, 528, 529, 551, 552, 553, 554, 601, 602, 603, 604}, {575, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 1, 26, 51, 76, 101, 126, 151, 176, 201, 226, 251, 276, 301, 326, 351, 376, 401, 426, 451, 476, 501, 526, 551, 601, 500, 502, 503, 504, 525, 527, 528, 529, 550, 552, 553, 554, 600, 602, 603, 604}, {575, 576, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 2, 27, 52, 77, 102, 127, 152, 177, 202, 227, 252, 277, 302, 327, 352, 377, 402, 427, 452, 477, 502, 527, 552, 602, 500, 501, 503, 504, 525, 526, 528, 529, 550, 551, 553, 554, 600, 601, 603, 604}, {575, 576, 577, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 3, 28, 53, 78, 103, 128, 153, 178, 203, 228, 253, 278, 303, 328, 353, 378, 403, 428, 453, 478, 503, 528, 553, 603, 500, 501, 502, 504, 525, 526, 527, 529, 550, 551, 552, 554, 600, 601, 602, 604}, {575, 576, 577, 578, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 4, 29, 54, 79, 104, 129, 154, 179, 204, 229, 254, 279, 304, 329, 354, 379, 404, 429, 454, 479, 504, 529, 554, 604, 500, 501, 502, 503, 525, 526, 527, 528, 550, 551, 552, 553, 600, 601, 602, 603}, {575, 576, 577, 578, 579, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 5, 30, 55, 80, 105, 130, 155, 180, 205, 230, 255, 280, 305, 330, 355, 380, 405, 430, 455, 480, 505, 530, 555, 605, 506, 507, 508, 509, 531, 532, 533, 534, 556, 557, 558, 559, 606, 607, 608, 609}, {575, 576, 577, 578, 579, 580, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 6, 31, 56, 81, 106, 131, 156, 181, 206, 231, 256, 281, 306, 331, 356, 381, 406, 431, 456, 481, 506, 531, 556, 606, 505, 507, 508, 509, 530, 532, 533, 534, 555, 557, 558, 559, 605, 607, 608, 609}, {575, 576, 577, 578, 579, 580, 581, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 7, 32, 57, 82, 107, 132, 157, 182, 207, 232, 257, 282, 307, 332, 357, 382, 407, 432, 457, 482, 507, 532, 557, 607, 505, 506, 508, 509, 530, 531, 533, 534, 555, 556, 558, 559, 605, 606, 608, 609}, {575, 576, 577, 578, 579, 580, 581, 582, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 8, 33, 58, 83, 108, 133, 158, 183, 208, 233, 258, 283, 308, 333, 358, 383, 408, 433, 458, 483, 508, 533, 558, 608, 505, 506, 507, 509, 530, 531, 532, 534, 555, 556, 557, 559, 605, 606, 607, 609}, {575, 576, 577, 578, 579, 580, 581, 582, 583, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 9, 34, 59, 84, 109, 134, 159, 184, 209, 234, 259, 284, 309, 334, 359, 384, 409, 434, 459, 484, 509, 534, 559, 609, 505, 506, 507, 508, 530, 531, 532, 533, 555, 556, 557, 558, 605, 606, 607, 608}, {575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 10, 35, 60, 85, 110, 135, 160, 185, 210, 235, 260, 285, 310, 335, 360, 385, 410, 435, 460, 485, 510, 535, 560, 610, 511, 512, 513, 514, 536, 537, 538, 539, 561, 562, 563, 564, 611, 612, 613, 614}, {575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 11, 36, 61, 86, 111, 136, 161, 186, 211, 236, 261, 286, 311, 336, 361, 386, 411, 436, 461, 486, 511, 536, 561, 611, 510, 512, 513, 514, 535, 537, 538, 539, 560, 562, 563, 564, 610, 612, 613, 614}, {575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 12, 37, 62, 87, 112, 137, 162, 187, 212, 237, 262, 287, 312, 337, 362, 387, 412, 437, 462, 487, 512, 537, 562, 612, 510, 511, 513, 514, 535, 536, 538, 539, 560, 561, 563, 564, 610, 611, 613, 614}, {575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 13, 38, 63, 88, 113, 138, 163, 188, 213, 238, 263, 288, 313, 338, 363, 388, 413, 438, 463, 488, 513, 538, 563, 613, 510, 511, 512, 514, 535, 536, 537, 539, 560, 561, 562, 564, 610, 611, 612, 614}, {575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 14, 39, 64, 89, 114, 139, 164, 189, 214, 239, 264, 289, 314, 339, 364, 389, 414, 439, 464, 489, 514, 539, 564, 614, 510, 511, 512, 513, 535, 536, 537, 538, 560, 561, 562, 563, 610, 611, 612, 613}, {575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 591, 592, 593, 594, 595, 596, 597, 598, 599, 15, 40, 65, 90, 115, 140, 165, 190, 215, 240, 265, 290, 315, 340, 365, 390, 415, 440, 465, 490, 515, 540, 565, 615, 516, 517, 518, 519, 541, 542, 543, 544, 566, 567, 568, 569, 616, 617, 618, 619}, {575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 592, 593, 594, 595, 596, 597, 598, 599, 16, 41, 66, 91, 116, 141, 166, 191, 216, 241, 266, 291, 316, 341, 366, 391, 416, 441, 466, 491, 516, 541, 566, 616, 515, 517, 518, 519, 540, 542, 543, 544, 565, 567, 568, 569, 615, 617, 618, 619}, {575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 593, 594, 595, 596, 597, 598, 599, 17, 42, 67, 92, 117, 142, 167, 192, 217, 242, 267, 292, 317, 342, 367, 392, 417, 442, 467, 492, 517, 542, 567, 617, 515, 516, 518, 519, 540, 541, 543, 544, 565, 566, 568, 569, 615, 616, 618, 619}, {575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 594, 595, 596, 597, 598, 599, 18, 43, 68, 93, 118, 143, 168, 193, 218, 243, 268, 293, 318, 343, 368, 393, 418, 443, 468, 493, 518, 543, 568, 618, 515, 516, 517, 519, 540, 541, 542, 544, 565, 566, 567, 569, 615, 616, 617, 619}, {575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 595, 596, 597, 598, 599, 19, 44, 69, 94, 119, 144, 169, 194, 219, 244, 269, 294, 319, 344, 369, 394, 419, 444, 469, 494, 519, 544, 569, 619, 515, 516, 517, 518, 540, 541, 542, 543, 565, 566, 567, 568, 615, 616, 617, 618}, {575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 596, 597, 598, 599, 20, 45, 70, 95, 120, 145, 170, 195, 220, 245, 270, 295, 320, 345, 370, 395, 420, 445, 470, 495, 520, 545, 570, 620, 521, 522, 523, 524, 546, 547, 548, 549, 571, 572, 573, 574, 621, 622, 623, 624}, {575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 597, 598, 599, 21, 46, 71, 96, 121, 146, 171, 196, 221, 246, 271, 296, 321, 346, 371, 396, 421, 446, 471, 496, 521, 546, 571, 621, 520, 522, 523, 524, 545, 547, 548, 549, 570, 572, 573, 574, 620, 622, 623, 624}, {575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 598, 599, 22, 47, 72, 97, 122, 147, 172, 197, 222, 247, 272, 297, 322, 347, 372, 397, 422, 447, 472, 497, 522, 547, 572, 622, 520, 521, 523, 524, 545, 546, 548, 549, 570, 571, 573, 574, 620, 621, 623, 624}, {575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 599, 23, 48, 73, 98, 123, 148, 173, 198, 223, 248, 273, 298, 323, 348, 373, 398, 423, 448, 473, 498, 523, 548, 573, 623, 520, 521, 522, 524, 545, 546, 547, 549, 570, 571, 572, 574, 620, 621, 622, 624}, {575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 24, 49, 74, 99, 124, 149, 174, 199, 224, 249, 274, 299, 324, 349, 374, 399, 424, 449, 474, 499, 524, 549, 574, 624, 520, 521, 522, 523, 545, 546, 547, 548, 570, 571, 572, 573, 620, 621, 622, 623}}, {{601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 0, 25, 50, 75, 100, 125, 150, 175, 200, 225, 250, 275, 300, 325, 350, 375, 400, 425, 450, 475, 500, 525, 550, 575, 501, 502, 503, 504, 526, 527, 528, 529, 551, 552, 553, 554, 576, 577, 578, 579}, {600, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 1, 26, 51, 76, 101, 126, 151, 176, 201, 226, 251, 276, 301, 326, 351, 376, 401, 426, 451, 476, 501, 526, 551, 576, 500, 502, 503, 504, 525, 527, 528, 529, 550, 552, 553, 554, 575, 577, 578, 579}, {600, 601, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 2, 27, 52, 77, 102, 127, 152, 177, 202, 227, 252, 277, 302, 327, 352, 377, 402, 427, 452, 477, 502, 527, 552, 577, 500, 501, 503, 504, 525, 526, 528, 529, 550, 551, 553, 554, 575, 576, 578, 579}, {600, 601, 602, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 3, 28, 53, 78, 103, 128, 153, 178, 203, 228, 253, 278, 303, 328, 353, 378, 403, 428, 453, 478, 503, 528, 553, 578, 500, 501, 502, 504, 525, 526, 527, 529, 550, 551, 552, 554, 575, 576, 577, 579}, {600, 601, 602, 603, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 4, 29, 54, 79, 104, 129, 154, 179, 204, 229, 254, 279, 304, 329, 354, 379, 404, 429, 454, 479, 504, 529, 554, 579, 500, 501, 502, 503, 525, 526, 527, 528, 550, 551, 552, 553, 575, 576, 577, 578}, {600, 601, 602, 603, 604, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 5, 30, 55, 80, 105, 130, 155, 180, 205, 230, 255, 280, 305, 330, 355, 380, 405, 430, 455, 480, 505, 530, 555, 580, 506, 507, 508, 509, 531, 532, 533, 534, 556, 557, 558, 559, 581, 582, 583, 584}, {600, 601, 602, 603, 604, 605, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 6, 31, 56, 81, 106, 131, 156, 181, 206, 231, 256, 281, 306, 331, 356, 381, 406, 431, 456, 481, 506, 531, 556, 581, 505, 507, 508, 509, 530, 532, 533, 534, 555, 557, 558, 559, 580, 582, 583, 584}, {600, 601, 602, 603, 604, 605, 606, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 7, 32, 57, 82, 107, 132, 157, 182, 207, 232, 257, 282, 307, 332, 357, 382, 407, 432, 457, 482, 507, 532, 557, 582, 505, 506, 508, 509, 530, 531, 533, 534, 555, 556, 558, 559, 580, 581, 583, 584}, {600, 601, 602, 603, 604, 605, 606, 607, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 8, 33, 58, 83, 108, 133, 158, 183, 208, 233, 258, 283, 308, 333, 358, 383, 408, 433, 458, 483, 508, 533, 558, 583, 505, 506, 507, 509, 530, 531, 532, 534, 555, 556, 557, 559, 580, 581, 582, 584}, {600, 601, 602, 603, 604, 605, 606, 607, 608, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 9, 34, 59, 84, 109, 134, 159, 184, 209, 234, 259, 284, 309, 334, 359, 384, 409, 434, 459, 484, 509, 534, 559, 584, 505, 506, 507, 508, 530, 531, 532, 533, 555, 556, 557, 558, 580, 581, 582, 583}, {600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 10, 35, 60, 85, 110, 135, 160, 185, 210, 235, 260, 285, 310, 335, 360, 385, 410, 435, 460, 485, 510, 535, 560, 585, 511, 512, 513, 514, 536, 537, 538, 539, 561, 562, 563, 564, 586, 587, 588, 589}, {600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 11, 36, 61, 86, 111, 136, 161, 186, 211, 236, 261, 286, 311, 336, 361, 386, 411, 436, 461, 486, 511, 536, 561, 586, 510, 512, 513, 514, 535, 537, 538, 539, 560, 562, 563, 564, 585, 587, 588, 589}, {600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 12, 37, 62, 87, 112, 137, 162, 187, 212, 237, 262, 287, 312, 337, 362, 387, 412, 437, 462, 487, 512, 537, 562, 587, 510, 511, 513, 514, 535, 536, 538, 539, 560, 561, 563, 564, 585, 586, 588, 589}, {600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 13, 38, 63, 88, 113, 138, 163, 188, 213, 238, 263, 288, 313, 338, 363, 388, 413, 438, 463, 488, 513, 538, 563, 588, 510, 511, 512, 514, 535, 536, 537, 539, 560, 561, 562, 564, 585, 586, 587, 589}, {600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 14, 39, 64, 89, 114, 139, 164, 189, 214, 239, 264, 289, 314, 339, 364, 389, 414, 439, 464, 489, 514, 539, 564, 589, 510, 511, 512, 513, 535, 536, 537, 538, 560, 561, 562, 563, 585, 586, 587, 588}, {600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 616, 617, 618, 619, 620, 621, 622, 623, 624, 15, 40, 65, 90, 115, 140, 165, 190, 215, 240, 265, 290, 315, 340, 365, 390, 415, 440, 465, 490, 515, 540, 565, 590, 516, 517, 518, 519, 541, 542, 543, 544, 566, 567, 568, 569, 591, 592, 593, 594}, {600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 617, 618, 619, 620, 621, 622, 623, 624, 16, 41, 66, 91, 116, 141, 166, 191, 216, 241, 266, 291, 316, 341, 366, 391, 416, 441, 466, 491, 516, 541, 566, 591, 515, 517, 518, 519, 540, 542, 543, 544, 565, 567, 568, 569, 590, 592, 593, 594}, {600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 618, 619, 620, 621, 622, 623, 624, 17, 42, 67, 92, 117, 142, 167, 192, 217, 242, 267, 292, 317, 342, 367, 392, 417, 442, 467, 492, 517, 542, 567, 592, 515, 516, 518, 519, 540, 541, 543, 544, 565, 566, 568, 569, 590, 591, 593, 594}, {600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 619, 620, 621, 622, 623, 624, 18, 43, 68, 93, 118, 143, 168, 193, 218, 243, 268, 293, 318, 343, 368, 393, 418, 443, 468, 493, 518, 543, 568, 593, 515, 516, 517, 519, 540, 541, 542, 544, 565, 566, 567, 569, 590, 591, 592, 594}, {600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 620, 621, 622, 623, 624, 19, 44, 69, 94, 119, 144, 169, 194, 219, 244, 269, 294, 319, 344, 369, 394, 419, 444, 469, 494, 519, 544, 569, 594, 515, 516, 517, 518, 540, 541, 542, 543, 565, 566, 567, 568, 590, 591, 592, 593}, {600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 621, 622, 623, 624, 20, 45, 70, 95, 120, 145, 170, 195, 220, 245, 270, 295, 320, 345, 370, 395, 420, 445, 470, 495, 520, 545, 570, 595, 521, 522, 523, 524, 546, 547, 548, 549, 571, 572, 573, 574, 596, 597, 598, 599}, {600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 622, 623, 624, 21, 46, 71, 96, 121, 146, 171, 196, 221, 246, 271, 296, 321, 346, 371, 396, 421, 446, 471, 496, 521, 546, 571, 596, 520, 522, 523, 524, 545, 547, 548, 549, 570, 572, 573, 574, 595, 597, 598, 599}, {600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 623, 624, 22, 47, 72, 97, 122, 147, 172, 197, 222, 247, 272, 297, 322, 347, 372, 397, 422, 447, 472, 497, 522, 547, 572, 597, 520, 521, 523, 524, 545, 546, 548, 549, 570, 571, 573, 574, 595, 596, 598, 599}, {600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 624, 23, 48, 73, 98, 123, 148, 173, 198, 223, 248, 273, 298, 323, 348, 373, 398, 423, 448, 473, 498, 523, 548, 573, 598, 520, 521, 522, 524, 545, 546, 547, 549, 570, 571, 572, 574, 595, 596, 597, 599}, {600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 24, 49, 74, 99, 124, 149, 174, 199, 224, 249, 274, 299, 324, 349, 374, 399, 424, 449, 474, 499, 524, 549, 574, 599, 520, 521, 522, 523, 545, 546, 547, 548, 570, 571, 572, 573, 595, 596, 597, 598}}}; const unsigned int Indexer::subunit_combinations_2 [300][2] = {{0, 1}, {0, 2}, {0, 3}, {0, 4}, {0, 5}, {0, 6}, {0, 7}, {0, 8}, {0, 9}, {0, 10}, {0, 11}, {0, 12}, {0, 13}, {0, 14}, {0, 15}, {0, 16}, {0, 17}, {0, 18}, {0, 19}, {0, 20}, {0, 21}, {0, 22}, {0, 23}, {0, 24}, {1, 2}, {1, 3}, {1, 4}, {1, 5}, {1, 6}, {1, 7}, {1, 8}, {1, 9}, {1, 10}, {1, 11}, {1, 12}, {1, 13}, {1, 14}, {1, 15}, {1, 16}, {1, 17}, {1, 18}, {1, 19}, {1, 20}, {1, 21}, {1, 22}, {1, 23}, {1, 24}, {2, 3}, {2, 4}, {2, 5}, {2, 6}, {2, 7}, {2, 8}, {2, 9}, {2, 10}, {2, 11}, {2, 12}, {2, 13}, {2, 14}, {2, 15}, {2, 16}, {2, 17}, {2, 18}, {2, 19}, {2, 20}, {2, 21}, {2, 22}, {2, 23}, {2, 24}, {3, 4}, {3, 5}, {3, 6}, {3, 7}, {3, 8}, {3, 9}, {3, 10}, {3, 11}, {3, 12}, {3, 13}, {3, 14}, {3, 15}, {3, 16}, {3, 17}, {3, 18}, {3, 19}, {3, 20}, {3, 21}, {3, 22}, {3, 23}, {3, 24}, {4, 5}, {4, 6}, {4, 7}, {4, 8}, {4, 9}, {4, 10}, {4, 11}, {4, 12}, {4, 13}, {4, 14}, {4, 15}, {4, 16}, {4, 17}, {4, 18}, {4, 19}, {4, 20}, {4, 21}, {4, 22}, {4, 23}, {4, 24}, {5, 6}, {5, 7}, {5, 8}, {5, 9}, {5, 10}, {5, 11}, {5, 12}, {5, 13}, {5, 14}, {5, 15}, {5, 16}, {5, 17}, {5, 18}, {5, 19}, {5, 20}, {5, 21}, {5, 22}, {5, 23}, {5, 24}, {6, 7}, {6, 8}, {6, 9}, {6, 10}, {6, 11}, {6, 12}, {6, 13}, {6, 14}, {6, 15}, {6, 16}, {6, 17}, {6, 18}, {6, 19}, {6, 20}, {6, 21}, {6, 22}, {6, 23}, {6, 24}, {7, 8}, {7, 9}, {7, 10}, {7, 11}, {7, 12}, {7, 13}, {7, 14}, {7, 15}, {7, 16}, {7, 17}, {7, 18}, {7, 19}, {7, 20}, {7, 21}, {7, 22}, {7, 23}, {7, 24}, {8, 9}, {8, 10}, {8, 11}, {8, 12}, {8, 13}, {8, 14}, {8, 15}, {8, 16}, {8, 17}, {8, 18}, {8, 19}, {8, 20}, {8, 21}, {8, 22}, {8, 23}, {8, 24}, {9, 10}, {9, 11}, {9, 12}, {9, 13}, {9, 14}, {9, 15}, {9, 16}, {9, 17}, {9, 18}, {9, 19}, {9, 20}, {9, 21}, {9, 22}, {9, 23}, {9, 24}, {10, 11}, {10, 12}, {10, 13}, {10, 14}, {10, 15}, {10, 16}, {10, 17}, {10, 18}, {10, 19}, {10, 20}, {10, 21}, {10, 22}, {10, 23}, {10, 24}, {11, 12}, {11, 13}, {11, 14}, {11, 15}, {11, 16}, {11, 17}, {11, 18}, {11, 19}, {11, 20}, {11, 21}, {11, 22}, {11, 23}, {11, 24}, {12, 13}, {12, 14}, {12, 15}, {12, 16}, {12, 17}, {12, 18}, {12, 19}, {12, 20}, {12, 21}, {12, 22}, {12, 23}, {12, 24}, {13, 14}, {13, 15}, {13, 16}, {13, 17}, {13, 18}, {13, 19}, {13, 20}, {13, 21}, {13, 22}, {13, 23}, {13, 24}, {14, 15}, {14, 16}, {14, 17}, {14, 18}, {14, 19}, {14, 20}, {14, 21}, {14, 22}, {14, 23}, {14, 24}, {15, 16}, {15, 17}, {15, 18}, {15, 19}, {15, 20}, {15, 21}, {15, 22}, {15, 23}, {15, 24}, {16, 17}, {16, 18}, {16, 19}, {16, 20}, {16, 21}, {16, 22}, {16, 23}, {16, 24}, {17, 18}, {17, 19}, {17, 20}, {17, 21}, {17, 22}, {17, 23}, {17, 24}, {18, 19}, {18, 20}, {18, 21}, {18, 22}, {18, 23}, {18, 24}, {19, 20}, {19, 21}, {19, 22}, {19, 23}, {19, 24}, {20, 21}, {20, 22}, {20, 23}, {20, 24}, {21, 22}, {21, 23}, {21, 24}, {22, 23}, {22, 24}, {23, 24}}; const unsigned int Indexer::subvalue_combinations_2 [300][2] = {{0, 1}, {0, 2}, {0, 3}, {0, 4}, {0, 5}, {0, 6}, {0, 7}, {0, 8}, {0, 9}, {0, 10}, {0, 11}, {0, 12}, {0, 13}, {0, 14}, {0, 15}, {0, 16}, {0, 17}, {0, 18}, {0, 19}, {0, 20}, {0, 21}, {0, 22}, {0, 23}, {0, 24}, {1, 2}, {1, 3}, {1, 4}, {1, 5}, {1, 6}, {1, 7}, {1, 8}, {1, 9}, {1, 10}, {1, 11}, {1, 12}, {1, 13}, {1, 14}, {1, 15}, {1, 16}, {1, 17}, {1, 18}, {1, 19}, {1, 20}, {1, 21}, {1, 22}, {1, 23}, {1, 24}, {2, 3}, {2, 4}, {2, 5}, {2, 6}, {2, 7}, {2, 8}, {2, 9}, {2, 10}, {2, 11}, {2, 12}, {2, 13}, {2, 14}, {2, 15}, {2, 16}, {2, 17}, {2, 18}, {2, 19}, {2, 20}, {2, 21}, {2, 22}, {2, 23}, {2, 24}, {3, 4}, {3, 5}, {3, 6}, {3, 7}, {3, 8}, {3, 9}, {3, 10}, {3, 11}, {3, 12}, {3, 13}, {3, 14}, {3, 15}, {3, 16}, {3, 17}, {3, 18}, {3, 19}, {3, 20}, {3, 21}, {3, 22}, {3, 23}, {3, 24}, {4, 5}, {4, 6}, {4, 7}, {4, 8}, {4, 9}, {4, 10}, {4, 11}, {4, 12}, {4, 13}, {4, 14}, {4, 15}, {4, 16}, {4, 17}, {4, 18}, {4, 19}, {4, 20}, {4, 21}, {4, 22}, {4, 23}, {4, 24}, {5, 6}, {5, 7}, {5, 8}, {5, 9}, {5, 10}, {5, 11}, {5, 12}, {5, 13}, {5, 14}, {5, 15}, {5, 16}, {5, 17}, {5, 18}, {5, 19}, {5, 20}, {5, 21}, {5, 22}, {5, 23}, {5, 24}, {6, 7}, {6, 8}, {6, 9}, {6, 10}, {6, 11}, {6, 12}, {6, 13}, {6, 14}, {6, 15}, {6, 16}, {6, 17}, {6, 18}, {6, 19}, {6, 20}, {6, 21}, {6, 22}, {6, 23}, {6, 24}, {7, 8}, {7, 9}, {7, 10}, {7, 11}, {7, 12}, {7, 13}, {7, 14}, {7, 15}, {7, 16}, {7, 17}, {7, 18}, {7, 19}, {7, 20}, {7, 21}, {7, 22}, {7, 23}, {7, 24}, {8, 9}, {8, 10}, {8, 11}, {8, 12}, {8, 13}, {8, 14}, {8, 15}, {8, 16}, {8, 17}, {8, 18}, {8, 19}, {8, 20}, {8, 21}, {8, 22}, {8, 23}, {8, 24}, {9, 10}, {9, 11}, {9, 12}, {9, 13}, {9, 14}, {9, 15}, {9, 16}, {9, 17}, {9, 18}, {9, 19}, {9, 20}, {9, 21}, {9, 22}, {9, 23}, {9, 24}, {10, 11}, {10, 12}, {10, 13}, {10, 14}, {10, 15}, {10, 16}, {10, 17}, {10, 18}, {10, 19}, {10, 20}, {10, 21}, {10, 22}, {10, 23}, {10, 24}, {11, 12}, {11, 13}, {11, 14}, {11, 15}, {11, 16}, {11, 17}, {11, 18}, {11, 19}, {11, 20}, {11, 21}, {11, 22}, {11, 23}, {11, 24}, {12, 13}, {12, 14}, {12, 15}, {12, 16}, {12, 17}, {12, 18}, {12, 19}, {12, 20}, {12, 21}, {12, 22}, {12, 23}, {12, 24}, {13, 14}, {13, 15}, {13, 16}, {13, 17}, {13, 18}, {13, 19}, {13, 20}, {13, 21}, {13, 22}, {13, 23}, {13, 24}, {14, 15}, {14, 16}, {14, 17}, {14, 18}, {14, 19}, {14, 20}, {14, 21}, {14, 22}, {14, 23}, {14, 24}, {15, 16}, {15, 17}, {15, 18}, {15, 19}, {15, 20}, {15, 21}, {15, 22}, {15, 23}, {15, 24}, {16, 17}, {16, 18}, {16, 19}, {16, 20}, {16, 21}, {16, 22}, {16, 23}, {16, 24}, {17, 18}, {17, 19}, {17, 20}, {17, 21}, {17, 22}, {17, 23}, {17, 24}, {18, 19}, {18, 20}, {18, 21}, {18, 22}, {18, 23}, {18, 24}, {19, 20}, {19, 21}, {19, 22}, {19, 23}, {19, 24}, {20, 21}, {20, 22}, {20, 23}, {20, 24}, {21, 22}, {21, 23}, {21, 24}, {22, 23}, {22, 24}, {23, 24}}; 
\ No newline at end of file
@@ -0,0 +1,158 @@
+/*
+Load generator for `sudoku serve`: replays the puzzles of a dataset as solve requests
+over several connections, keeping a number of requests in flight on each connection,
+then reports the client side throughput and latencies, and the server stats.
+*/
+
+#include "config.h"
+#include "dataset.h"
+#include "parser.hpp"
+#include "server.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+struct ConnectionResult
+{
+    std::vector<uint32_t> latencies_us;
+    std::map<std::string, unsigned long> statuses;
+    bool failed = false;
+};
+
+// send the requests [begin, end) of the dataset with up to depth requests in flight
+void run_connection(
+    const std::string& socket_path, unsigned int port, const std::vector<std::string>& puzzles,
+    unsigned long begin, unsigned long end, unsigned int depth, unsigned int deadline_ms, ConnectionResult& result
+){
+    int fd = server::connect_to(socket_path, port);
+    if (fd < 0){
+        result.failed = true;
+        return;
+    }
+    std::string options = deadline_ms > 0 ? " deadline_ms=" + std::to_string(deadline_ms) : "";
+    std::map<unsigned long, std::chrono::steady_clock::time_point> sent_at;
+    unsigned long next = begin;
+    std::string response;
+
+    while (next < end || !sent_at.empty()){
+        while (next < end && sent_at.size() < depth){
+            sent_at[next] = std::chrono::steady_clock::now();
+            if (!server::write_frame(fd, std::to_string(next) + " solve " + puzzles[next % puzzles.size()] + options)){
+                result.failed = true;
+                close(fd);
+                return;
+            }
+            next++;
+        }
+        if (!server::read_frame(fd, response)){
+            result.failed = true;
+            break;
+        }
+        auto now = std::chrono::steady_clock::now();
+        size_t first_space = response.find(' ');
+        size_t second_space = response.find(' ', first_space + 1);
+        unsigned long id = std::stoul(response.substr(0, first_space));
+        result.statuses[response.substr(first_space + 1, second_space - first_space - 1)]++;
+        auto it = sent_at.find(id);
+        if (it == sent_at.end()) continue;
+        result.latencies_us.push_back(std::chrono::duration_cast<std::chrono::microseconds>(now - it->second).count());
+        sent_at.erase(it);
+    }
+    close(fd);
+}
+
+int main(int argc, char* argv[])
+{
+    auto parser = parser::CommandlineParser(argc, argv);
+    parser.set_help_message(
+        "Usage: " + parser.prog_name() + " -i <dataset> [options]\n"
+        "Options:\n"
+        "  -i <dataset>          Puzzles in the compact format, one per line\n"\
+        "  [--socket <path>]     Connect to a Unix domain socket\n"\
+        "  [--port <port>]       Otherwise to 127.0.0.1:<port>, 9000 if not provided\n"\
+        "  [-n <n_requests>]     Number of requests, the dataset is repeated if needed, the dataset size if not provided\n"\
+        "  [-c <n_connections>]  Number of connections, 4 if not provided\n"\
+        "  [-p <depth>]          Requests in flight per connection, 8 if not provided\n"\
+        "  [--deadline <ms>]     Deadline of each request, none if not provided\n"\
+        );
+    parser.check_help_exit();
+
+    std::string input_file = parser.parse_arg<std::string>("-i", "");
+    std::string socket_path = parser.parse_arg<std::string>("--socket", "");
+    unsigned int port = parser.parse_arg<unsigned int>("--port", 9000);
+    unsigned int n_connections = std::max(parser.parse_arg<unsigned int>("-c", 4), 1u);
+    unsigned int depth = std::max(parser.parse_arg<unsigned int>("-p", 8), 1u);
+    unsigned int deadline_ms = parser.parse_arg<unsigned int>("--deadline", 0);
+    if (input_file.empty()){
+        std::cerr << "-i is required, please use -h to check usage" << std::endl;
+        return 1;
+    }
+
+    std::vector<std::string> puzzles;
+    try{
+        CompactDataset dataset(input_file);
+        Board board;
+        char buffer[Board::max_serialized_size(BoardFormat::COMPACT)];
+        while (dataset.next(board)){
+            puzzles.emplace_back(buffer, board.serialize(buffer, BoardFormat::COMPACT) - 1);
+        }
+    } catch (std::runtime_error& e){
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    if (puzzles.empty()){
+        std::cerr << "No puzzle in: " << input_file << std::endl;
+        return 1;
+    }
+    unsigned long n_requests = parser.parse_arg<unsigned int>("-n", puzzles.size());
+
+    std::vector<ConnectionResult> results(n_connections);
+    std::vector<std::thread> threads;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < n_connections; i++){
+        unsigned long begin = n_requests * i / n_connections;
+        unsigned long end = n_requests * (i + 1) / n_connections;
+        threads.emplace_back(run_connection, socket_path, port, std::cref(puzzles), begin, end, depth, deadline_ms, std::ref(results[i]));
+    }
+    for (auto& t: threads){
+        t.join();
+    }
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::vector<uint32_t> latencies;
+    std::map<std::string, unsigned long> statuses;
+    for (auto& res: results){
+        if (res.failed){
+            std::cerr << "A connection failed, is the server running?" << std::endl;
+        }
+        latencies.insert(latencies.end(), res.latencies_us.begin(), res.latencies_us.end());
+        for (auto& [status, count]: res.statuses) statuses[status] += count;
+    }
+    if (latencies.empty()) return 1;
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&latencies](double p){ return latencies[std::min<size_t>(latencies.size() * p, latencies.size() - 1)]; };
+
+    std::cout << "Finished " << latencies.size() << " requests on " << n_connections << " connections (depth " << depth << ")" << std::endl;
+    std::cout << "Throughput: " << static_cast<unsigned long>(latencies.size() / elapsed) << " [requests/s]" << std::endl;
+    std::cout << "Latency p50: " << percentile(0.5) << ", p90: " << percentile(0.9) << ", p99: " << percentile(0.99)
+        << ", max: " << latencies.back() << " [us]" << std::endl;
+    std::cout << "Statuses:";
+    for (auto& [status, count]: statuses) std::cout << " " << status << "=" << count;
+    std::cout << std::endl;
+
+    int fd = server::connect_to(socket_path, port);
+    std::string response;
+    if (fd >= 0 && server::write_frame(fd, "0 stats") && server::read_frame(fd, response)){
+        std::cout << "Server: " << response.substr(response.find("ok ") + 3) << std::endl;
+    }
+    if (fd >= 0) close(fd);
+    return 0;
+}
@@ -2,29 +2,60 @@
 #include "config.h"
 #include "parser.hpp"
 #include "solver.h"
+#include "bit_search.h"
 #include "generate.h"
+#include "packed.h"
+#include "puzzle_db.h"
+#include "batch.h"
+#include "solution_cache.h"
+#include "server.h"
+#include "dedup.h"
+#include "validate.h"
+#include <csignal>
+#include <fstream>
+#include <thread>
 #include <chrono>
 
-bool solve_for(Board board, std::string output_file, bool verbose)
+// the exit code of solve for each status, listed in the help
+int solve_exit_code(SolveStatus status)
+{
+    switch (status){
+        case SolveStatus::SOLVED: return 0;
+        case SolveStatus::INVALID: return 2;
+        case SolveStatus::CONTRADICTION: return 3;
+        case SolveStatus::TIMEOUT: return 4;
+        case SolveStatus::MULTIPLE: return 5;
+        default: return 1;
+    }
+}
+
+int solve_for(Board board, std::string output_file, bool verbose, double timeout, bool check_unique, BoardFormat format)
 {
     Solver solver(board);
-    bool solved = false;
+    SolveStatus status = SolveStatus::UNSOLVED;
 
     try{
         auto start = std::chrono::high_resolution_clock::now();
-        solved = solver.solve();
+        status = solver.solve(SolveLimits::within(timeout));
+        if (status == SolveStatus::SOLVED && check_unique && BitSearch().count(board, 2) > 1){
+            status = SolveStatus::MULTIPLE;
+        }
         auto end = std::chrono::high_resolution_clock::now();
+        if (status == SolveStatus::TIMEOUT) std::cerr << "Timed out after " << timeout << " [s]" << std::endl;
         if (verbose) std::cout << "Time elapsed: " 
             << std::chrono::duration_cast<std::chrono::microseconds>( end - start).count()
             << " [µs] ";
     } catch (std::exception& e){
         std::cerr << "Error: " << e.what() << std::endl;
-        solved = false;
+        status = SolveStatus::UNSOLVED;
     }
 
     if (verbose){
-        if (solved) { std::cout << "Solved! "; }
-        else { std::cout << "Not solved. "; }
+        if (status == SolveStatus::SOLVED) { std::cout << "Solved! "; }
+        else { std::cout << "Not solved (" << solve_status_name(status) << "). "; }
+    }
+    else if (status == SolveStatus::INVALID || status == SolveStatus::CONTRADICTION || status == SolveStatus::MULTIPLE){
+        std::cerr << "Status: " << solve_status_name(status) << std::endl;
     }
 
     if (!output_file.empty()){
@@ -33,16 +64,21 @@ bool solve_for(Board board, std::string output_file, bool verbose)
     }
     else{
         if (verbose) std::cout << "Output: " << std::endl;
-        std::cout << solver.board() << std::endl;
+        std::cout << solver.board().to_string(format) << std::endl;
     }
-    return solved;
+    return solve_exit_code(status);
 }
 
-bool generate_for(unsigned int clue_count, std::string output_file, bool verbose){
-    auto [success, board] = gen::generate_board(clue_count, 1e5, true, verbose);
+bool generate_for(unsigned int clue_count, std::string output_file, bool verbose, double timeout, BoardFormat format){
+    auto [success, board, n_clues] = gen::generate_board(clue_count, 1e5, true, verbose, timeout);
     if (!success){
-        std::cerr << "Failed to generate a board with " << clue_count << " clues" << std::endl;
-        return false;
+        std::cerr << "Failed to generate a board with " << clue_count << " clues";
+        if (n_clues == 0){
+            std::cerr << std::endl;
+            return false;
+        }
+        // anytime mode, output the best board found within the time limit
+        std::cerr << ", the best board has " << n_clues << " clues" << std::endl;
     }
 
     if (!output_file.empty()){
@@ -51,27 +87,248 @@ bool generate_for(unsigned int clue_count, std::string output_file, bool verbose
     }
     else{
         if (verbose) std::cout << "Output: " << std::endl;
-        std::cout << board << std::endl;
+        std::cout << board.to_string(format) << std::endl;
+    }
+    return success;
+}
+
+int database_for(parser::CommandlineParser& parser, std::string input_file, std::string output_file, BoardFormat format){
+    try{
+        if (parser.has_subparser("build", 2)){
+            if (input_file.empty() || output_file.empty()){
+                std::cerr << "Both -i and -o are required" << std::endl;
+                return 1;
+            }
+            unsigned int n_threads = parser.parse_arg<unsigned int>("-j", std::max(std::thread::hardware_concurrency(), 1u));
+            uint32_t n_appended = db::PuzzleDB::build(input_file, output_file, n_threads);
+            std::cout << "Appended " << n_appended << " puzzles, the database has " << db::PuzzleDB(output_file).size() << std::endl;
+            return 0;
+        }
+
+        db::PuzzleDB database(input_file);
+        if (parser.has_subparser("get", 2)){
+            int n_clues = parser.parse_arg<int>("-c", db::ANY);
+            int bucket = parser.parse_arg<int>("-d", db::ANY);
+            db::Entry entry;
+            if (!database.random(n_clues, bucket, util::thread_rng(), entry)){
+                std::cerr << "No puzzle of the grade" << std::endl;
+                return 1;
+            }
+            std::cout << entry.puzzle.to_string(format) << std::endl;
+            return 0;
+        }
+        if (parser.has_subparser("stats", 2)){
+            std::cout << "Puzzles: " << database.size() << std::endl;
+            std::cout << "Clues | puzzles per bucket 0-" << db::N_BUCKETS - 1 << std::endl;
+            for (unsigned int c = 0; c <= CELL_COUNT; c++){
+                if (database.count(c, db::ANY) == 0) continue;
+                std::cout << c << " |";
+                for (unsigned int b = 0; b < db::N_BUCKETS; b++){
+                    std::cout << " " << database.count(c, b);
+                }
+                std::cout << std::endl;
+            }
+            return 0;
+        }
+    } catch (std::runtime_error& e){
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    std::cout << "Invalid db command, please use -h to check usage" << std::endl;
+    return 1;
+}
+
+int solve_batch_for(std::string input_file, std::string output_file, unsigned int n_threads, unsigned int cache_size, double timeout,
+    bool verbose){
+    std::ios::sync_with_stdio(false);
+    std::ifstream in_file;
+    std::ofstream out_file;
+    if (!input_file.empty()){
+        in_file.open(input_file);
+        if (!in_file.is_open()){
+            std::cerr << "Error: Failed to open file: " << input_file << std::endl;
+            return 1;
+        }
+    }
+    if (!output_file.empty()){
+        out_file.open(output_file, std::ios::trunc);
+        if (!out_file.is_open()){
+            std::cerr << "Error: Failed to open file: " << output_file << std::endl;
+            return 1;
+        }
+    }
+
+    std::unique_ptr<cache::SolutionCache> solution_cache;
+    if (cache_size > 0){
+        solution_cache.reset(new cache::SolutionCache(cache_size));
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    auto stats = batch::solve_stream(
+        input_file.empty() ? std::cin : in_file, 
+        output_file.empty() ? std::cout : out_file, 
+        n_threads,
+        solution_cache.get(),
+        timeout
+    );
+    auto end = std::chrono::high_resolution_clock::now();
+    if (verbose){
+        std::cerr << "Solved: " << stats.n_solved << ", unsolved: " << stats.n_unsolved << ", invalid: " << stats.n_invalid
+            << ", timeout: " << stats.n_timeout
+            << ", time elapsed: " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " [ms]" << std::endl;
+        if (solution_cache){
+            auto cache_stats = solution_cache->stats();
+            std::cerr << "Cache hits: " << cache_stats.n_hits << ", misses: " << cache_stats.n_misses
+                << ", evictions: " << cache_stats.n_evictions << ", hit rate: " << cache_stats.hit_rate << std::endl;
+        }
+    }
+    return (stats.n_unsolved == 0 && stats.n_invalid == 0) ? 0 : 1;
+}
+
+int dedup_for(std::string input_file, std::string output_file, unsigned int n_threads, bool verbose){
+    if (input_file.empty() || output_file.empty()){
+        std::cerr << "Both -i and -o are required" << std::endl;
+        return 1;
     }
-    return true;
+    try{
+        auto start = std::chrono::high_resolution_clock::now();
+        auto stats = dedup::dedup_file(input_file, output_file, n_threads);
+        auto end = std::chrono::high_resolution_clock::now();
+        std::cout << "Unique: " << stats.n_unique << "/" << stats.n_records << ", duplicates: " << stats.n_duplicates
+            << ", invalid: " << stats.n_invalid << std::endl;
+        if (verbose){
+            std::cout << "Hash collisions: " << stats.n_collisions << ", time elapsed: "
+                << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " [ms]" << std::endl;
+        }
+    } catch (std::runtime_error& e){
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+int validate_for(std::string input_file, std::string output_file, unsigned int n_threads, bool verbose){
+    if (input_file.empty()){
+        std::cerr << "An input file is required (-i)" << std::endl;
+        return 1;
+    }
+    std::vector<unsigned long> failed_lines;
+    try{
+        auto start = std::chrono::high_resolution_clock::now();
+        auto stats = validate::validate_file(input_file, n_threads, output_file.empty() ? nullptr : &failed_lines);
+        auto end = std::chrono::high_resolution_clock::now();
+        std::cout << "Valid: " << stats.n_valid << "/" << stats.n_lines << ", invalid: " << stats.n_invalid
+            << ", malformed: " << stats.n_malformed << std::endl;
+        if (verbose){
+            double seconds = std::chrono::duration<double>(end - start).count();
+            std::cout << "Time elapsed: " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
+                << " [ms], throughput: " << static_cast<unsigned long>(stats.n_lines / std::max(seconds, 1e-9)) << " [lines/s]" << std::endl;
+        }
+        if (!output_file.empty()){
+            std::ofstream file(output_file, std::ios::trunc);
+            if (!file.is_open()) throw std::runtime_error("Failed to open file: " + output_file);
+            for (unsigned long line: failed_lines) file << line << "\n";
+        }
+        return stats.n_valid == stats.n_lines ? 0 : 1;
+    } catch (std::runtime_error& e){
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}
+
+static server::Server* g_server = nullptr;
+
+int serve_for(parser::CommandlineParser& parser){
+    server::ServerConfig config;
+    config.socket_path = parser.parse_arg<std::string>("--socket", "");
+    config.port = parser.parse_arg<unsigned int>("--port", 9000);
+    config.n_threads = parser.parse_arg<unsigned int>("-j", std::max(std::thread::hardware_concurrency(), 1u));
+    config.default_deadline_ms = parser.parse_arg<unsigned int>("--deadline", 0);
+    config.max_generate_ms = std::max(parser.parse_arg<unsigned int>("--gen-deadline", 1000), 1u);
+
+    server::Server srv(config);
+    g_server = &srv;
+    auto on_signal = [](int){ if (g_server) g_server->stop(); };
+    std::signal(SIGINT, on_signal);
+    std::signal(SIGTERM, on_signal);
+    try{
+        std::cerr << "Serving on " << (config.socket_path.empty() ? "127.0.0.1:" + std::to_string(config.port) : config.socket_path)
+            << " with " << config.n_threads << " threads" << std::endl;
+        srv.run();
+    } catch (std::runtime_error& e){
+        std::cerr << "Error: " << e.what() << std::endl;
+        g_server = nullptr;
+        return 1;
+    }
+    g_server = nullptr;
+    return 0;
+}
+
+BoardFormat parse_format(const std::string& name){
+    if (name == "compact") return BoardFormat::COMPACT;
+    if (name == "pretty") return BoardFormat::PRETTY;
+    if (name != "spaced"){
+        std::cerr << "Unknown format: " << name << ", using spaced" << std::endl;
+    }
+    return BoardFormat::SPACED;
 }
 
 int main(int argc, char* argv[]){
     auto parser = parser::CommandlineParser(argc, argv);
 
     parser.set_help_message(
-        "Usage: " + parser.prog_name() + " solve|generate \n"
+        "Usage: " + parser.prog_name() + " solve|generate|pack|unpack|dedup|validate|db|serve \n"
         "Options:\n"
         "  -h, --help            Show this help message and exit\n"\
         "  --show-config         Show the current configuration and exit\n"\
+        "  [-f <format>]         Output format: spaced (default), compact or pretty\n"\
         "solve:\n"\
         "  [-i <input_file>]     Input file, will read from stdin if not provided\n"\
+        "  [-n <index>]          Puzzle index, if the input file is packed\n"\
+        "  [--batch]             Solve one compact puzzle per line, output '<board> <status>' lines in order\n"\
+        "  [-j <n_threads>]      Number of solver threads in batch mode, all cores if not provided\n"\
+        "  [--cache <n_entries>] Cache the solutions in batch mode, shared by equivalent puzzles\n"\
+        "  [-t <seconds>]        Time limit of a single puzzle, none if not provided\n"\
+        "  [--unique]            Check that the solution is unique\n"\
+        "                        Exit code: 0 solved, 1 unsolved, 2 invalid, 3 contradiction, 4 timeout, 5 multiple\n"\
         "  [-o <output_file>]    Output file\n"\
         "  [-v, --verbose]       Show verbose output\n"\
         "generate:\n"\
         "  [-c <clue_count>]     Number of clues, will output full board if not provided\n"\
+        "  [-t <seconds>]        Time limit, output the board with the fewest clues found if exceeded\n"\
         "  [-o <output_file>]    Output file\n"\
         "  [-v, --verbose]       Show verbose output\n"\
+        "pack:\n"\
+        "  -i <input_file>       Dataset with one compact puzzle per line\n"\
+        "  -o <output_file>      Packed binary file\n"\
+        "  [--solution]          Solve each puzzle and store the solution with it\n"\
+        "unpack:\n"\
+        "  -i <input_file>       Packed binary file\n"\
+        "  -o <output_file>      Dataset, in the compact format unless -f is given\n"\
+        "dedup:                  Keep the first puzzle of each equivalence class (up to symmetries and relabeling)\n"\
+        "  -i <input_file>       Dataset, compact or packed\n"\
+        "  -o <output_file>      Unique puzzles, in the format of the input\n"\
+        "  [-j <n_threads>]      Number of threads, all cores if not provided\n"\
+        "validate:               Check that each line holds a solved grid, exit code 1 if one does not\n"\
+        "  -i <input_file>       Dataset with one compact grid per line\n"\
+        "  [-o <output_file>]    Write the numbers of the failed lines\n"\
+        "  [-j <n_threads>]      Number of threads, all cores if not provided\n"\
+        "db build:               Solve, grade and append puzzles to a database\n"\
+        "  -i <input_file>       Dataset, compact or packed\n"\
+        "  -o <database>         Database file, created if missing\n"\
+        "  [-j <n_threads>]      Number of solver threads, all cores if not provided\n"\
+        "db get:                 Output a random puzzle of a grade\n"\
+        "  -i <database>         Database file\n"\
+        "  [-c <clue_count>]     Number of clues, any if not provided\n"\
+        "  [-d <bucket>]         Difficulty bucket 0-7 (0: no guess, b: up to 2^b guesses), any if not provided\n"\
+        "db stats:               Count the puzzles of each grade\n"\
+        "  -i <database>         Database file\n"\
+        "serve:                  Serve solve, generate, count and stats requests, see src/server.h\n"\
+        "  [--socket <path>]     Listen on a Unix domain socket\n"\
+        "  [--port <port>]       Otherwise on 127.0.0.1:<port>, 9000 if not provided\n"\
+        "  [-j <n_threads>]      Number of solver threads, all cores if not provided\n"\
+        "  [--deadline <ms>]     Deadline of the requests without one, none if not provided\n"\
+        "  [--gen-deadline <ms>] Longest a generate request runs, 1000 if not provided\n"\
         );
     parser.check_help_exit();
     if (parser.parse_flag("--show-config")){
@@ -84,26 +341,64 @@ int main(int argc, char* argv[]){
     std::string input_file = parser.parse_arg<std::string>("-i", "");
     std::string output_file = parser.parse_arg<std::string>("-o", "");
     int clue_count = parser.parse_arg<int>("-c", CELL_COUNT);
+    double timeout = parser.parse_arg<double>("-t", 0);
+    BoardFormat format = parse_format(parser.parse_arg<std::string>("-f", "spaced"));
     bool verbose = parser.parse_flag("-v") || parser.parse_flag("--verbose");
 
-    if (parser.has_subparser("solve")) {
+    if (parser.has_subparser("solve") && parser.parse_flag("--batch")) {
+        unsigned int n_threads = parser.parse_arg<unsigned int>("-j", std::max(std::thread::hardware_concurrency(), 1u));
+        unsigned int cache_size = parser.parse_arg<unsigned int>("--cache", 0);
+        return solve_batch_for(input_file, output_file, n_threads, cache_size, timeout, verbose);
+    } else if (parser.has_subparser("solve")) {
         Board board;
-        if (input_file.empty())
-        {
-            std::string input_str;
-            std::string line;
-            while (std::getline(std::cin, line))
+        try{
+            if (input_file.empty())
             {
-                input_str += line + "\n";
+                board.load_data(std::cin);
             }
-            board.load_data(input_str);
-        }
-        else{
-            board.load_from_file(input_file);
+            else if (packed::is_packed_file(input_file)){
+                packed::Reader reader(input_file);
+                unsigned int index = parser.parse_arg<unsigned int>("-n", 0);
+                if (index >= reader.size()){
+                    throw std::runtime_error("Puzzle index out of range, the file has " + std::to_string(reader.size()) + " puzzles");
+                }
+                reader.load(index, board);
+            }
+            else{
+                board.load_from_file(input_file);
+            }
+        } catch (std::runtime_error& e){
+            std::cerr << "Error: " << e.what() << std::endl;
+            return 1;
         }
-        return solve_for(board, output_file, verbose) ? 0 : 1;
+        return solve_for(board, output_file, verbose, timeout, parser.parse_flag("--unique"), format);
     } else if (parser.has_subparser("generate")) {
-        return generate_for(clue_count, output_file, verbose) ? 0 : 1;
+        return generate_for(clue_count, output_file, verbose, timeout, format) ? 0 : 1;
+    } else if (parser.has_subparser("pack") || parser.has_subparser("unpack")) {
+        if (input_file.empty() || output_file.empty()){
+            std::cerr << "Both -i and -o are required" << std::endl;
+            return 1;
+        }
+        try{
+            uint64_t n_records = parser.has_subparser("pack") ?
+                packed::from_text(input_file, output_file, parser.parse_flag("--solution")) :
+                packed::to_text(input_file, output_file, parser.has_arg("-f") ? format : BoardFormat::COMPACT);
+            if (verbose) std::cout << "Converted " << n_records << " puzzles to: " << output_file << std::endl;
+        } catch (std::runtime_error& e){
+            std::cerr << "Error: " << e.what() << std::endl;
+            return 1;
+        }
+        return 0;
+    } else if (parser.has_subparser("dedup")) {
+        unsigned int n_threads = parser.parse_arg<unsigned int>("-j", std::max(std::thread::hardware_concurrency(), 1u));
+        return dedup_for(input_file, output_file, n_threads, verbose);
+    } else if (parser.has_subparser("validate")) {
+        unsigned int n_threads = parser.parse_arg<unsigned int>("-j", std::max(std::thread::hardware_concurrency(), 1u));
+        return validate_for(input_file, output_file, n_threads, verbose);
+    } else if (parser.has_subparser("serve")) {
+        return serve_for(parser);
+    } else if (parser.has_subparser("db")) {
+        return database_for(parser, input_file, output_file, format);
     } else {
         std::cout << "Invalid subparser, please use -h to check usage" << std::endl;
         exit(1);
@@ -0,0 +1,230 @@
+#include "packed.h"
+#include "dataset.h"
+#include "solver.h"
+#include "config.h"
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+
+namespace packed
+{
+    static const char PACKED_MAGIC[4] = {'S', 'D', 'K', 'P'};
+    static const uint32_t PACKED_VERSION = 1;
+
+    void pack(const Board& board, uint8_t* out)
+    {
+        const val_t* cells = board.data();
+        constexpr unsigned int bits = bits_per_cell();
+        if constexpr (bits == 4){
+            // two cells per byte
+            for (unsigned int i = 0; i + 1 < CELL_COUNT; i += 2){
+                *out++ = static_cast<uint8_t>(cells[i] | (cells[i + 1] << 4));
+            }
+            if (CELL_COUNT % 2) *out = static_cast<uint8_t>(cells[CELL_COUNT - 1]);
+            return;
+        }
+        // least significant bits first, flushed a byte at a time
+        uint64_t acc = 0;
+        unsigned int n_bits = 0;
+        for (unsigned int i = 0; i < CELL_COUNT; i++){
+            acc |= static_cast<uint64_t>(cells[i]) << n_bits;
+            n_bits += bits;
+            while (n_bits >= 8){
+                *out++ = static_cast<uint8_t>(acc);
+                acc >>= 8;
+                n_bits -= 8;
+            }
+        }
+        if (n_bits) *out = static_cast<uint8_t>(acc);
+    }
+
+    bool unpack(const uint8_t* in, Board& board)
+    {
+        val_t* cells = board.data();
+        constexpr unsigned int bits = bits_per_cell();
+        // the fields can hold values above CANDIDATE_SIZE, checked once at the end
+        val_t max_value = 0;
+        if constexpr (bits == 4){
+            for (unsigned int i = 0; i + 1 < CELL_COUNT; i += 2){
+                cells[i] = *in & 0xF;
+                cells[i + 1] = *in++ >> 4;
+                max_value = std::max(max_value, std::max(cells[i], cells[i + 1]));
+            }
+            if (CELL_COUNT % 2){
+                cells[CELL_COUNT - 1] = *in & 0xF;
+                max_value = std::max(max_value, cells[CELL_COUNT - 1]);
+            }
+            return max_value <= CANDIDATE_SIZE;
+        }
+        constexpr uint64_t mask = (uint64_t(1) << bits) - 1;
+        uint64_t acc = 0;
+        unsigned int n_bits = 0;
+        for (unsigned int i = 0; i < CELL_COUNT; i++){
+            while (n_bits < bits){
+                acc |= static_cast<uint64_t>(*in++) << n_bits;
+                n_bits += 8;
+            }
+            cells[i] = static_cast<val_t>(acc & mask);
+            max_value = std::max(max_value, cells[i]);
+            acc >>= bits;
+            n_bits -= bits;
+        }
+        return max_value <= CANDIDATE_SIZE;
+    }
+
+    Writer::Writer(const std::string& path, uint32_t flags):
+    m_file(path, std::ios::binary | std::ios::trunc), m_path(path)
+    {
+        if (!m_file.is_open()){
+            throw std::runtime_error("Failed to open file: " + path);
+        }
+        std::memcpy(m_header.magic, PACKED_MAGIC, sizeof(PACKED_MAGIC));
+        m_header.version = PACKED_VERSION;
+        m_header.board_size = BOARD_SIZE;
+        m_header.flags = flags;
+        m_header.n_records = 0;
+        m_header.bits_per_cell = bits_per_cell();
+        m_header.record_size = record_size(flags);
+        m_file.write(reinterpret_cast<const char*>(&m_header), sizeof(m_header));
+        check_written();
+    }
+
+    Writer::~Writer()
+    {
+        // close() reports the errors, a writer destroyed without it only closes the file
+        try{ close(); } catch (std::runtime_error&){}
+    }
+
+    void Writer::check_written()
+    {
+        if (!m_file){
+            m_file.close();
+            throw std::runtime_error("Failed to write file: " + m_path);
+        }
+    }
+
+    void Writer::write(const Board& puzzle)
+    {
+        ASSERT(!(m_header.flags & HAS_SOLUTION), "the file is supposed to store solutions");
+        uint8_t buffer[BOARD_BYTES];
+        pack(puzzle, buffer);
+        m_file.write(reinterpret_cast<const char*>(buffer), BOARD_BYTES);
+        check_written();
+        m_header.n_records++;
+    }
+
+    void Writer::write(const Board& puzzle, const Board& solution)
+    {
+        ASSERT(m_header.flags & HAS_SOLUTION, "the file is not supposed to store solutions");
+        uint8_t buffer[BOARD_BYTES * 2];
+        pack(puzzle, buffer);
+        pack(solution, buffer + BOARD_BYTES);
+        m_file.write(reinterpret_cast<const char*>(buffer), sizeof(buffer));
+        check_written();
+        m_header.n_records++;
+    }
+
+    void Writer::close()
+    {
+        if (!m_file.is_open()) return;
+        m_file.seekp(0);
+        m_file.write(reinterpret_cast<const char*>(&m_header), sizeof(m_header));
+        m_file.flush();
+        check_written();
+        m_file.close();
+        if (m_file.fail()){
+            throw std::runtime_error("Failed to write file: " + m_path);
+        }
+    }
+
+    Reader::Reader(const std::string& path): m_file(path)
+    {
+        if (m_file.size() < sizeof(Header)){
+            throw std::runtime_error("Invalid packed file: " + path);
+        }
+        std::memcpy(&m_header, m_file.data(), sizeof(Header));
+        if (std::memcmp(m_header.magic, PACKED_MAGIC, sizeof(PACKED_MAGIC)) != 0 || m_header.version != PACKED_VERSION){
+            throw std::runtime_error("Invalid packed file: " + path);
+        }
+        if (m_header.board_size != BOARD_SIZE || m_header.bits_per_cell != bits_per_cell()){
+            throw std::runtime_error("The packed file is for " + std::to_string(m_header.board_size) + "x" + 
+                std::to_string(m_header.board_size) + " boards, the build is for " + std::to_string(BOARD_SIZE) + "x" + std::to_string(BOARD_SIZE));
+        }
+        if (m_header.record_size != record_size(m_header.flags)){
+            throw std::runtime_error("Invalid packed file: " + path + ", the record size does not match the flags");
+        }
+        // divided rather than multiplied, a large record count can not overflow
+        if ((m_file.size() - sizeof(Header)) / m_header.record_size < m_header.n_records){
+            throw std::runtime_error("Truncated packed file: " + path);
+        }
+    }
+
+    const uint8_t* Reader::record(uint64_t index) const
+    {
+        ASSERT(index < m_header.n_records, "record index out of bounds: " + std::to_string(index));
+        return reinterpret_cast<const uint8_t*>(m_file.data()) + sizeof(Header) + index * m_header.record_size;
+    }
+
+    void Reader::load(uint64_t index, Board& puzzle) const
+    {
+        if (!unpack(record(index), puzzle)){
+            throw std::runtime_error("Invalid packed record " + std::to_string(index) + ": a value is out of range");
+        }
+    }
+
+    void Reader::load_solution(uint64_t index, Board& solution) const
+    {
+        ASSERT(has_solution(), "the file stores no solution");
+        if (!unpack(record(index) + BOARD_BYTES, solution)){
+            throw std::runtime_error("Invalid packed record " + std::to_string(index) + ": a value is out of range");
+        }
+    }
+
+    bool is_packed_file(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        char magic[sizeof(PACKED_MAGIC)];
+        file.read(magic, sizeof(magic));
+        return file.good() && std::memcmp(magic, PACKED_MAGIC, sizeof(magic)) == 0;
+    }
+
+    uint64_t from_text(const std::string& text_path, const std::string& packed_path, bool solve)
+    {
+        CompactDataset dataset(text_path);
+        Writer writer(packed_path, solve ? static_cast<uint32_t>(HAS_SOLUTION) : 0u);
+        Board puzzle;
+        while (dataset.next(puzzle)){
+            if (!solve){
+                writer.write(puzzle);
+                continue;
+            }
+            // the solver is large on big boards, keep it off the stack
+            auto solver = std::unique_ptr<Solver>(new Solver(puzzle));
+            if (!solver->solve()){
+                throw std::runtime_error("Failed to solve the puzzle on line " + std::to_string(dataset.line_number()));
+            }
+            writer.write(puzzle, solver->board());
+        }
+        writer.close();
+        return writer.size();
+    }
+
+    uint64_t to_text(const std::string& packed_path, const std::string& text_path, BoardFormat format)
+    {
+        Reader reader(packed_path);
+        std::ofstream file(text_path, std::ios::trunc);
+        if (!file.is_open()){
+            throw std::runtime_error("Failed to open file: " + text_path);
+        }
+        Board puzzle;
+        char buffer[Board::max_serialized_size(BoardFormat::PRETTY)];
+        for (uint64_t i = 0; i < reader.size(); i++){
+            reader.load(i, puzzle);
+            file.write(buffer, puzzle.serialize(buffer, format));
+            // the multi-line formats are separated by an empty line
+            if (format != BoardFormat::COMPACT) file << '\n';
+        }
+        return reader.size();
+    }
+}
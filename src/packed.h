@@ -0,0 +1,97 @@
+/*
+A binary container for puzzle corpora, much smaller than the text lines:
+- a 32 bytes header: magic "SDKP", version, BOARD_SIZE, flags, number of records,
+  bits per cell and record size
+- fixed-size records, each cell packed into ceil(log2(CANDIDATE_SIZE + 1)) bits (41 bytes at 9x9),
+  the puzzle optionally followed by its solution packed the same way (HAS_SOLUTION flag)
+Records are addressed by index, so the reader maps the file and decodes a record in place.
+*/
+
+#pragma once
+#include "board.h"
+#include "util.h"
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+namespace packed
+{
+    enum Flags : uint32_t
+    {
+        HAS_SOLUTION = 1
+    };
+
+    struct Header
+    {
+        char magic[4];
+        uint32_t version;
+        uint32_t board_size;
+        uint32_t flags;
+        uint64_t n_records;
+        uint32_t bits_per_cell;
+        uint32_t record_size;
+    };
+    static_assert(sizeof(Header) == 32, "the header should have no padding");
+
+    // bits per cell and bytes of one packed board for this BOARD_SIZE
+    constexpr unsigned int bits_per_cell()
+    {
+        unsigned int bits = 0;
+        while ((1u << bits) <= CANDIDATE_SIZE) bits++;
+        return bits;
+    }
+    constexpr unsigned int BOARD_BYTES = (CELL_COUNT * bits_per_cell() + 7) / 8;
+
+    // bytes of a record: the puzzle, and the solution with HAS_SOLUTION
+    constexpr uint32_t record_size(uint32_t flags)
+    {
+        return BOARD_BYTES * ((flags & HAS_SOLUTION) ? 2 : 1);
+    }
+
+    void pack(const Board& board, uint8_t* out);        // writes BOARD_BYTES
+    // returns false if a cell holds a value above CANDIDATE_SIZE, which the bits can encode
+    bool unpack(const uint8_t* in, Board& board);
+
+    // appends records to a new file, the record count in the header is written on close,
+    // the writes throw std::runtime_error when the file can not be written (e.g. the disk is full)
+    class Writer
+    {
+    public:
+        Writer(const std::string& path, uint32_t flags = 0);     // throws std::runtime_error
+        ~Writer();
+        void write(const Board& puzzle);
+        void write(const Board& puzzle, const Board& solution);
+        void close();
+        uint64_t size() const { return m_header.n_records; }
+    private:
+        std::ofstream m_file;
+        std::string m_path;
+        Header m_header;
+        void check_written();
+    };
+
+    // random access to the records of a mapped file
+    class Reader
+    {
+    public:
+        // throws std::runtime_error on an invalid header, or a file shorter than its records
+        Reader(const std::string& path);
+        uint64_t size() const { return m_header.n_records; }
+        bool has_solution() const { return m_header.flags & HAS_SOLUTION; }
+        // throw std::runtime_error on a value out of range
+        void load(uint64_t index, Board& puzzle) const;
+        void load_solution(uint64_t index, Board& solution) const;
+    private:
+        util::MappedFile m_file;
+        Header m_header;
+        const uint8_t* record(uint64_t index) const;
+    };
+
+    // check the magic, without reading the rest of the file
+    bool is_packed_file(const std::string& path);
+
+    // converters between the compact text dataset and the packed file, return the number of records,
+    // with solve, the solution of each puzzle is computed and stored with it
+    uint64_t from_text(const std::string& text_path, const std::string& packed_path, bool solve = false);
+    uint64_t to_text(const std::string& packed_path, const std::string& text_path, BoardFormat format = BoardFormat::COMPACT);
+}
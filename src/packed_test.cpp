@@ -0,0 +1,108 @@
+#include "packed.h"
+#include "generate.h"
+#include "config.h"
+#include "testing.h"
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+int main(){
+    const std::string text_path = "./output/packed_test.txt";
+    const std::string packed_path = "./output/packed_test.sdkp";
+    std::cout << "Bytes per board: " << packed::BOARD_BYTES << std::endl;
+
+    // round trip of full and partly cleared boards
+    std::vector<Board> solutions(8), puzzles(8);
+    for (unsigned int i = 0; i < solutions.size(); i++){
+        gen::fill_valid_board(solutions[i], gen::FillStrategy::RANDOM);
+        puzzles[i].load_data(solutions[i]);
+        for (unsigned int j = i; j < CELL_COUNT; j += i + 2){
+            puzzles[i].set(j, 0);
+        }
+    }
+    uint8_t buffer[packed::BOARD_BYTES];
+    Board unpacked;
+    packed::pack(solutions[0], buffer);
+    ASSERT_TRUE(packed::unpack(buffer, unpacked) && unpacked == solutions[0]);
+    // the bits of a cell can hold more than CANDIDATE_SIZE
+    buffer[0] = 0xFF;
+    ASSERT_TRUE(!packed::unpack(buffer, unpacked));
+
+    {
+        packed::Writer writer(packed_path, packed::HAS_SOLUTION);
+        for (unsigned int i = 0; i < puzzles.size(); i++){
+            writer.write(puzzles[i], solutions[i]);
+        }
+    }
+    ASSERT_TRUE(packed::is_packed_file(packed_path));
+    packed::Reader reader(packed_path);
+    ASSERT_TRUE(reader.size() == puzzles.size() && reader.has_solution());
+    bool all_equal = true;
+    for (int i = puzzles.size() - 1; i >= 0; i--){
+        Board solution;
+        reader.load(i, unpacked);
+        reader.load_solution(i, solution);
+        all_equal = all_equal && unpacked == puzzles[i] && solution == solutions[i];
+    }
+    ASSERT_TRUE(all_equal);
+
+    // text -> packed -> text keeps the lines
+    packed::to_text(packed_path, text_path);
+    ASSERT_TRUE(!packed::is_packed_file(text_path));
+    ASSERT_TRUE(packed::from_text(text_path, packed_path) == puzzles.size());
+    packed::Reader reread(packed_path);
+    reread.load(3, unpacked);
+    ASSERT_TRUE(!reread.has_solution() && unpacked == puzzles[3]);
+
+    // the headers that do not match the file are rejected before any record is read
+    auto rejected = [&](const packed::Header& header, const std::string& records){
+        const std::string path = "./output/packed_test_bad.sdkp";
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file << records;
+        }
+        try{
+            packed::Reader bad(path);
+        } catch (std::runtime_error&){
+            return true;
+        }
+        return false;
+    };
+    packed::Header header;
+    {
+        std::ifstream file(packed_path, std::ios::binary);
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    }
+    std::string one_record(packed::BOARD_BYTES, '\0');
+    ASSERT_TRUE(!rejected(header, std::string(packed::BOARD_BYTES * header.n_records, '\0')));
+    packed::Header small = header;
+    small.n_records = 1;
+    small.record_size = 1;
+    ASSERT_TRUE(rejected(small, one_record));
+    packed::Header huge = header;
+    huge.n_records = ~uint64_t(0) / packed::BOARD_BYTES + 2;      // the product wraps around to a small size
+    ASSERT_TRUE(rejected(huge, one_record));
+
+    // a record with a value out of range throws when loaded
+    {
+        std::fstream file(packed_path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(sizeof(packed::Header));
+        file.put(static_cast<char>(0xFF));
+    }
+    packed::Reader corrupted(packed_path);
+    bool thrown = false;
+    try{ corrupted.load(0, unpacked); } catch (std::runtime_error&){ thrown = true; }
+    ASSERT_TRUE(thrown);
+
+    // the write errors are reported
+    thrown = false;
+    try{
+        packed::Writer full("/dev/full");
+        for (unsigned int i = 0; i < 100000; i++) full.write(puzzles[0]);
+        full.close();
+    } catch (std::runtime_error&){ thrown = true; }
+    ASSERT_TRUE(thrown);
+    return testing::exit_code();
+}
@@ -44,9 +44,10 @@ namespace parser{
             m_help_message = help_message;
         }
 
-        inline bool has_subparser(const char* name){
-            if (m_argc < 2) return false;
-            if (std::string(m_argv[1]) == name){ return true; }
+        // level 1 is the command, level 2 is the command of a command, e.g. "db build"
+        inline bool has_subparser(const char* name, int level = 1){
+            if (m_argc < level + 1) return false;
+            if (std::string(m_argv[level]) == name){ return true; }
             else{ return false; }
         }
 
@@ -0,0 +1,292 @@
+#include "puzzle_db.h"
+#include "dataset.h"
+#include "solver.h"
+#include "config.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace db
+{
+    static const char DATA_MAGIC[4] = {'S', 'D', 'K', 'D'};
+    static const char INDEX_MAGIC[4] = {'S', 'D', 'K', 'I'};
+    static const uint32_t DB_VERSION = 1;
+    static const uint32_t RECORD_SIZE = packed::BOARD_BYTES * 2 + sizeof(Grade);
+    static const uint32_t N_SLOTS = (CELL_COUNT + 1) * N_BUCKETS;
+    // the puzzles solved by one task when building
+    static const unsigned int BUILD_CHUNK_SIZE = 256;
+
+    struct FileHeader
+    {
+        char magic[4];
+        uint32_t version;
+        uint32_t board_size;
+        uint32_t record_size;
+        uint32_t n_records;
+        uint32_t reserved[3];
+    };
+    static_assert(sizeof(FileHeader) == 32, "the header should have no padding");
+
+    static FileHeader make_header(const char* magic, uint32_t record_size, uint32_t n_records)
+    {
+        FileHeader header = {};
+        std::memcpy(header.magic, magic, 4);
+        header.version = DB_VERSION;
+        header.board_size = BOARD_SIZE;
+        header.record_size = record_size;
+        header.n_records = n_records;
+        return header;
+    }
+
+    static FileHeader read_header(const util::MappedFile& file, const char* magic, uint32_t record_size)
+    {
+        FileHeader header;
+        if (file.size() < sizeof(FileHeader)){
+            throw std::runtime_error("Invalid puzzle database file");
+        }
+        std::memcpy(&header, file.data(), sizeof(FileHeader));
+        if (std::memcmp(header.magic, magic, 4) != 0 || header.version != DB_VERSION || header.record_size != record_size){
+            throw std::runtime_error("Invalid puzzle database file");
+        }
+        if (header.board_size != BOARD_SIZE){
+            throw std::runtime_error("The puzzle database is for " + std::to_string(header.board_size) + "x" +
+                std::to_string(header.board_size) + " boards, the build is for " + std::to_string(BOARD_SIZE) + "x" + std::to_string(BOARD_SIZE));
+        }
+        return header;
+    }
+
+    unsigned int difficulty_bucket(unsigned int n_guesses)
+    {
+        unsigned int bucket = 0;
+        while (n_guesses > 0 && bucket < N_BUCKETS - 1){
+            n_guesses >>= 1;
+            bucket++;
+        }
+        return bucket;
+    }
+
+    PuzzleDB::PuzzleDB(const std::string& path): m_data(path), m_index(path + ".idx")
+    {
+        FileHeader data_header = read_header(m_data, DATA_MAGIC, RECORD_SIZE);
+        FileHeader index_header = read_header(m_index, INDEX_MAGIC, N_SLOTS);
+        if (index_header.n_records != data_header.n_records){
+            throw std::runtime_error("The index is out of date, rebuild it with: sudoku db build");
+        }
+        if (m_data.size() < sizeof(FileHeader) + uint64_t(data_header.n_records) * RECORD_SIZE ||
+            m_index.size() < sizeof(FileHeader) + (uint64_t(N_SLOTS) * 2 + data_header.n_records) * sizeof(uint32_t)){
+            throw std::runtime_error("Truncated puzzle database file");
+        }
+    }
+
+    uint32_t PuzzleDB::size() const
+    {
+        return reinterpret_cast<const FileHeader*>(m_data.data())->n_records;
+    }
+
+    const uint8_t* PuzzleDB::record(uint32_t id) const
+    {
+        ASSERT(id < size(), "record id out of bounds: " + std::to_string(id));
+        return reinterpret_cast<const uint8_t*>(m_data.data()) + sizeof(FileHeader) + uint64_t(id) * RECORD_SIZE;
+    }
+
+    const uint32_t* PuzzleDB::slot(unsigned int n_clues, unsigned int bucket) const
+    {
+        const uint32_t* slots = reinterpret_cast<const uint32_t*>(m_index.data() + sizeof(FileHeader));
+        return slots + 2 * (n_clues * N_BUCKETS + bucket);
+    }
+
+    const uint32_t* PuzzleDB::ids() const
+    {
+        return reinterpret_cast<const uint32_t*>(m_index.data() + sizeof(FileHeader)) + 2 * N_SLOTS;
+    }
+
+    void PuzzleDB::get(uint32_t id, Entry& entry) const
+    {
+        const uint8_t* rec = record(id);
+        entry.id = id;
+        if (!packed::unpack(rec, entry.puzzle) || !packed::unpack(rec + packed::BOARD_BYTES, entry.solution)){
+            throw std::runtime_error("Invalid database record " + std::to_string(id) + ": a value is out of range");
+        }
+        std::memcpy(&entry.grade, rec + 2 * packed::BOARD_BYTES, sizeof(Grade));
+    }
+
+    uint32_t PuzzleDB::count(int n_clues, int bucket) const
+    {
+        uint32_t total = 0;
+        for (unsigned int c = (n_clues == ANY ? 0 : n_clues); c <= (n_clues == ANY ? CELL_COUNT : static_cast<unsigned int>(n_clues)); c++){
+            for (unsigned int b = (bucket == ANY ? 0 : bucket); b <= (bucket == ANY ? N_BUCKETS - 1 : static_cast<unsigned int>(bucket)); b++){
+                total += slot(c, b)[1];
+            }
+        }
+        return total;
+    }
+
+    bool PuzzleDB::random(int n_clues, int bucket, std::mt19937& rng, Entry& entry) const
+    {
+        if ((n_clues != ANY && (n_clues < 0 || n_clues > static_cast<int>(CELL_COUNT))) ||
+            (bucket != ANY && (bucket < 0 || bucket >= static_cast<int>(N_BUCKETS)))){
+            return false;
+        }
+        uint32_t total = count(n_clues, bucket);
+        if (total == 0) return false;
+        uint32_t k = std::uniform_int_distribution<uint32_t>(0, total - 1)(rng);
+
+        // walk the matching runs to the k-th id, a single lookup for an exact grade
+        for (unsigned int c = (n_clues == ANY ? 0 : n_clues); c <= (n_clues == ANY ? CELL_COUNT : static_cast<unsigned int>(n_clues)); c++){
+            for (unsigned int b = (bucket == ANY ? 0 : bucket); b <= (bucket == ANY ? N_BUCKETS - 1 : static_cast<unsigned int>(bucket)); b++){
+                const uint32_t* run = slot(c, b);
+                if (k < run[1]){
+                    get(ids()[run[0] + k], entry);
+                    return true;
+                }
+                k -= run[1];
+            }
+        }
+        return false;
+    }
+
+    static std::vector<Board> read_dataset(const std::string& dataset_path)
+    {
+        std::vector<Board> puzzles;
+        if (packed::is_packed_file(dataset_path)){
+            packed::Reader reader(dataset_path);
+            puzzles.resize(reader.size());
+            for (uint64_t i = 0; i < reader.size(); i++){
+                reader.load(i, puzzles[i]);
+            }
+            return puzzles;
+        }
+        CompactDataset dataset(dataset_path);
+        Board board;
+        while (dataset.next(board)){
+            puzzles.emplace_back(board);
+        }
+        return puzzles;
+    }
+
+    // counting sort of the record ids by grade, written next to the data file
+    static void write_index(const std::string& path)
+    {
+        util::MappedFile data(path);
+        FileHeader header = read_header(data, DATA_MAGIC, RECORD_SIZE);
+        const uint8_t* records = reinterpret_cast<const uint8_t*>(data.data()) + sizeof(FileHeader);
+
+        std::vector<uint32_t> keys(header.n_records);
+        std::vector<uint32_t> slots(2 * N_SLOTS, 0);
+        for (uint32_t id = 0; id < header.n_records; id++){
+            Grade grade;
+            std::memcpy(&grade, records + uint64_t(id) * RECORD_SIZE + 2 * packed::BOARD_BYTES, sizeof(Grade));
+            keys[id] = grade.n_clues * N_BUCKETS + grade.bucket;
+            slots[2 * keys[id] + 1]++;
+        }
+        uint32_t offset = 0;
+        for (uint32_t k = 0; k < N_SLOTS; k++){
+            slots[2 * k] = offset;
+            offset += slots[2 * k + 1];
+        }
+        std::vector<uint32_t> ids(header.n_records);
+        std::vector<uint32_t> cursor(N_SLOTS);
+        for (uint32_t k = 0; k < N_SLOTS; k++) cursor[k] = slots[2 * k];
+        for (uint32_t id = 0; id < header.n_records; id++){
+            ids[cursor[keys[id]]++] = id;
+        }
+
+        // replace the old index at once, so that a reader never sees a partial one
+        std::string tmp_path = path + ".idx.tmp";
+        {
+            std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()){
+                throw std::runtime_error("Failed to open file: " + tmp_path);
+            }
+            FileHeader index_header = make_header(INDEX_MAGIC, N_SLOTS, header.n_records);
+            file.write(reinterpret_cast<const char*>(&index_header), sizeof(index_header));
+            file.write(reinterpret_cast<const char*>(slots.data()), slots.size() * sizeof(uint32_t));
+            file.write(reinterpret_cast<const char*>(ids.data()), ids.size() * sizeof(uint32_t));
+            if (!file.good()){
+                throw std::runtime_error("Failed to write file: " + tmp_path);
+            }
+        }
+        if (std::rename(tmp_path.c_str(), (path + ".idx").c_str()) != 0){
+            throw std::runtime_error("Failed to replace the index: " + path + ".idx");
+        }
+    }
+
+    uint32_t PuzzleDB::build(const std::string& dataset_path, const std::string& path, unsigned int n_threads)
+    {
+        std::vector<Board> puzzles = read_dataset(dataset_path);
+        std::vector<Board> solutions(puzzles.size());
+        std::vector<Grade> grades(puzzles.size());
+        std::vector<char> solved(puzzles.size(), 0);
+
+        {
+            util::ThreadPool pool(n_threads);
+            for (size_t begin = 0; begin < puzzles.size(); begin += BUILD_CHUNK_SIZE){
+                size_t end = std::min(begin + BUILD_CHUNK_SIZE, puzzles.size());
+                pool.submit([&, begin, end](){
+                    for (size_t i = begin; i < end; i++){
+                        // the solver is large on big boards, keep it off the stack
+                        auto solver = std::unique_ptr<Solver>(new Solver(puzzles[i]));
+                        auto start = std::chrono::high_resolution_clock::now();
+                        bool ok = false;
+                        try{ ok = solver->solve(); } catch (std::exception&){ ok = false; }
+                        auto elapsed = std::chrono::high_resolution_clock::now() - start;
+                        if (!ok || !solver->board().is_solved()) continue;
+
+                        unsigned int n_clues = 0;
+                        for (unsigned int j = 0; j < CELL_COUNT; j++) n_clues += puzzles[i].data()[j] != 0;
+                        unsigned int n_guesses = solver->iteration_counter().n_guesses;
+                        grades[i].n_clues = n_clues;
+                        grades[i].bucket = difficulty_bucket(n_guesses);
+                        grades[i].n_guesses = n_guesses;
+                        grades[i].solve_time_us = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+                        solutions[i].load_data(solver->board());
+                        solved[i] = 1;
+                    }
+                });
+            }
+            pool.wait();
+        }
+
+        // append the records, the count in the header is updated last
+        FileHeader header = make_header(DATA_MAGIC, RECORD_SIZE, 0);
+        {
+            std::ifstream existing(path, std::ios::binary);
+            if (existing.is_open()){
+                existing.close();
+                util::MappedFile data(path);
+                header = read_header(data, DATA_MAGIC, RECORD_SIZE);
+            }
+            else{
+                std::ofstream create(path, std::ios::binary);
+                create.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            }
+        }
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        if (!file.is_open()){
+            throw std::runtime_error("Failed to open file: " + path);
+        }
+        file.seekp(sizeof(FileHeader) + uint64_t(header.n_records) * RECORD_SIZE);
+        uint32_t n_appended = 0;
+        uint8_t buffer[RECORD_SIZE];
+        for (size_t i = 0; i < puzzles.size(); i++){
+            if (!solved[i]) continue;
+            packed::pack(puzzles[i], buffer);
+            packed::pack(solutions[i], buffer + packed::BOARD_BYTES);
+            std::memcpy(buffer + 2 * packed::BOARD_BYTES, &grades[i], sizeof(Grade));
+            file.write(reinterpret_cast<const char*>(buffer), RECORD_SIZE);
+            n_appended++;
+        }
+        header.n_records += n_appended;
+        file.seekp(0);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.close();
+        if (!file){
+            throw std::runtime_error("Failed to write file: " + path);
+        }
+
+        write_index(path);
+        return n_appended;
+    }
+}
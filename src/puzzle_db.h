@@ -0,0 +1,73 @@
+/*
+PuzzleDB is an append-only store of graded puzzles, memory mapped for reading.
+The data file holds a header and fixed-size records: the packed puzzle, the packed solution
+and the grade (clue count, difficulty bucket, number of guesses, solve time).
+The index file (<path>.idx) is derived from the records: for every pair of clue count and
+difficulty bucket, it lists the record ids in a contiguous run, so that a random puzzle
+of a given grade is found with a table lookup, without scanning the records.
+*/
+
+#pragma once
+#include "board.h"
+#include "packed.h"
+#include "util.h"
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace db
+{
+    // bucket 0 is solved without guessing, bucket b > 0 takes [2^(b-1), 2^b) guesses
+    const unsigned int N_BUCKETS = 8;
+    // matches any clue count or bucket in a query
+    const int ANY = -1;
+
+    unsigned int difficulty_bucket(unsigned int n_guesses);
+
+    struct Grade
+    {
+        uint16_t n_clues;
+        uint16_t bucket;
+        uint32_t n_guesses;
+        uint32_t solve_time_us;
+    };
+
+    struct Entry
+    {
+        uint32_t id;
+        Grade grade;
+        Board puzzle;
+        Board solution;
+    };
+
+    class PuzzleDB
+    {
+    public:
+        // throws std::runtime_error if the files are missing or invalid
+        PuzzleDB(const std::string& path);
+
+        uint32_t size() const;
+        void get(uint32_t id, Entry& entry) const;
+        // number of puzzles of the grade, n_clues and bucket may be ANY
+        uint32_t count(int n_clues, int bucket) const;
+        // pick a random puzzle of the grade, returns false if there is none
+        bool random(int n_clues, int bucket, std::mt19937& rng, Entry& entry) const;
+
+        /*
+        Solve and grade the puzzles of a dataset (compact text or packed) on n_threads,
+        append them to the store at path (created if missing) and rebuild the index.
+        Puzzles that can not be solved are skipped. Returns the number of puzzles appended.
+        */
+        static uint32_t build(const std::string& dataset_path, const std::string& path, unsigned int n_threads);
+
+    private:
+        util::MappedFile m_data;
+        util::MappedFile m_index;
+        const uint8_t* record(uint32_t id) const;
+        // the (offset, count) run of ids for one grade
+        const uint32_t* slot(unsigned int n_clues, unsigned int bucket) const;
+        const uint32_t* ids() const;
+    };
+}
@@ -0,0 +1,54 @@
+#include "puzzle_db.h"
+#include "generate.h"
+#include "config.h"
+#include "testing.h"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+int main(){
+    const std::string dataset_path = "./output/puzzle_db_test.txt";
+    const std::string db_path = "./output/puzzle_db_test.sdkdb";
+    std::remove(db_path.c_str());
+
+    const unsigned int n_puzzles = 20;
+    {
+        std::ofstream file(dataset_path, std::ios::trunc);
+        std::atomic_bool stop_flag(false);
+        for (unsigned int i = 0; i < n_puzzles; i++){
+            while (true){
+                auto [generated, board] = gen::try_generate_board(CELL_COUNT / 2 + i % 4, stop_flag);
+                if (!generated) continue;
+                file << board.to_string(BoardFormat::COMPACT);
+                break;
+            }
+        }
+    }
+
+    ASSERT_TRUE(db::difficulty_bucket(0) == 0 && db::difficulty_bucket(1) == 1 && db::difficulty_bucket(5) == 3);
+    ASSERT_TRUE(db::PuzzleDB::build(dataset_path, db_path, 4) == n_puzzles);
+    {
+        db::PuzzleDB database(db_path);
+        ASSERT_TRUE(database.size() == n_puzzles);
+        ASSERT_TRUE(database.count(db::ANY, db::ANY) == n_puzzles);
+        ASSERT_TRUE(database.count(CELL_COUNT / 2, db::ANY) == n_puzzles / 4);
+
+        db::Entry entry;
+        bool matches = true;
+        for (unsigned int i = 0; i < 50; i++){
+            matches = matches && database.random(CELL_COUNT / 2 + 1, db::ANY, util::thread_rng(), entry) &&
+                entry.grade.n_clues == CELL_COUNT / 2 + 1 && entry.solution.is_solved();
+        }
+        ASSERT_TRUE(matches);
+        ASSERT_TRUE(!database.random(CELL_COUNT / 2 - 1, db::ANY, util::thread_rng(), entry));
+    }
+
+    // append only, the ids of the first build are kept
+    ASSERT_TRUE(db::PuzzleDB::build(dataset_path, db_path, 2) == n_puzzles);
+    db::PuzzleDB database(db_path);
+    db::Entry first, appended;
+    database.get(0, first);
+    database.get(n_puzzles, appended);
+    ASSERT_TRUE(database.size() == 2 * n_puzzles && first.puzzle == appended.puzzle);
+    return testing::exit_code();
+}
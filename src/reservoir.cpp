@@ -0,0 +1,201 @@
+#include "reservoir.h"
+#include "generate.h"
+#include "board.h"
+#include "config.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace gen{
+
+    static const char RESERVOIR_MAGIC[4] = {'S', 'D', 'K', 'R'};
+
+    Reservoir::Reservoir(const ReservoirConfig& config):
+    m_config(config), m_stop_flag(false), m_running(false), m_n_hits(0), m_n_misses(0), m_n_generated(0)
+    {
+        ASSERT(m_config.low_watermark <= m_config.high_watermark, "low watermark should not exceed the high watermark");
+        for (auto n_clues: m_config.clue_counts){
+            m_pools[n_clues];
+        }
+    }
+
+    Reservoir::~Reservoir(){ stop(); }
+
+    void Reservoir::start(){
+        if (m_running) return;
+        if (!m_config.persist_path.empty()){
+            load(m_config.persist_path);
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto& [_, pool]: m_pools){
+                pool.refilling = pool.puzzles.size() < m_config.low_watermark;
+            }
+            m_start_time = std::chrono::steady_clock::now();
+        }
+        m_stop_flag.store(false);
+        m_running = true;
+        for (unsigned int i = 0; i < std::max(m_config.n_threads, 1u); i++){
+            m_threads.emplace_back(&Reservoir::worker, this);
+        }
+    }
+
+    void Reservoir::stop(){
+        if (!m_running) return;
+        m_stop_flag.store(true);
+        m_cv.notify_all();
+        for (auto& t: m_threads){
+            t.join();
+        }
+        m_threads.clear();
+        m_running = false;
+        if (!m_config.persist_path.empty()){
+            save(m_config.persist_path);
+        }
+    }
+
+    bool Reservoir::pop(unsigned int n_clues, Board& board){
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_pools.find(n_clues);
+        if (it == m_pools.end() || it->second.puzzles.empty()){
+            m_n_misses++;
+            return false;
+        }
+        Pool& pool = it->second;
+        board.load_data(pool.puzzles.back());
+        pool.puzzles.pop_back();
+        m_n_hits++;
+
+        if (!pool.refilling && pool.puzzles.size() < m_config.low_watermark){
+            pool.refilling = true;
+            m_cv.notify_one();
+        }
+        return true;
+    }
+
+    ReservoirStats Reservoir::stats(){
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ReservoirStats stats;
+        stats.n_hits = m_n_hits;
+        stats.n_misses = m_n_misses;
+        stats.n_generated = m_n_generated;
+        unsigned long n_requests = m_n_hits + m_n_misses;
+        stats.hit_rate = n_requests ? static_cast<double>(m_n_hits) / n_requests : 0;
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start_time).count();
+        stats.refill_rate = (m_running && elapsed > 0) ? m_n_generated / elapsed : 0;
+        for (auto& [n_clues, pool]: m_pools){
+            stats.pool_sizes[n_clues] = pool.puzzles.size();
+        }
+        return stats;
+    }
+
+    bool Reservoir::next_target(unsigned int& n_clues){
+        bool found = false;
+        unsigned int min_size = 0;
+        for (auto& [key, pool]: m_pools){
+            if (!pool.refilling) continue;
+            unsigned int size = pool.puzzles.size() + pool.n_pending;
+            if (size >= m_config.high_watermark) continue;
+            if (!found || size < min_size){
+                found = true;
+                min_size = size;
+                n_clues = key;
+            }
+        }
+        return found;
+    }
+
+    void Reservoir::worker(){
+        #ifdef __linux__
+        // only run when the cpu is otherwise idle, so that refilling never competes with the requests
+        sched_param param{};
+        param.sched_priority = 0;
+        pthread_setschedparam(pthread_self(), SCHED_IDLE, &param);
+        #endif
+
+        while (true){
+            unsigned int n_clues = 0;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, [&](){ return m_stop_flag.load() || next_target(n_clues); });
+                if (m_stop_flag.load()) return;
+                m_pools[n_clues].n_pending++;
+            }
+
+            auto [success, board] = try_generate_board(n_clues, m_stop_flag);
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            Pool& pool = m_pools[n_clues];
+            pool.n_pending--;
+            if (!success) continue;
+            pool.puzzles.push_back(board);
+            m_n_generated++;
+            if (pool.puzzles.size() >= m_config.high_watermark){
+                pool.refilling = false;
+            }
+        }
+    }
+
+    /*
+    File layout: magic, BOARD_SIZE, number of entries,
+    then each entry as the clue count followed by the raw cells
+    */
+    bool Reservoir::save(const std::string& path){
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) return false;
+
+        uint32_t board_size = BOARD_SIZE;
+        uint32_t n_entries = 0;
+        for (auto& [_, pool]: m_pools){ n_entries += pool.puzzles.size(); }
+
+        file.write(RESERVOIR_MAGIC, sizeof(RESERVOIR_MAGIC));
+        file.write(reinterpret_cast<const char*>(&board_size), sizeof(board_size));
+        file.write(reinterpret_cast<const char*>(&n_entries), sizeof(n_entries));
+        for (auto& [n_clues, pool]: m_pools){
+            uint32_t key = n_clues;
+            for (auto& board: pool.puzzles){
+                file.write(reinterpret_cast<const char*>(&key), sizeof(key));
+                file.write(reinterpret_cast<const char*>(board.data()), CELL_COUNT * sizeof(val_t));
+            }
+        }
+        return file.good();
+    }
+
+    bool Reservoir::load(const std::string& path){
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) return false;
+
+        char magic[sizeof(RESERVOIR_MAGIC)];
+        uint32_t board_size = 0;
+        uint32_t n_entries = 0;
+        file.read(magic, sizeof(magic));
+        file.read(reinterpret_cast<char*>(&board_size), sizeof(board_size));
+        file.read(reinterpret_cast<char*>(&n_entries), sizeof(n_entries));
+        if (!file.good() || std::memcmp(magic, RESERVOIR_MAGIC, sizeof(magic)) != 0 || board_size != BOARD_SIZE){
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Board board;
+        for (uint32_t i = 0; i < n_entries; i++){
+            uint32_t n_clues = 0;
+            file.read(reinterpret_cast<char*>(&n_clues), sizeof(n_clues));
+            file.read(reinterpret_cast<char*>(board.data()), CELL_COUNT * sizeof(val_t));
+            if (!file.good()) return false;
+
+            // a corrupt record (out of range, conflicting, or not of the clue count of its pool) is dropped
+            if (!board.is_valid() || count_clues(board) != n_clues) continue;
+            // only keep the targets we are asked for
+            auto it = m_pools.find(n_clues);
+            if (it == m_pools.end() || it->second.puzzles.size() >= m_config.high_watermark) continue;
+            it->second.puzzles.push_back(board);
+        }
+        return true;
+    }
+
+}
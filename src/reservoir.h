@@ -0,0 +1,85 @@
+/*
+The Reservoir keeps pools of ready-made puzzles for a set of clue counts,
+so that a generation request can be served by popping a puzzle instead of generating it.
+Background threads with low priority refill a pool once it drops below the low watermark,
+until it reaches the high watermark.
+*/
+
+#pragma once
+#include "board.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace gen
+{
+    struct ReservoirConfig
+    {
+        std::vector<unsigned int> clue_counts;      // the targets to keep puzzles for
+        unsigned int low_watermark = 4;             // start refilling a pool below this size
+        unsigned int high_watermark = 16;           // stop refilling a pool at this size
+        unsigned int n_threads = 1;                 // number of background generator threads
+        std::string persist_path = "";              // load on start and save on stop, if not empty
+    };
+
+    struct ReservoirStats
+    {
+        unsigned long n_hits;
+        unsigned long n_misses;
+        unsigned long n_generated;                  // puzzles produced by the background threads
+        double hit_rate;                            // n_hits / (n_hits + n_misses)
+        double refill_rate;                         // puzzles produced per second since start
+        std::map<unsigned int, unsigned int> pool_sizes;
+    };
+
+    class Reservoir
+    {
+    public:
+        Reservoir(const ReservoirConfig& config);
+        ~Reservoir();
+
+        void start();
+        void stop();
+        bool running() const { return m_running; }
+
+        // take a ready puzzle, returns false if the pool is empty or the target is not kept
+        bool pop(unsigned int n_clues, Board& board);
+        ReservoirStats stats();
+
+        // the pools are stored as raw boards, so they can only be loaded with the same BOARD_SIZE.
+        // load skips records that are not valid boards with the clue count of their pool
+        bool save(const std::string& path);
+        bool load(const std::string& path);
+
+    private:
+        struct Pool
+        {
+            std::vector<Board> puzzles;
+            unsigned int n_pending = 0;             // puzzles being generated for this pool
+            bool refilling = false;
+        };
+
+        ReservoirConfig m_config;
+        std::map<unsigned int, Pool> m_pools;
+        std::vector<std::thread> m_threads;
+        std::mutex m_mutex;
+        std::condition_variable m_cv;
+        std::atomic_bool m_stop_flag;
+        bool m_running;
+
+        unsigned long m_n_hits;
+        unsigned long m_n_misses;
+        unsigned long m_n_generated;
+        std::chrono::steady_clock::time_point m_start_time;
+
+        void worker();
+        // pick the pool in most need of puzzles, returns false if none needs a refill
+        // should be called with the lock held
+        bool next_target(unsigned int& n_clues);
+    };
+}
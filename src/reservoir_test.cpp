@@ -0,0 +1,93 @@
+#include "reservoir.h"
+#include "bit_search.h"
+#include "config.h"
+#include "testing.h"
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+unsigned int count_clues(const Board& board){
+    unsigned int n = 0;
+    for (unsigned int i = 0; i < CELL_COUNT; i++){
+        n += board.data()[i] != 0;
+    }
+    return n;
+}
+
+int main(){
+    const unsigned int n_clues = CELL_COUNT / 2;
+    const std::string persist_path = "./output/reservoir.bin";
+
+    gen::ReservoirConfig config;
+    config.clue_counts = {n_clues};
+    config.low_watermark = 2;
+    config.high_watermark = 4;
+    config.n_threads = 2;
+
+    gen::Reservoir reservoir(config);
+    reservoir.start();
+    while (reservoir.stats().pool_sizes[n_clues] < config.high_watermark){
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    Board board;
+    ASSERT_TRUE(reservoir.pop(n_clues, board));
+    ASSERT_TRUE(count_clues(board) == n_clues);
+    auto search = std::unique_ptr<BitSearch>(new BitSearch());
+    ASSERT_TRUE(search->count(board, 2) == 1);
+    ASSERT_TRUE(!reservoir.pop(n_clues + 1, board));
+
+    auto stats = reservoir.stats();
+    ASSERT_TRUE(stats.n_hits == 1 && stats.n_misses == 1);
+    ASSERT_TRUE(stats.n_generated >= config.high_watermark);
+    std::cout << "Hit rate: " << stats.hit_rate << ", refill rate: " << stats.refill_rate << " [puzzles/s]" << std::endl;
+
+    reservoir.stop();
+    ASSERT_TRUE(reservoir.save(persist_path));
+
+    // warm start from the saved pool
+    gen::Reservoir warm(config);
+    ASSERT_TRUE(warm.load(persist_path));
+    ASSERT_TRUE(warm.stats().pool_sizes[n_clues] == reservoir.stats().pool_sizes[n_clues]);
+    ASSERT_TRUE(warm.pop(n_clues, board));
+    ASSERT_TRUE(count_clues(board) == n_clues);
+
+    // corrupt records are dropped on load
+    Board out_of_range = board, miscounted = board, conflicting = board;
+    unsigned int first = 0;
+    while (board.data()[first] == 0) first++;
+    out_of_range.data()[first] = BOARD_SIZE + 1;
+    miscounted.data()[first] = 0;
+    for (unsigned int row = 0; row < BOARD_SIZE; row++){
+        // copy a clue over another clue of the same row, keeping the clue count
+        unsigned int a = CELL_COUNT, b = CELL_COUNT;
+        for (unsigned int col = 0; col < BOARD_SIZE; col++){
+            if (board.get(row, col) == 0) continue;
+            if (a == CELL_COUNT) a = col;
+            else if (b == CELL_COUNT) b = col;
+        }
+        if (b == CELL_COUNT) continue;
+        conflicting.set(row, b, board.get(row, a));
+        break;
+    }
+    const std::string corrupt_path = "./output/reservoir_corrupt.bin";
+    {
+        std::vector<Board> records = {board, out_of_range, miscounted, conflicting};
+        std::ofstream file(corrupt_path, std::ios::binary | std::ios::trunc);
+        uint32_t board_size = BOARD_SIZE, n_entries = records.size(), key = n_clues;
+        file.write("SDKR", 4);
+        file.write(reinterpret_cast<const char*>(&board_size), sizeof(board_size));
+        file.write(reinterpret_cast<const char*>(&n_entries), sizeof(n_entries));
+        for (auto& record: records){
+            file.write(reinterpret_cast<const char*>(&key), sizeof(key));
+            file.write(reinterpret_cast<const char*>(record.data()), CELL_COUNT * sizeof(val_t));
+        }
+    }
+    gen::Reservoir checked(config);
+    ASSERT_TRUE(checked.load(corrupt_path));
+    ASSERT_TRUE(checked.stats().pool_sizes[n_clues] == 1);
+    return testing::exit_code();
+}
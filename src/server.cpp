@@ -0,0 +1,473 @@
+#include "server.h"
+#include "board.h"
+#include "bit_search.h"
+#include "dataset.h"
+#include "generate.h"
+#include "solver.h"
+#include "util.h"
+#include "config.h"
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#ifndef _WIN32
+#include <arpa/inet.h>
+#include <csignal>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace server
+{
+    // the number of recent requests the latency percentiles are computed on
+    static const unsigned int LATENCY_WINDOW = 4096;
+    static const unsigned long DEFAULT_COUNT_LIMIT = 2;
+    static const unsigned long MAX_COUNT_LIMIT = 1000000;
+
+    static std::string compact_string(const Board& board)
+    {
+        char buffer[Board::max_serialized_size(BoardFormat::COMPACT)];
+        // without the trailing newline
+        return std::string(buffer, board.serialize(buffer, BoardFormat::COMPACT) - 1);
+    }
+
+    static bool decode_board(const std::string& token, Board& board)
+    {
+        return token.size() == CELL_COUNT && CompactDataset::decode(token.data(), board) && board.is_valid();
+    }
+
+    Server::Server(const ServerConfig& config):
+    m_config(config), m_stop(false), m_listen_fd(-1), m_wake_pipe{-1, -1},
+    m_n_requests(0), m_n_timeouts(0), m_n_errors(0), m_latencies_us(LATENCY_WINDOW, 0), m_latency_cursor(0)
+    {
+        ASSERT(m_config.max_generate_ms > 0, "generate requests need a deadline");
+        ASSERT(m_config.max_generate_retries > 0, "generate requests need at least one attempt");
+        m_start_time = std::chrono::steady_clock::now();
+    }
+
+    std::string Server::handle(const std::string& request, std::chrono::steady_clock::time_point received)
+    {
+        std::istringstream iss(request);
+        std::string id, command;
+        iss >> id >> command;
+        if (id.empty() || command.empty()){
+            record(std::chrono::steady_clock::now() - received, "error");
+            return (id.empty() ? "-" : id) + " error malformed request";
+        }
+        if (command == "stats"){
+            return id + " ok " + stats();
+        }
+
+        // positional arguments, then key=value options
+        std::vector<std::string> args;
+        long deadline_ms = m_config.default_deadline_ms;
+        unsigned long limit = DEFAULT_COUNT_LIMIT;
+        std::string status = "error";
+        std::string body;
+        try{
+            for (std::string token; iss >> token;){
+                if (token.rfind("deadline_ms=", 0) == 0) deadline_ms = std::stol(token.substr(12));
+                else if (token.rfind("limit=", 0) == 0) limit = std::min(std::stoul(token.substr(6)), MAX_COUNT_LIMIT);
+                else args.push_back(token);
+            }
+
+            auto deadline = received + std::chrono::milliseconds(deadline_ms);
+            auto expired = [&](){ return deadline_ms > 0 && std::chrono::steady_clock::now() > deadline; };
+            Board board;
+
+            if (expired()){
+                // spent the time in the queue
+                status = "timeout";
+            }
+            else if (command == "solve"){
+                if (args.size() != 1 || !decode_board(args[0], board)){
+                    status = "invalid";
+                }
+                else{
+                    // the solver of each thread is allocated once, and reset for every request
+                    static thread_local std::unique_ptr<Solver> solver;
+                    if (!solver) solver.reset(new Solver(board));
+                    else solver->reset(board);
+                    // the solver stops by itself at the deadline, instead of finishing late
+                    SolveLimits limits;
+                    limits.has_deadline = deadline_ms > 0;
+                    limits.deadline = deadline;
+                    SolveStatus solve_status = solver->solve(limits);
+                    bool solved = solve_status == SolveStatus::SOLVED;
+                    status = solve_status == SolveStatus::TIMEOUT || expired() ? "timeout" : (solved ? "ok" : "unsolved");
+                    if (status != "timeout") body = compact_string(solved ? solver->board() : board);
+                }
+            }
+            else if (command == "count"){
+                if (args.size() != 1 || !decode_board(args[0], board)){
+                    status = "invalid";
+                }
+                else{
+                    static thread_local std::unique_ptr<BitSearch> search;
+                    if (!search) search.reset(new BitSearch());
+                    // the count stops by itself at the deadline, as the solver
+                    std::function<bool()> should_stop;
+                    if (deadline_ms > 0) should_stop = expired;
+                    unsigned long n = search->count(board, std::max(limit, 1ul), should_stop);
+                    status = search->interrupted() || expired() ? "timeout" : "ok";
+                    if (status == "ok") body = std::to_string(n);
+                }
+            }
+            else if (command == "generate"){
+                int n_clues = args.size() == 1 ? std::stoi(args[0]) : -1;
+                if (n_clues < static_cast<int>(gen::MIN_CLUES) || n_clues > static_cast<int>(CELL_COUNT)){
+                    status = "invalid";
+                }
+                else{
+                    // anytime generation, the best board found is returned when the deadline is hit.
+                    // the server caps every generate request, with or without a deadline of its own
+                    auto generate_deadline = received + std::chrono::milliseconds(m_config.max_generate_ms);
+                    if (deadline_ms > 0) generate_deadline = std::min(generate_deadline, deadline);
+                    double timeout = std::max(std::chrono::duration<double>(generate_deadline - std::chrono::steady_clock::now()).count(), 1e-6);
+                    auto [exact, generated, n_best] = gen::generate_board(n_clues, m_config.max_generate_retries, false, false, timeout);
+                    if (n_best > 0){
+                        status = exact ? "ok" : "timeout";
+                        body = compact_string(generated) + " clues=" + std::to_string(n_best);
+                    }
+                    else{
+                        body = "failed to generate";
+                    }
+                }
+            }
+            else{
+                body = "unknown command: " + command;
+            }
+        } catch (std::exception& e){
+            status = "error";
+            body = e.what();
+        }
+
+        record(std::chrono::steady_clock::now() - received, status);
+        return id + " " + status + (body.empty() ? "" : " " + body);
+    }
+
+    void Server::record(std::chrono::steady_clock::duration latency, const std::string& status)
+    {
+        std::lock_guard<std::mutex> lock(m_stats_mutex);
+        m_n_requests++;
+        if (status == "timeout") m_n_timeouts++;
+        if (status == "error") m_n_errors++;
+        m_latencies_us[m_latency_cursor++ % LATENCY_WINDOW] =
+            static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+    }
+
+    std::string Server::stats()
+    {
+        std::vector<uint32_t> latencies;
+        std::ostringstream oss;
+        {
+            std::lock_guard<std::mutex> lock(m_stats_mutex);
+            double uptime = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start_time).count();
+            oss << "requests=" << m_n_requests << " timeouts=" << m_n_timeouts << " errors=" << m_n_errors
+                << " uptime_s=" << static_cast<unsigned long>(uptime)
+                << " throughput=" << static_cast<unsigned long>(uptime > 0 ? m_n_requests / uptime : 0);
+            latencies.assign(m_latencies_us.begin(), m_latencies_us.begin() + std::min<unsigned long>(m_latency_cursor, LATENCY_WINDOW));
+        }
+        std::sort(latencies.begin(), latencies.end());
+        auto percentile = [&latencies](double p)->uint32_t{
+            if (latencies.empty()) return 0;
+            return latencies[std::min<size_t>(latencies.size() * p, latencies.size() - 1)];
+        };
+        oss << " p50_us=" << percentile(0.5) << " p90_us=" << percentile(0.9) << " p99_us=" << percentile(0.99)
+            << " max_us=" << (latencies.empty() ? 0 : latencies.back());
+        return oss.str();
+    }
+
+#ifndef _WIN32
+
+    static void set_nonblocking(int fd)
+    {
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    }
+
+    static std::string make_frame(const std::string& payload)
+    {
+        uint32_t size = payload.size();
+        uint8_t header[4] = {uint8_t(size), uint8_t(size >> 8), uint8_t(size >> 16), uint8_t(size >> 24)};
+        return std::string(reinterpret_cast<char*>(header), 4) + payload;
+    }
+
+    static uint32_t frame_size(const char* header)
+    {
+        const uint8_t* h = reinterpret_cast<const uint8_t*>(header);
+        return h[0] | (h[1] << 8) | (h[2] << 16) | (uint32_t(h[3]) << 24);
+    }
+
+    Server::~Server()
+    {
+        if (m_listen_fd >= 0) close(m_listen_fd);
+        if (m_wake_pipe[0] >= 0) close(m_wake_pipe[0]);
+        if (m_wake_pipe[1] >= 0) close(m_wake_pipe[1]);
+    }
+
+    void Server::open_socket()
+    {
+        if (!m_config.socket_path.empty()){
+            sockaddr_un addr{};
+            addr.sun_family = AF_UNIX;
+            if (m_config.socket_path.size() >= sizeof(addr.sun_path)){
+                throw std::runtime_error("Socket path too long: " + m_config.socket_path);
+            }
+            std::strncpy(addr.sun_path, m_config.socket_path.c_str(), sizeof(addr.sun_path) - 1);
+            m_listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+            unlink(m_config.socket_path.c_str());
+            if (m_listen_fd < 0 || bind(m_listen_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0){
+                throw std::runtime_error("Failed to bind socket: " + m_config.socket_path);
+            }
+        }
+        else{
+            sockaddr_in addr{};
+            addr.sin_family = AF_INET;
+            addr.sin_port = htons(m_config.port);
+            addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            m_listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+            int reuse = 1;
+            if (m_listen_fd >= 0) setsockopt(m_listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+            if (m_listen_fd < 0 || bind(m_listen_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0){
+                throw std::runtime_error("Failed to bind port: " + std::to_string(m_config.port));
+            }
+        }
+        if (listen(m_listen_fd, 128) != 0){
+            throw std::runtime_error("Failed to listen on the socket");
+        }
+        set_nonblocking(m_listen_fd);
+    }
+
+    void Server::wake()
+    {
+        char c = 1;
+        // the pipe is non-blocking, a full pipe already wakes the loop
+        ssize_t ret = write(m_wake_pipe[1], &c, 1);
+        (void)ret;
+    }
+
+    void Server::stop()
+    {
+        m_stop.store(true);
+        if (m_wake_pipe[1] >= 0) wake();
+    }
+
+    void Server::run()
+    {
+        struct Connection
+        {
+            int fd;
+            std::string in;
+            std::mutex mtx;
+            std::string out;        // frames waiting to be sent, guarded by mtx
+            unsigned int n_pending = 0;     // requests dispatched and not answered yet, guarded by mtx
+            bool read_closed = false;       // the peer shut its side down, the responses are still sent
+            bool closed = false;
+        };
+
+        std::signal(SIGPIPE, SIG_IGN);
+        if (pipe(m_wake_pipe) != 0){
+            throw std::runtime_error("Failed to create the wake pipe");
+        }
+        set_nonblocking(m_wake_pipe[0]);
+        set_nonblocking(m_wake_pipe[1]);
+        open_socket();
+        m_start_time = std::chrono::steady_clock::now();
+
+        std::vector<std::shared_ptr<Connection>> connections;
+        util::ThreadPool pool(m_config.n_threads);
+        std::vector<pollfd> fds;
+        char buffer[65536];
+
+        auto flush = [](Connection& conn){
+            std::lock_guard<std::mutex> lock(conn.mtx);
+            size_t sent = 0;
+            while (sent < conn.out.size()){
+                ssize_t n = write(conn.fd, conn.out.data() + sent, conn.out.size() - sent);
+                if (n > 0){ sent += n; continue; }
+                if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) break;
+                conn.closed = true;
+                break;
+            }
+            conn.out.erase(0, sent);
+        };
+
+        while (!m_stop.load()){
+            fds.clear();
+            fds.push_back({m_wake_pipe[0], POLLIN, 0});
+            fds.push_back({m_listen_fd, POLLIN, 0});
+            for (auto& conn: connections){
+                std::lock_guard<std::mutex> lock(conn->mtx);
+                fds.push_back({conn->fd, static_cast<short>((conn->read_closed ? 0 : POLLIN) | (conn->out.empty() ? 0 : POLLOUT)), 0});
+            }
+            if (poll(fds.data(), fds.size(), -1) < 0){
+                if (errno == EINTR) continue;
+                throw std::runtime_error("Failed to poll the sockets");
+            }
+
+            if (fds[0].revents & POLLIN){
+                while (read(m_wake_pipe[0], buffer, sizeof(buffer)) > 0){}
+            }
+
+            for (size_t i = 0; i < connections.size(); i++){
+                Connection& conn = *connections[i];
+                short revents = fds[i + 2].revents;
+                if (revents & POLLIN){
+                    while (true){
+                        ssize_t n = read(conn.fd, buffer, sizeof(buffer));
+                        if (n > 0){ conn.in.append(buffer, n); continue; }
+                        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) break;
+                        // at the end of the stream the connection stays open until the responses are sent
+                        if (n == 0) conn.read_closed = true;
+                        else conn.closed = true;
+                        break;
+                    }
+                    // dispatch the complete frames, the remainder waits for more data
+                    size_t offset = 0;
+                    while (conn.in.size() - offset >= 4){
+                        uint32_t size = frame_size(conn.in.data() + offset);
+                        if (size > MAX_FRAME_SIZE){ conn.closed = true; break; }
+                        if (conn.in.size() - offset < 4 + size) break;
+                        std::string payload = conn.in.substr(offset + 4, size);
+                        offset += 4 + size;
+                        auto received = std::chrono::steady_clock::now();
+                        auto target = connections[i];
+                        {
+                            std::lock_guard<std::mutex> lock(conn.mtx);
+                            conn.n_pending++;
+                        }
+                        pool.submit([this, target, payload, received](){
+                            std::string frame = make_frame(handle(payload, received));
+                            {
+                                std::lock_guard<std::mutex> lock(target->mtx);
+                                target->out += frame;
+                                target->n_pending--;
+                            }
+                            wake();
+                        });
+                    }
+                    conn.in.erase(0, offset);
+                }
+                else if (revents & (POLLERR | POLLHUP | POLLNVAL)){
+                    conn.closed = true;
+                }
+                if (!conn.closed) flush(conn);
+                if (conn.read_closed && !conn.closed){
+                    std::lock_guard<std::mutex> lock(conn.mtx);
+                    conn.closed = conn.n_pending == 0 && conn.out.empty();
+                }
+            }
+
+            // the pending tasks keep their connection alive, their responses are dropped
+            for (size_t i = connections.size(); i-- > 0;){
+                if (!connections[i]->closed) continue;
+                close(connections[i]->fd);
+                connections.erase(connections.begin() + i);
+            }
+
+            if (fds[1].revents & POLLIN){
+                while (true){
+                    int fd = accept(m_listen_fd, nullptr, nullptr);
+                    if (fd < 0) break;
+                    set_nonblocking(fd);
+                    if (m_config.socket_path.empty()){
+                        int flag = 1;
+                        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+                    }
+                    auto conn = std::make_shared<Connection>();
+                    conn->fd = fd;
+                    connections.push_back(conn);
+                }
+            }
+        }
+
+        pool.wait();
+        for (auto& conn: connections){
+            close(conn->fd);
+        }
+        close(m_listen_fd);
+        m_listen_fd = -1;
+        if (!m_config.socket_path.empty()) unlink(m_config.socket_path.c_str());
+    }
+
+    bool write_frame(int fd, const std::string& payload)
+    {
+        std::string frame = make_frame(payload);
+        size_t sent = 0;
+        while (sent < frame.size()){
+            ssize_t n = write(fd, frame.data() + sent, frame.size() - sent);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) return false;
+            sent += n;
+        }
+        return true;
+    }
+
+    static bool read_exact(int fd, char* buffer, size_t size)
+    {
+        size_t got = 0;
+        while (got < size){
+            ssize_t n = read(fd, buffer + got, size - got);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) return false;
+            got += n;
+        }
+        return true;
+    }
+
+    bool read_frame(int fd, std::string& payload)
+    {
+        char header[4];
+        if (!read_exact(fd, header, 4)) return false;
+        uint32_t size = frame_size(header);
+        if (size > MAX_FRAME_SIZE) return false;
+        payload.resize(size);
+        return read_exact(fd, &payload[0], size);
+    }
+
+    int connect_to(const std::string& socket_path, unsigned int port)
+    {
+        int fd = -1;
+        if (!socket_path.empty()){
+            sockaddr_un addr{};
+            addr.sun_family = AF_UNIX;
+            std::strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+            fd = socket(AF_UNIX, SOCK_STREAM, 0);
+            if (fd >= 0 && connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0) return fd;
+        }
+        else{
+            sockaddr_in addr{};
+            addr.sin_family = AF_INET;
+            addr.sin_port = htons(port);
+            addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            fd = socket(AF_INET, SOCK_STREAM, 0);
+            if (fd >= 0 && connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0){
+                int flag = 1;
+                setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+                return fd;
+            }
+        }
+        if (fd >= 0) close(fd);
+        return -1;
+    }
+
+#else
+
+    Server::~Server() {}
+    void Server::open_socket() { throw std::runtime_error("serve is not supported on this platform"); }
+    void Server::wake() {}
+    void Server::stop() { m_stop.store(true); }
+    void Server::run() { open_socket(); }
+    bool write_frame(int, const std::string&) { return false; }
+    bool read_frame(int, std::string&) { return false; }
+    int connect_to(const std::string&, unsigned int) { return -1; }
+
+#endif
+}
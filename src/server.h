@@ -0,0 +1,84 @@
+/*
+A long-running solver service over a Unix domain socket or localhost TCP.
+
+Every message is a frame: the payload length as a 4 bytes little-endian integer, then the payload.
+A request payload is a line of whitespace separated tokens, starting with a request id
+chosen by the client, then the command, its arguments and optional key=value options:
+    <id> solve <compact board> [deadline_ms=<ms>]
+    <id> generate <n_clues> [deadline_ms=<ms>]
+    <id> count <compact board> [limit=<n>] [deadline_ms=<ms>]
+    <id> stats
+A response payload is "<id> <status> [body]", with the status one of
+ok, unsolved, invalid, timeout or error. Requests can be pipelined on a connection,
+the responses are sent as they finish, matched to the requests by id.
+A client can shut its side of the connection down after the last request,
+the responses still in flight are sent before the server closes it.
+A deadline stops solve and count where they are, generate returns the best board found.
+A generate request is capped by the deadline and the retries of the server configuration,
+and asks for at least gen::MIN_CLUES clues.
+*/
+
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace server
+{
+    // frames larger than this close the connection
+    const uint32_t MAX_FRAME_SIZE = 1 << 20;
+
+    struct ServerConfig
+    {
+        std::string socket_path = "";           // listen on a Unix domain socket if not empty
+        unsigned int port = 0;                  // otherwise on 127.0.0.1:port
+        unsigned int n_threads = 1;             // solver threads
+        unsigned int default_deadline_ms = 0;   // for the requests without one, 0 for no deadline
+        unsigned int max_generate_ms = 1000;    // generate requests always stop by this deadline, at least 1
+        unsigned int max_generate_retries = 64; // generation attempts of a generate request
+    };
+
+    class Server
+    {
+    public:
+        Server(const ServerConfig& config);
+        ~Server();
+
+        // serve until stop() is called, throws std::runtime_error if the socket can not be opened
+        void run();
+        // safe to call from a signal handler
+        void stop();
+
+        // process one request payload, received at the given time, returns the response payload
+        std::string handle(const std::string& request, std::chrono::steady_clock::time_point received);
+
+    private:
+        ServerConfig m_config;
+        std::atomic_bool m_stop;
+        int m_listen_fd;
+        int m_wake_pipe[2];
+
+        // counters and the recent latencies for the stats command
+        std::mutex m_stats_mutex;
+        std::chrono::steady_clock::time_point m_start_time;
+        unsigned long m_n_requests;
+        unsigned long m_n_timeouts;
+        unsigned long m_n_errors;
+        std::vector<uint32_t> m_latencies_us;   // a ring of the last LATENCY_WINDOW requests
+        unsigned long m_latency_cursor;
+
+        void open_socket();
+        void wake();
+        void record(std::chrono::steady_clock::duration latency, const std::string& status);
+        std::string stats();
+    };
+
+    // blocking frame I/O and connection helpers, for the clients
+    bool write_frame(int fd, const std::string& payload);
+    bool read_frame(int fd, std::string& payload);
+    // connect to the socket path if not empty, otherwise to 127.0.0.1:port, returns -1 on failure
+    int connect_to(const std::string& socket_path, unsigned int port);
+}
@@ -0,0 +1,100 @@
+#include "server.h"
+#include "config.h"
+#include "generate.h"
+#include "testing.h"
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+bool starts_with(const std::string& str, const std::string& prefix){
+    return str.rfind(prefix, 0) == 0;
+}
+
+int main(){
+    server::ServerConfig config;
+    server::Server srv(config);
+    auto now = std::chrono::steady_clock::now;
+
+    std::string empty(CELL_COUNT, '.');
+    std::string response = srv.handle("1 solve " + empty, now());
+    ASSERT_TRUE(starts_with(response, "1 ok ") && response.find('.') == std::string::npos);
+    // the solver of the thread is reused for the next request
+    ASSERT_TRUE(starts_with(srv.handle("2 solve " + empty, now()), "2 ok "));
+
+    ASSERT_TRUE(srv.handle("3 count " + empty + " limit=3", now()) == "3 ok 3");
+    std::string duplicated = empty;
+    duplicated[0] = duplicated[1] = '1';
+    ASSERT_TRUE(srv.handle("4 solve " + duplicated, now()) == "4 invalid");
+    ASSERT_TRUE(srv.handle("5 solve 123", now()) == "5 invalid");
+    ASSERT_TRUE(starts_with(srv.handle("6 unknown", now()), "6 error"));
+
+    // a request that waited longer than its deadline is not processed
+    auto received = now() - std::chrono::milliseconds(50);
+    ASSERT_TRUE(srv.handle("7 solve " + empty + " deadline_ms=10", received) == "7 timeout");
+
+    response = srv.handle("8 stats", now());
+    ASSERT_TRUE(starts_with(response, "8 ok requests=7 timeouts=1 errors=1"));
+
+    // a count stops at its deadline, instead of finishing late
+    auto start = now();
+    ASSERT_TRUE(srv.handle("9 count " + empty + " limit=1000000 deadline_ms=1", now()) == "9 timeout");
+    ASSERT_TRUE(now() - start < std::chrono::milliseconds(500));
+
+    // generate asks for at least the minimum clue count, and is capped by the server without a deadline
+    ASSERT_TRUE(srv.handle("10 generate " + std::to_string(gen::MIN_CLUES - 1), now()) == "10 invalid");
+    server::ServerConfig capped_config;
+    capped_config.max_generate_ms = 50;
+    server::Server capped_srv(capped_config);
+    start = now();
+    response = capped_srv.handle("11 generate " + std::to_string(gen::MIN_CLUES), now());
+    ASSERT_TRUE(starts_with(response, "11 ok ") || starts_with(response, "11 timeout ") || response == "11 error failed to generate");
+    ASSERT_TRUE(now() - start < std::chrono::milliseconds(2000));
+
+#ifndef _WIN32
+    // over a socket
+    server::ServerConfig socket_config;
+    socket_config.socket_path = "output/server_test.sock";
+    socket_config.n_threads = 2;
+    server::Server socket_srv(socket_config);
+    std::thread serving([&](){ socket_srv.run(); });
+    int fd = -1;
+    for (unsigned int t = 0; t < 500 && fd < 0; t++){
+        fd = server::connect_to(socket_config.socket_path, 0);
+        if (fd < 0) std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_TRUE(fd >= 0);
+
+    // a frame split across writes, in the middle of the length
+    std::string request = "10 solve " + empty;
+    std::string frame = std::string(1, char(request.size())) + char(request.size() >> 8) + char(0) + char(0) + request;
+    ASSERT_TRUE(write(fd, frame.data(), 2) == 2);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_TRUE(write(fd, frame.data() + 2, frame.size() - 2) == static_cast<ssize_t>(frame.size() - 2));
+    ASSERT_TRUE(server::read_frame(fd, response) && starts_with(response, "10 ok "));
+
+    // pipelined requests are all answered, matched by id, then the client shuts its side down
+    // and the responses in flight are still sent before the server closes the connection
+    std::vector<std::string> ids;
+    for (unsigned int i = 11; i < 17; i++){
+        ASSERT_TRUE(server::write_frame(fd, std::to_string(i) + " count " + empty + " limit=20000"));
+    }
+    shutdown(fd, SHUT_WR);
+    while (server::read_frame(fd, response)){
+        ASSERT_TRUE(response.find(" ok 20000") != std::string::npos);
+        ids.push_back(response.substr(0, response.find(' ')));
+    }
+    std::sort(ids.begin(), ids.end());
+    ASSERT_TRUE(ids == std::vector<std::string>({"11", "12", "13", "14", "15", "16"}));
+    close(fd);
+
+    socket_srv.stop();
+    serving.join();
+#endif
+    return testing::exit_code();
+}
@@ -0,0 +1,207 @@
+#include "session.h"
+#include "util.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string>
+
+const char* hint_name(HintType type)
+{
+    switch (type){
+        case HintType::NAKED_SINGLE: return "naked_single";
+        case HintType::HIDDEN_SINGLE_ROW: return "hidden_single_row";
+        case HintType::HIDDEN_SINGLE_COL: return "hidden_single_col";
+        case HintType::HIDDEN_SINGLE_GRID: return "hidden_single_grid";
+        case HintType::CONTRADICTION: return "contradiction";
+        default: return "none";
+    }
+}
+
+SolverSession::SolverSession(const Board& board):
+    m_n_conflicts(0), m_n_filled(0), m_solvable(-1), m_search(new BitSearch())
+{
+    std::memset(m_cells, 0, sizeof(m_cells));
+    std::memset(m_count, 0, sizeof(m_count));
+    std::memset(m_used, 0, sizeof(m_used));
+    const val_t* data = board.data();
+    for (unsigned int i = 0; i < CELL_COUNT; i++){
+        if (data[i] > CANDIDATE_SIZE){
+            throw std::out_of_range("Value out of range: " + std::to_string(data[i]));
+        }
+        m_given[i] = data[i] != 0;
+        if (data[i]) update_units(i / BOARD_SIZE, i % BOARD_SIZE, data[i], true);
+    }
+}
+
+unsigned int SolverSession::unit_of(unsigned int type, unsigned int row, unsigned int col)
+{
+    switch (type){
+        case 0: return row;
+        case 1: return col;
+        default: return (row / GRID_SIZE) * GRID_SIZE + col / GRID_SIZE;
+    }
+}
+
+void SolverSession::update_units(unsigned int row, unsigned int col, val_t value, bool add)
+{
+    unsigned int v_idx = value - 1;
+    for (unsigned int type = 0; type < 3; type++){
+        unsigned int unit = unit_of(type, row, col);
+        uint8_t& count = m_count[type][unit][v_idx];
+        if (add){
+            if (++count == 2) m_n_conflicts++;
+            m_used[type][unit] |= mask_t(1) << v_idx;
+        }
+        else{
+            if (count-- == 2) m_n_conflicts--;
+            if (count == 0) m_used[type][unit] &= ~(mask_t(1) << v_idx);
+        }
+    }
+    m_cells[row * BOARD_SIZE + col] = add ? value : 0;
+    if (add) m_n_filled++;
+    else m_n_filled--;
+    m_solvable = -1;
+}
+
+void SolverSession::check(unsigned int row, unsigned int col) const
+{
+    if (row >= BOARD_SIZE || col >= BOARD_SIZE){
+        throw std::out_of_range("Cell out of range: " + std::to_string(row) + ", " + std::to_string(col));
+    }
+    if (m_given[row * BOARD_SIZE + col]){
+        throw std::runtime_error("Can not change a given cell: " + std::to_string(row) + ", " + std::to_string(col));
+    }
+}
+
+void SolverSession::place(unsigned int row, unsigned int col, val_t value)
+{
+    check(row, col);
+    if (value > CANDIDATE_SIZE){
+        throw std::out_of_range("Value out of range: " + std::to_string(value));
+    }
+    val_t current = get(row, col);
+    if (current == value) return;
+    if (current) update_units(row, col, current, false);
+    if (value) update_units(row, col, value, true);
+}
+
+void SolverSession::erase(unsigned int row, unsigned int col)
+{
+    place(row, col, 0);
+}
+
+mask_t SolverSession::candidates(unsigned int row, unsigned int col) const
+{
+    if (get(row, col)) return 0;
+    mask_t used = m_used[0][row] | m_used[1][col] | m_used[2][unit_of(2, row, col)];
+    return FULL_MASK & ~used;
+}
+
+bool SolverSession::conflicts(unsigned int row, unsigned int col) const
+{
+    val_t value = get(row, col);
+    if (!value) return false;
+    for (unsigned int type = 0; type < 3; type++){
+        if (m_count[type][unit_of(type, row, col)][value - 1] > 1) return true;
+    }
+    return false;
+}
+
+Solvability SolverSession::is_solvable(double timeout)
+{
+    if (m_solvable < 0){
+        if (m_n_conflicts > 0){
+            m_solvable = 0;
+        }
+        else{
+            Board board;
+            to_board(board);
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(std::max(timeout, 0.0)));
+            std::function<bool()> expired = nullptr;
+            if (timeout > 0) expired = [deadline](){ return std::chrono::steady_clock::now() > deadline; };
+            unsigned long n_solutions = m_search->count(board, 1, expired);
+            if (n_solutions > 0) m_solvable = 1;
+            else if (!m_search->interrupted()) m_solvable = 0;
+            else return Solvability::UNKNOWN;
+        }
+    }
+    return m_solvable == 1 ? Solvability::SOLVABLE : Solvability::UNSOLVABLE;
+}
+
+Hint SolverSession::next_deduction() const
+{
+    Hint hint;
+    if (m_n_conflicts > 0){
+        hint.type = HintType::CONTRADICTION;
+        for (unsigned int i = 0; i < CELL_COUNT; i++){
+            if (conflicts(i / BOARD_SIZE, i % BOARD_SIZE)){
+                hint.row = i / BOARD_SIZE;
+                hint.col = i % BOARD_SIZE;
+                hint.value = m_cells[i];
+                break;
+            }
+        }
+        return hint;
+    }
+
+    // naked singles, and the empty cells without candidate
+    for (unsigned int row = 0; row < BOARD_SIZE; row++){
+        for (unsigned int col = 0; col < BOARD_SIZE; col++){
+            if (get(row, col)) continue;
+            mask_t cands = candidates(row, col);
+            if (cands == 0 || util::popcount(cands) == 1){
+                hint.type = cands ? HintType::NAKED_SINGLE : HintType::CONTRADICTION;
+                hint.row = row;
+                hint.col = col;
+                hint.value = cands ? util::count_trailing_zeros(cands) + 1 : 0;
+                return hint;
+            }
+        }
+    }
+
+    // hidden singles, and the values without a place in a unit
+    const HintType types[3] = {HintType::HIDDEN_SINGLE_ROW, HintType::HIDDEN_SINGLE_COL, HintType::HIDDEN_SINGLE_GRID};
+    for (unsigned int type = 0; type < 3; type++){
+        for (unsigned int unit = 0; unit < BOARD_SIZE; unit++){
+            // the cells of the unit, and the union of the candidates seen once / more than once
+            mask_t once = 0, twice = 0;
+            unsigned int rows[BOARD_SIZE], cols[BOARD_SIZE];
+            for (unsigned int k = 0; k < BOARD_SIZE; k++){
+                rows[k] = type == 0 ? unit : (type == 1 ? k : (unit / GRID_SIZE) * GRID_SIZE + k / GRID_SIZE);
+                cols[k] = type == 0 ? k : (type == 1 ? unit : (unit % GRID_SIZE) * GRID_SIZE + k % GRID_SIZE);
+                mask_t cands = candidates(rows[k], cols[k]);
+                twice |= once & cands;
+                once |= cands;
+            }
+            mask_t missing = FULL_MASK & ~m_used[type][unit];
+            if (missing & ~once){
+                hint.type = HintType::CONTRADICTION;
+                hint.row = rows[0];
+                hint.col = cols[0];
+                hint.value = util::count_trailing_zeros(missing & ~once) + 1;
+                return hint;
+            }
+            mask_t singles = once & ~twice;
+            if (!singles) continue;
+            val_t value = util::count_trailing_zeros(singles) + 1;
+            for (unsigned int k = 0; k < BOARD_SIZE; k++){
+                if (candidates(rows[k], cols[k]) & (mask_t(1) << (value - 1))){
+                    hint.type = types[type];
+                    hint.row = rows[k];
+                    hint.col = cols[k];
+                    hint.value = value;
+                    return hint;
+                }
+            }
+        }
+    }
+    return hint;
+}
+
+void SolverSession::to_board(Board& board) const
+{
+    std::memcpy(board.data(), m_cells, sizeof(m_cells));
+}
@@ -0,0 +1,84 @@
+/*
+An interactive solving session: the board is changed one move at a time,
+and the state derived from it is updated incrementally instead of solving from scratch.
+Each unit (row, column, grid) keeps the count of each value in it, so that
+- placing or erasing a value only updates the three units of the cell,
+- the candidates of a cell are the values missing from its units, read from the unit masks,
+- conflicts (a value twice in a unit) are tracked as the moves are made.
+Queries (candidates, next logical deduction, solvability) take microseconds on a 9x9 board.
+*/
+
+#pragma once
+#include "board.h"
+#include "bit_search.h"
+#include "config.h"
+#include <cstdint>
+#include <memory>
+
+enum class HintType
+{
+    NONE,               // no single left, a guess is needed
+    NAKED_SINGLE,       // the cell has a single candidate
+    HIDDEN_SINGLE_ROW,  // the value fits in a single cell of the row
+    HIDDEN_SINGLE_COL,
+    HIDDEN_SINGLE_GRID,
+    CONTRADICTION,      // a conflict, a cell without candidate, or a value without place in a unit
+};
+const char* hint_name(HintType type);
+
+// the answer of is_solvable, UNKNOWN when the search ran out of time
+enum class Solvability
+{
+    UNSOLVABLE,
+    SOLVABLE,
+    UNKNOWN,
+};
+
+struct Hint
+{
+    HintType type = HintType::NONE;
+    unsigned int row = 0;
+    unsigned int col = 0;
+    val_t value = 0;
+};
+
+class SolverSession
+{
+public:
+    // the filled cells of the board are the givens, which can not be changed
+    SolverSession(const Board& board);
+
+    // throw std::out_of_range on invalid coordinates or value, std::runtime_error on a given cell.
+    // a value conflicting with the board is accepted, and reported by has_conflict / next_deduction
+    void place(unsigned int row, unsigned int col, val_t value);
+    void erase(unsigned int row, unsigned int col);
+
+    val_t get(unsigned int row, unsigned int col) const { return m_cells[row * BOARD_SIZE + col]; }
+    bool is_given(unsigned int row, unsigned int col) const { return m_given[row * BOARD_SIZE + col]; }
+    // the values allowed by the units of an empty cell, bit (v - 1) for the value v, 0 for a filled cell
+    mask_t candidates(unsigned int row, unsigned int col) const;
+    bool has_conflict() const { return m_n_conflicts > 0; }
+    // the value of the cell is also in one of its units
+    bool conflicts(unsigned int row, unsigned int col) const;
+    bool is_solved() const { return m_n_filled == CELL_COUNT && m_n_conflicts == 0; }
+    // the board without conflict can still be completed, searched for up to timeout seconds (no limit if not positive),
+    // a known answer is kept until the next move, UNKNOWN is asked again
+    Solvability is_solvable(double timeout = 0.1);
+    Hint next_deduction() const;
+    void to_board(Board& board) const;
+
+private:
+    val_t m_cells[CELL_COUNT];
+    bool m_given[CELL_COUNT];
+    // [unit type][unit][value - 1], unit types in the order of UnitType: row, column, grid
+    uint8_t m_count[3][BOARD_SIZE][CANDIDATE_SIZE];
+    mask_t m_used[3][BOARD_SIZE];
+    unsigned int m_n_conflicts;             // (unit, value) pairs with the value more than once
+    unsigned int m_n_filled;
+    int m_solvable;                         // -1 if not known since the last move
+    std::unique_ptr<BitSearch> m_search;
+
+    static unsigned int unit_of(unsigned int type, unsigned int row, unsigned int col);
+    void update_units(unsigned int row, unsigned int col, val_t value, bool add);
+    void check(unsigned int row, unsigned int col) const;
+};
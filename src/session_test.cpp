@@ -0,0 +1,61 @@
+#include "session.h"
+#include "generate.h"
+#include "config.h"
+#include "testing.h"
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+
+int main(){
+    // a puzzle with a unique solution, so that every single is the answer
+    Board solution, puzzle;
+    BitSearch search;
+    do{
+        gen::fill_valid_board(solution, gen::FillStrategy::RANDOM);
+        puzzle.load_data(solution);
+        for (unsigned int j = 0; j < CELL_COUNT; j += 3) puzzle.set(j, 0);
+    } while (search.count(puzzle, 2) != 1);
+    const val_t* answer = solution.data();
+
+    SolverSession session(puzzle);
+    ASSERT_TRUE(!session.has_conflict() && !session.is_solved() && session.is_solvable() == Solvability::SOLVABLE);
+
+    // the candidates of an empty cell contain the answer, and none of the values of its row
+    mask_t cands = session.candidates(0, 0);
+    bool in_row = false;
+    for (unsigned int c = 1; c < BOARD_SIZE; c++){
+        val_t v = session.get(0, c);
+        in_row = in_row || (v && (cands & (mask_t(1) << (v - 1))));
+    }
+    ASSERT_TRUE((cands & (mask_t(1) << (answer[0] - 1))) && !in_row);
+
+    // a conflicting move is reported, and undone by erasing it
+    val_t wrong = session.get(0, 1);
+    session.place(0, 0, wrong);
+    Hint hint = session.next_deduction();
+    ASSERT_TRUE(session.has_conflict() && session.conflicts(0, 0) && hint.type == HintType::CONTRADICTION && session.is_solvable() == Solvability::UNSOLVABLE);
+    session.erase(0, 0);
+    ASSERT_TRUE(!session.has_conflict() && session.candidates(0, 0) == cands);
+    // without a time limit, the answer is known again after the move
+    ASSERT_TRUE(session.is_solvable(0) == Solvability::SOLVABLE);
+
+    // the givens can not be changed
+    bool thrown = false;
+    try{ session.place(0, 1, 1); } catch (std::runtime_error&){ thrown = true; }
+    ASSERT_TRUE(thrown);
+
+    // following the hints solves the puzzle with the right values
+    bool correct = true;
+    unsigned int n_hints = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (hint = session.next_deduction(); hint.type != HintType::NONE && hint.type != HintType::CONTRADICTION; hint = session.next_deduction()){
+        correct = correct && hint.value == answer[hint.row * BOARD_SIZE + hint.col];
+        session.place(hint.row, hint.col, hint.value);
+        n_hints++;
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    ASSERT_TRUE(correct && session.is_solved());
+    std::cout << "Mean time per hint and move: "
+        << std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / std::max(n_hints, 1u) << " [ns]" << std::endl;
+    return testing::exit_code();
+}
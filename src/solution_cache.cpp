@@ -0,0 +1,121 @@
+#include "solution_cache.h"
+#include <algorithm>
+#include <cstring>
+
+namespace cache
+{
+    // shards of the cache, to keep the lock contention low with many solver threads
+    static const unsigned int N_SHARDS = 16;
+
+    Key::Key(const Board& puzzle)
+    {
+        canonical::minlex(puzzle, canonical_board, &transform);
+        hash = canonical::hash(canonical_board);
+    }
+
+    SolutionCache::SolutionCache(unsigned long capacity):
+        m_capacity(std::max(capacity, 1ul)), m_n_hits(0), m_n_misses(0), m_n_evictions(0)
+    {
+        unsigned long n_shards = std::min<unsigned long>(N_SHARDS, m_capacity);
+        m_shard_capacity = m_capacity / n_shards;
+        for (unsigned long i = 0; i < n_shards; i++){
+            m_shards.emplace_back(new Shard());
+        }
+    }
+
+    SolutionCache::Shard& SolutionCache::shard_for(uint64_t hash)
+    {
+        // the high bits, as the low ones index the map of the shard
+        return *m_shards[(hash >> 32) % m_shards.size()];
+    }
+
+    bool SolutionCache::lookup(const Key& key, Board& solution, bool& solved)
+    {
+        Shard& shard = shard_for(key.hash);
+        Board canonical_solution;
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto it = shard.index.find(key.hash);
+            Entry* entry = (it == shard.index.end()) ? nullptr : &shard.entries[it->second];
+            if (!entry || std::memcmp(entry->puzzle.data(), key.canonical_board.data(), sizeof(entry->puzzle)) != 0){
+                m_n_misses++;
+                return false;
+            }
+            entry->referenced = true;
+            solved = entry->solved;
+            std::memcpy(canonical_solution.data(), entry->solution.data(), sizeof(entry->solution));
+        }
+        m_n_hits++;
+        key.transform.inverse().apply(canonical_solution, solution);
+        return true;
+    }
+
+    void SolutionCache::insert(const Key& key, const Board& solution, bool solved)
+    {
+        Board canonical_solution;
+        key.transform.apply(solution, canonical_solution);
+
+        Shard& shard = shard_for(key.hash);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        size_t slot;
+        auto it = shard.index.find(key.hash);
+        if (it != shard.index.end()){
+            // already there, or a hash collision which replaces the entry
+            slot = it->second;
+        }
+        else if (shard.entries.size() < m_shard_capacity){
+            slot = shard.entries.size();
+            shard.entries.emplace_back();
+            shard.index[key.hash] = slot;
+        }
+        else{
+            // give the referenced entries a second chance, evict the first one that is not
+            while (shard.entries[shard.hand].referenced){
+                shard.entries[shard.hand].referenced = false;
+                shard.hand = (shard.hand + 1) % shard.entries.size();
+            }
+            slot = shard.hand;
+            shard.hand = (shard.hand + 1) % shard.entries.size();
+            shard.index.erase(shard.entries[slot].hash);
+            shard.index[key.hash] = slot;
+            m_n_evictions++;
+        }
+
+        Entry& entry = shard.entries[slot];
+        entry.hash = key.hash;
+        std::memcpy(entry.puzzle.data(), key.canonical_board.data(), sizeof(entry.puzzle));
+        std::memcpy(entry.solution.data(), canonical_solution.data(), sizeof(entry.solution));
+        entry.solved = solved;
+        entry.referenced = false;
+    }
+
+    CacheStats SolutionCache::stats() const
+    {
+        CacheStats stats;
+        stats.n_hits = m_n_hits;
+        stats.n_misses = m_n_misses;
+        stats.n_evictions = m_n_evictions;
+        stats.capacity = m_shard_capacity * m_shards.size();
+        stats.size = 0;
+        for (auto& shard: m_shards){
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            stats.size += shard->entries.size();
+        }
+        unsigned long n_lookups = stats.n_hits + stats.n_misses;
+        stats.hit_rate = n_lookups ? static_cast<double>(stats.n_hits) / n_lookups : 0.0;
+        return stats;
+    }
+
+    void SolutionCache::clear()
+    {
+        for (auto& shard: m_shards){
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            shard->entries.clear();
+            shard->index.clear();
+            shard->hand = 0;
+        }
+        m_n_hits = 0;
+        m_n_misses = 0;
+        m_n_evictions = 0;
+    }
+}
@@ -0,0 +1,83 @@
+/*
+A bounded cache of solutions, shared by the solver threads.
+Puzzles are keyed by their canonical form, so that a puzzle hits the entry of any equivalent one
+(transposed, permuted, relabeled): the solution is stored in the canonical form,
+and mapped back to a puzzle through the inverse of its transform.
+The cache is split into shards with a lock each, the entries are evicted with the CLOCK policy.
+*/
+
+#pragma once
+#include "board.h"
+#include "canonical.h"
+#include "config.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace cache
+{
+    // a puzzle looked up in the cache, its canonical form is computed once for the lookup and the insertion
+    struct Key
+    {
+        Key(const Board& puzzle);
+
+        uint64_t hash;
+        Board canonical_board;
+        canonical::Transform transform;     // from the puzzle to canonical_board
+    };
+
+    struct CacheStats
+    {
+        unsigned long n_hits;
+        unsigned long n_misses;
+        unsigned long n_evictions;
+        unsigned long size;
+        unsigned long capacity;
+        double hit_rate;                    // n_hits / (n_hits + n_misses)
+    };
+
+    class SolutionCache
+    {
+    public:
+        SolutionCache(unsigned long capacity);
+
+        // returns true on a hit, with the solution of the puzzle of the key, and whether it was solved
+        bool lookup(const Key& key, Board& solution, bool& solved);
+        // store the result of solving the puzzle of the key
+        void insert(const Key& key, const Board& solution, bool solved);
+
+        CacheStats stats() const;
+        void clear();
+
+    private:
+        struct Entry
+        {
+            uint64_t hash;
+            std::array<val_t, CELL_COUNT> puzzle;       // canonical, to tell the hash collisions apart
+            std::array<val_t, CELL_COUNT> solution;     // canonical
+            bool solved;
+            bool referenced;                            // cleared by the clock hand, set on a hit
+        };
+
+        struct Shard
+        {
+            std::mutex mutex;
+            std::vector<Entry> entries;
+            std::unordered_map<uint64_t, size_t> index;
+            size_t hand = 0;
+        };
+
+        unsigned long m_capacity;
+        unsigned long m_shard_capacity;
+        std::vector<std::unique_ptr<Shard>> m_shards;
+        std::atomic_ulong m_n_hits;
+        std::atomic_ulong m_n_misses;
+        std::atomic_ulong m_n_evictions;
+
+        Shard& shard_for(uint64_t hash);
+    };
+}
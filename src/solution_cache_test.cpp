@@ -0,0 +1,96 @@
+#include "solution_cache.h"
+#include "generate.h"
+#include "solver.h"
+#include "config.h"
+#include "testing.h"
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+// the solution is complete and keeps the clues of the puzzle
+bool solves(const Board& solution, const Board& puzzle){
+    Board copy(solution);
+    bool ok = copy.is_solved();
+    for (unsigned int i = 0; i < CELL_COUNT; i++){
+        ok = ok && (puzzle.data()[i] == 0 || puzzle.data()[i] == solution.data()[i]);
+    }
+    return ok;
+}
+
+int main(){
+    std::mt19937 rng(7);
+    Board full;
+    gen::fill_valid_board(full, gen::FillStrategy::RANDOM);
+    Board puzzle(full);
+    for (unsigned int j = 0; j < CELL_COUNT; j += 11) puzzle.set(j, 0);
+
+    cache::SolutionCache solution_cache(64);
+    Board solution;
+    bool solved = false;
+    cache::Key key(puzzle);
+    ASSERT_TRUE(!solution_cache.lookup(key, solution, solved));
+    solution_cache.insert(key, full, true);
+
+    // an equivalent puzzle hits, and gets its own solution back
+    bool all_hit = true;
+    for (int i = 0; i < 10; i++){
+        Board other;
+        canonical::Transform::random(rng).apply(puzzle, other);
+        all_hit = all_hit && solution_cache.lookup(cache::Key(other), solution, solved) && solved && solves(solution, other);
+    }
+    ASSERT_TRUE(all_hit);
+    auto stats = solution_cache.stats();
+    ASSERT_TRUE(stats.n_hits == 10 && stats.n_misses == 1 && stats.size == 1);
+
+    // an empty board is a key too, and any of its solutions answers it
+    Board empty, transformed;
+    empty.clear(0);
+    cache::SolutionCache empty_cache(4);
+    empty_cache.insert(cache::Key(empty), full, true);
+    canonical::Transform::random(rng).apply(empty, transformed);
+    ASSERT_TRUE(empty_cache.lookup(cache::Key(transformed), solution, solved) && solved && solves(solution, empty));
+
+    // the cache stays bounded, evicting the entries
+    cache::SolutionCache small_cache(16);
+    for (int i = 0; i < 100; i++){
+        Board grid;
+        gen::fill_valid_board(grid, gen::FillStrategy::RANDOM);
+        small_cache.insert(cache::Key(grid), grid, true);
+    }
+    stats = small_cache.stats();
+    ASSERT_TRUE(stats.size <= 16 && stats.n_evictions >= 84);
+
+    // concurrent lookups and insertions of a few puzzles
+    std::vector<Board> puzzles;
+    for (int i = 0; i < 8; i++){
+        gen::fill_valid_board(full, gen::FillStrategy::RANDOM);
+        puzzles.emplace_back(full);
+        for (unsigned int j = i % 11; j < CELL_COUNT; j += 11) puzzles.back().set(j, 0);
+    }
+    cache::SolutionCache shared_cache(1024);
+    std::vector<std::thread> threads;
+    std::vector<int> n_wrong(4, 0);
+    for (int t = 0; t < 4; t++){
+        threads.emplace_back([&, t](){
+            std::mt19937 local_rng(t);
+            Board other, result;
+            bool ok;
+            for (int i = 0; i < 200; i++){
+                canonical::Transform::random(local_rng).apply(puzzles[i % puzzles.size()], other);
+                cache::Key k(other);
+                if (!shared_cache.lookup(k, result, ok)){
+                    Solver solver(other);
+                    ok = solver.solve();
+                    shared_cache.insert(k, solver.board(), ok);
+                    continue;
+                }
+                n_wrong[t] += !(ok && solves(result, other));
+            }
+        });
+    }
+    for (auto& thread: threads) thread.join();
+    stats = shared_cache.stats();
+    ASSERT_TRUE(n_wrong == std::vector<int>(4, 0) && stats.n_hits + stats.n_misses == 800 && stats.n_hits >= 800 - 8 * 4);
+    return testing::exit_code();
+}
@@ -3,21 +3,38 @@
 #include "config.h"
 #include "solver_base.h"
 #include "solver.h"
+#include <chrono>
 #include <memory>
 
-#define MAX_FORK_TRAIL MAX_ITER
-
 // #define DEBUG_PRINT(x) std::cout << x << std::endl;
 #define DEBUG_PRINT(x);
 
 // initialize the static variables
 
+// the time budget of resume is checked every few steps
+static const unsigned long BUDGET_CHECK_STEPS = 16;
+
+struct Solver::GuessFrame
+{
+    std::unique_ptr<Solver> snapshot;   // the state before the guess
+    Coord cell;
+    val_t values[CANDIDATE_SIZE];
+    unsigned int n_values;
+    unsigned int next;                  // the index of the next candidate to try
+};
+
 Solver::Solver(const Board& board) : SolverBase(board), 
-m_config(new Solver_config()), m_candidates{ new CandidateBoard() }, m_fill_state{ new FillState() }
-{ init_states(); };
+m_config(new Solver_config()), m_candidates{ new CandidateBoard() }, m_fill_state{ new FillState() },
+m_depth(0), m_search_done(false), m_search_status(SolveStatus::UNSOLVED)
+{
+    // a guess fills a cell, the stack is never deeper than the number of cells
+    m_frames.reserve(CELL_COUNT);
+    init_states();
+};
 
 Solver::Solver(Solver& other) : SolverBase(other.board()), 
-m_config(new Solver_config()), m_candidates{ new CandidateBoard() }, m_fill_state{ new FillState() }
+m_config(new Solver_config()), m_candidates{ new CandidateBoard() }, m_fill_state{ new FillState() },
+m_depth(0), m_search_done(false), m_search_status(SolveStatus::UNSOLVED)
 {
     m_iteration_counter->load(*other.m_iteration_counter);
     m_fill_state->load(*other.m_fill_state);
@@ -25,6 +42,8 @@ m_config(new Solver_config()), m_candidates{ new CandidateBoard() }, m_fill_stat
     m_config->load(*other.m_config);
 };
 
+Solver::~Solver() = default;
+
 void Solver::init_states(){
     *m_config = {
         parser::parse_env("SOLVER_USE_GUESS", true),
@@ -33,17 +52,41 @@ void Solver::init_states(){
         parser::parse_env("SOLVER_USE_DOUBLE", false),
         false
     };
+    // a puzzle failing the checks is not propagated, and fails the solves at once
+    m_precheck = check_puzzle(board());
+    if (m_precheck != SolveStatus::UNSOLVED) return;
     for (unsigned int i = 0; i < BOARD_SIZE; i++)
     {
         for (unsigned int j = 0; j < BOARD_SIZE; j++)
         {
             val_t filled_val = board().get_(i, j);
             if (filled_val == 0) continue;
-            fill_propagate(i, j, filled_val);
+            if (fill_propagate(i, j, filled_val) != OpState::SUCCESS){
+                // the givens passed the checks, a violation of their propagation is a contradiction
+                m_precheck = SolveStatus::CONTRADICTION;
+                return;
+            }
         }
     }
 };
 
+void Solver::reset(const Board& board){
+    m_board->load_data(board);
+    m_iteration_counter->load(IterationCounter());
+    m_candidates->reset();
+    m_fill_state->clear();
+    m_depth = 0;
+    m_search_done = false;
+    m_search_status = SolveStatus::UNSOLVED;
+    init_states();
+};
+
+void Solver::load_state(const Solver& other){
+    m_board->load_data(*other.m_board);
+    m_candidates->load(*other.m_candidates);
+    m_fill_state->load(*other.m_fill_state);
+};
+
 Solver_config& Solver::config(){
     return *m_config;
 };
@@ -84,8 +127,8 @@ OpState Solver::step_by_hidden_single(
     return updated ? OpState::SUCCESS : OpState::FAIL;
 }
 
-bool Solver::step(){
-    DEBUG_PRINT("Solver::step()");
+OpState Solver::step_by_deduction(){
+    DEBUG_PRINT("Solver::step_by_deduction()");
 
     auto step_by_single = [&]()->OpState{
         OpState state;
@@ -108,8 +151,7 @@ bool Solver::step(){
     OpState state;
 
     state = step_by_single();
-    if (state == OpState::VIOLATION) return false;
-    if (state == OpState::SUCCESS) return true;
+    if (state != OpState::FAIL) return state;
 
     // refine the candidates by naked double
     if (config().use_double){
@@ -117,37 +159,48 @@ bool Solver::step(){
         {
             UnitType unit_type = static_cast<UnitType>(i);
             state = refine_candidates_by_naked_double(unit_type);
-            if (state == OpState::VIOLATION) return false;
+            if (state == OpState::VIOLATION) return state;
             
             // try to solve the puzzle again
             iteration_counter().current += 1;
             state = step_by_single();
             // if (state == OpState::SUCCESS) std::cout << "Progressed after refining candidates by naked double" << std::endl;
-            if (state == OpState::VIOLATION) return false;
-            if (state == OpState::SUCCESS) return true;
+            if (state != OpState::FAIL) return state;
         }
 
         for (unsigned int i = 0; i < 3; i++)
         {
             UnitType unit_type = static_cast<UnitType>(i);
             state = refine_candidates_by_hidden_double(unit_type);
-            if (state == OpState::VIOLATION) return false;
+            if (state == OpState::VIOLATION) return state;
             
             // try to solve the puzzle again
             iteration_counter().current += 1;
             state = step_by_single();
             // if (state == OpState::SUCCESS) std::cout << "Progressed after refining candidates by hidden double" << std::endl;
-            if (state == OpState::VIOLATION) return false;
-            if (state == OpState::SUCCESS) return true;
+            if (state != OpState::FAIL) return state;
         }
     }
 
-    if (config().use_guess){
+    return OpState::FAIL;
+};
+
+bool Solver::step(){
+    DEBUG_PRINT("Solver::step()");
+    OpState state = step_by_deduction();
+    if (state == OpState::SUCCESS){
+        iteration_counter().current++;
+        return true;
+    }
+
+    if (state == OpState::FAIL && config().use_guess){
         state = step_by_guess();
         if (state == OpState::SUCCESS) return true;
         DEBUG_PRINT("Solver::step() - step_by_guess() failed");
+        return false;
     }
-    return false;
+    // a contradiction, or no deduction left without guessing, taking the guess back is not an iteration
+    return backtrack();
 };
 
 OpState Solver::fill_propagate(unsigned int row, unsigned int col, val_t value){
@@ -163,6 +216,7 @@ OpState Solver::fill_propagate(unsigned int row, unsigned int col, val_t value){
     }
 
     // update the filled count
+    m_fill_state->n_filled += 1;
     m_fill_state->count[v_idx] += 1;
     if (m_fill_state->count[v_idx] > BOARD_SIZE){
         return OpState::VIOLATION;
@@ -421,7 +475,7 @@ OpState Solver::update_by_hidden_single(val_t value, UnitType unit_type){
     return OpState::FAIL;
 };
 
-OpState Solver::step_by_guess(){
+unsigned int Solver::choose_guess(Coord& cell, val_t* values){
     auto numNeighborUnsolved = [this](unsigned int row, unsigned int col)->unsigned int{
         unsigned int min_count;
         unsigned int row_count = 0;
@@ -566,32 +620,86 @@ OpState Solver::step_by_guess(){
         }
     }
 
-    // make guesses with backtracking
+    cell = best_choice;
     for (unsigned int i = 0; i < candidate_count; i++){
-        this->iteration_counter().n_guesses += 1;
-
-        val_t guess = candidate_filled_pairs[i].val;
-
-        auto forked_solver = Solver(*this);
-        // auto forked_solver = *std::unique_ptr<Solver>(new Solver(*this));
+        values[i] = candidate_filled_pairs[i].val;
+    }
+    return candidate_count;
+};
 
-        // inherit the iteration counter
-        forked_solver.iteration_counter().current = this->iteration_counter().current;
+OpState Solver::step_by_guess(){
+    // the interruptions are checked before the state is saved
+    if (iteration_counter().interrupted(true)) return OpState::FAIL;
+    if (m_depth == m_frames.size()){
+        m_frames.emplace_back(new GuessFrame());
+        m_frames.back()->snapshot.reset(new Solver(*this));
+    }
+    else{
+        m_frames[m_depth]->snapshot->load_state(*this);
+    }
+    GuessFrame& frame = *m_frames[m_depth];
+    frame.n_values = choose_guess(frame.cell, frame.values);
+    frame.next = 0;
+    m_depth++;
+
+    // the guess is an iteration, taken back by backtrack if none of its values works
+    IterationCounter& counter = iteration_counter();
+    counter.current++;
+    counter.depth = m_depth;
+    if (m_depth > counter.max_depth) counter.max_depth = m_depth;
+    return backtrack() ? OpState::SUCCESS : OpState::FAIL;
+};
 
-        bool solved;
-        forked_solver.fill_propagate(best_choice.row, best_choice.col, guess);
-        solved = forked_solver.solve();
+bool Solver::backtrack(){
+    bool exhausted = m_depth > 0;
+    while (m_depth > 0){
+        GuessFrame& frame = *m_frames[m_depth - 1];
+        if (frame.next < frame.n_values){
+            // the first guess is made on the state just saved
+            if (frame.next > 0) load_state(*frame.snapshot);
+            iteration_counter().n_guesses += 1;
+            fill_propagate(frame.cell.row, frame.cell.col, frame.values[frame.next++]);
+            return true;
+        }
+        m_depth--;
+        iteration_counter().depth = m_depth;
+        iteration_counter().current--;
+    }
+    // no guess worked, leave the board as it was before the first one
+    if (exhausted) load_state(*m_frames[0]->snapshot);
+    return false;
+};
 
-        this->iteration_counter().current = forked_solver.iteration_counter().current;
-        this->iteration_counter().n_guesses = forked_solver.iteration_counter().n_guesses;
+SolveStatus Solver::finish_search(SolveStatus status){
+    m_depth = 0;
+    m_search_done = true;
+    m_search_status = status;
+    return status;
+};
 
-        if (!solved){ continue; }
+SolveStatus Solver::resume(unsigned long max_steps, unsigned long max_us){
+    if (m_search_done) return m_search_status;
+    if (m_precheck != SolveStatus::UNSOLVED) return finish_search(m_precheck);
+
+    auto start_time = std::chrono::steady_clock::now();
+    IterationCounter& counter = iteration_counter();
+    for (unsigned long n_steps = 0; ; n_steps++){
+        if (is_filled()){
+            if (board().is_solved()) return finish_search(SolveStatus::SOLVED);
+            if (!backtrack()) return finish_search(SolveStatus::UNSOLVED);
+            continue;
+        }
+        if (counter.current >= counter.limit) return finish_search(SolveStatus::UNSOLVED);
+
+        // at least one step per call, so that the search always moves on
+        if (n_steps > 0){
+            if (max_steps > 0 && n_steps >= max_steps) return SolveStatus::YIELDED;
+            if (max_us > 0 && n_steps % BUDGET_CHECK_STEPS == 0 &&
+                std::chrono::steady_clock::now() - start_time >= std::chrono::microseconds(max_us)){
+                return SolveStatus::YIELDED;
+            }
+        }
 
-        this->board().load_data(forked_solver.board());
-        return OpState::SUCCESS;
+        if (!step()) return finish_search(SolveStatus::UNSOLVED);
     }
-
-    // ideally, we should never reach here...
-    // unless the board is invalid, trail limit is reached, or the guess is wrong. 
-    return OpState::FAIL;
-};
\ No newline at end of file
+};
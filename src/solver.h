@@ -6,6 +6,7 @@
 #include "util.h"
 #include <cstring>
 #include <memory>
+#include <vector>
 
 struct Solver_config{
     bool use_guess;
@@ -30,6 +31,7 @@ struct Solver_config{
 
 struct FillState{
     unsigned int count[CANDIDATE_SIZE] = {0};
+    unsigned int n_filled = 0;      // the cells filled so far, the sum of count
     bool row[BOARD_SIZE][CANDIDATE_SIZE] = {{0}};
     bool col[BOARD_SIZE][CANDIDATE_SIZE] = {{0}};
     bool grid[GRID_SIZE][GRID_SIZE][CANDIDATE_SIZE] = {{{0}}};
@@ -37,11 +39,21 @@ struct FillState{
 
     void load(const FillState& other){
         std::memcpy (count, other.count, sizeof(count));
+        n_filled = other.n_filled;
         std::memcpy (row, other.row, sizeof(row));
         std::memcpy (col, other.col, sizeof(col));
         std::memcpy (grid, other.grid, sizeof(grid));
         std::memcpy (visited_double_combinations, other.visited_double_combinations, sizeof(visited_double_combinations));
     }
+
+    void clear(){
+        std::memset (count, 0, sizeof(count));
+        n_filled = 0;
+        std::memset (row, 0, sizeof(row));
+        std::memset (col, 0, sizeof(col));
+        std::memset (grid, 0, sizeof(grid));
+        std::memset (visited_double_combinations, 0, sizeof(visited_double_combinations));
+    }
 };
 
 class Solver : public SolverBase
@@ -49,12 +61,28 @@ class Solver : public SolverBase
 public:
     Solver(const Board& board);
     Solver(Solver& other);
+    ~Solver();
     void init_states();
+    // start over on a new board, reusing the allocated states
+    void reset(const Board& board);
 
     bool step();
+    bool backtrack();
+    bool is_filled() const { return m_fill_state->n_filled == CELL_COUNT; }
+    // resumable solving, on the same stack of guesses as solve():
+    // runs at most max_steps steps and about max_us microseconds (0 for no bound), then returns
+    // SolveStatus::YIELDED with the search kept for the next call, until it returns SOLVED or UNSOLVED.
+    // the search starts on a new or reset solver, solve() is not to be called on the same board
+    SolveStatus resume(unsigned long max_steps, unsigned long max_us = 0);
     Solver_config& config();
+    const CandidateBoard& candidates() const { return *m_candidates; }
+    // the deductions of a step (singles, and doubles if enabled), without guessing
+    OpState step_by_deduction();
     OpState step_by_naked_single();
     OpState step_by_hidden_single(UnitType unit_type);
+    // the cell to guess and its candidates in the order to try them, returns the number of candidates
+    unsigned int choose_guess(Coord& cell, val_t* values);
+    // push a decision on the guess stack and try its first candidate
     OpState step_by_guess();
 
     // set the value of a cell, and propagate the value to change the states
@@ -68,6 +96,19 @@ private:
     std::unique_ptr<CandidateBoard> m_candidates;
     std::unique_ptr<FillState> m_fill_state;
 
+    // the depth-first search over the guesses keeps its decisions on an explicit stack instead of the call stack,
+    // each frame saves the state before its guess; the frames are allocated on the first visit of a depth,
+    // then kept for the next boards
+    struct GuessFrame;
+    std::vector<std::unique_ptr<GuessFrame>> m_frames;
+    unsigned int m_depth;
+    bool m_search_done;
+    SolveStatus m_search_status;
+
+    // copy the board, candidates and fill state, not the counter nor the config
+    void load_state(const Solver& other);
+    SolveStatus finish_search(SolveStatus status);
+
     OpState update_by_naked_single(unsigned int row, unsigned int col);
     OpState update_by_hidden_single(val_t value, UnitType unit_type);
 
@@ -3,17 +3,91 @@
 #include "board.h"
 #include "config.h"
 
+// the clock is read every few iterations, and before each guess
+static const unsigned long DEADLINE_CHECK_ITERATIONS = 16;
+
+const char* solve_status_name(SolveStatus status)
+{
+    switch (status){
+        case SolveStatus::SOLVED: return "solved";
+        case SolveStatus::TIMEOUT: return "timeout";
+        case SolveStatus::CANCELLED: return "cancelled";
+        case SolveStatus::YIELDED: return "yielded";
+        case SolveStatus::INVALID: return "invalid";
+        case SolveStatus::CONTRADICTION: return "contradiction";
+        case SolveStatus::MULTIPLE: return "multiple";
+        default: return "unsolved";
+    }
+}
+
+SolveStatus check_puzzle(const Board& board)
+{
+    // the values given in each unit, from the same pass as Board::is_valid
+    mask_t rows[BOARD_SIZE], cols[BOARD_SIZE], grids[BOARD_SIZE];
+    if (!board.unit_masks(rows, cols, grids)) return SolveStatus::INVALID;
+    const val_t* cells = board.data();
+
+    // the values that still have a place in each unit, from the candidates of its empty cells
+    mask_t row_places[BOARD_SIZE] = {0}, col_places[BOARD_SIZE] = {0}, grid_places[BOARD_SIZE] = {0};
+    for (unsigned int row = 0; row < BOARD_SIZE; row++){
+        for (unsigned int col = 0; col < BOARD_SIZE; col++){
+            if (cells[row * BOARD_SIZE + col] != 0) continue;
+            unsigned int grid = (row / GRID_SIZE) * GRID_SIZE + col / GRID_SIZE;
+            mask_t candidates = FULL_MASK & ~(rows[row] | cols[col] | grids[grid]);
+            if (candidates == 0) return SolveStatus::CONTRADICTION;
+            row_places[row] |= candidates;
+            col_places[col] |= candidates;
+            grid_places[grid] |= candidates;
+        }
+    }
+    for (unsigned int unit = 0; unit < BOARD_SIZE; unit++){
+        if ((rows[unit] | row_places[unit]) != FULL_MASK || (cols[unit] | col_places[unit]) != FULL_MASK ||
+            (grids[unit] | grid_places[unit]) != FULL_MASK){
+            return SolveStatus::CONTRADICTION;
+        }
+    }
+    return SolveStatus::UNSOLVED;
+}
+
+SolveLimits SolveLimits::within(double seconds, const std::atomic_bool* cancel)
+{
+    SolveLimits limits;
+    if (seconds > 0){
+        limits.has_deadline = true;
+        limits.deadline = std::chrono::steady_clock::now() + 
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(seconds));
+    }
+    limits.cancel = cancel;
+    return limits;
+}
+
 #ifdef PYBIND11_BUILD
 #include <pybind11/pybind11.h>
+#include <chrono>
 namespace py = pybind11;
+
+// the signals are checked at most once per millisecond, reading the clock every few iterations
+static const unsigned long SIGNAL_CHECK_ITERATIONS = 64;
+static const auto SIGNAL_CHECK_INTERVAL = std::chrono::milliseconds(1);
 #endif
 
-SolverBase::SolverBase(const Board& board): m_iteration_counter(new IterationCounter()), m_board(new Board(board)) {};
+SolverBase::SolverBase(const Board& board): 
+    m_iteration_counter(new IterationCounter()), m_board(new Board(board)), m_precheck(SolveStatus::UNSOLVED) {};
 
 bool SolverBase::solve(bool verbose){
+    if (m_precheck != SolveStatus::UNSOLVED) return false;
+
+    #ifdef PYBIND11_BUILD
+    auto last_signal_check = std::chrono::steady_clock::now();
+    #endif
 
     // std::cout << "starting with iteration: " << m_iteration_counter.current << std::endl;
-    while (m_iteration_counter->current < m_iteration_counter->limit && !board().is_filled()){
+    while (m_iteration_counter->current < m_iteration_counter->limit){
+        // a filled board is either the solution or the result of a wrong guess
+        if (is_filled()){
+            if (board().is_solved() || !backtrack()) break;
+            continue;
+        }
     
         if(verbose)
         {
@@ -21,22 +95,40 @@ bool SolverBase::solve(bool verbose){
             std::cout << board() << std::endl;
         }
 
+        if (m_iteration_counter->interrupted(m_iteration_counter->current % DEADLINE_CHECK_ITERATIONS == 0)) break;
+
         bool step_result = step();
 
         #ifdef PYBIND11_BUILD
-        if (PyErr_CheckSignals() != 0){
-            throw py::error_already_set();
+        // the solver may also run on native threads that do not hold the GIL
+        if (m_iteration_counter->current % SIGNAL_CHECK_ITERATIONS == 0 && PyGILState_Check()){
+            auto now = std::chrono::steady_clock::now();
+            if (now - last_signal_check >= SIGNAL_CHECK_INTERVAL){
+                last_signal_check = now;
+                if (PyErr_CheckSignals() != 0){
+                    throw py::error_already_set();
+                }
+            }
         }
         #endif
 
         if (!step_result) break;
-
-        m_iteration_counter->current++;
     }
 
     return board().is_solved();
 };
 
+SolveStatus SolverBase::solve(const SolveLimits& limits, bool verbose){
+    if (m_precheck != SolveStatus::UNSOLVED) return m_precheck;
+    m_iteration_counter->limits = limits;
+    m_iteration_counter->stop_reason = SolveStatus::UNSOLVED;
+    bool solved = solve(verbose);
+    SolveStatus status = solved ? SolveStatus::SOLVED : m_iteration_counter->stop_reason;
+    m_iteration_counter->limits = SolveLimits();
+    m_iteration_counter->stop_reason = SolveStatus::UNSOLVED;
+    return status;
+};
+
 IterationCounter& SolverBase::iteration_counter()
 {
     return *m_iteration_counter;
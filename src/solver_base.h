@@ -2,22 +2,75 @@
 #include "config.h"
 #include "board.h"
 #include "indexer.h"
+#include <atomic>
+#include <chrono>
 #include <memory>
 
+enum class SolveStatus
+{
+    SOLVED,
+    UNSOLVED,       // no solution, or the iteration limit is reached
+    TIMEOUT,        // the deadline passed first
+    CANCELLED,      // the cancellation token was set first
+    YIELDED,        // resumable solving: the budget of the call ran out, the search goes on at the next call
+    INVALID,        // a given out of range, or twice in a unit
+    CONTRADICTION,  // an empty cell without candidate, or a value without place in a unit, before any search
+    MULTIPLE        // solved, but the puzzle has more than one solution (when asked for)
+};
+const char* solve_status_name(SolveStatus status);
+
+// the checks of the givens made before solving, in a single sweep over the cells with a bitmask per unit:
+// INVALID or CONTRADICTION as above, UNSOLVED if the puzzle passes them
+SolveStatus check_puzzle(const Board& board);
+
+// wall-clock bounds of a solve, on top of the iteration limit
+struct SolveLimits
+{
+    bool has_deadline = false;
+    std::chrono::steady_clock::time_point deadline;
+    // set by another thread to stop the solve, not owned
+    const std::atomic_bool* cancel = nullptr;
+
+    // a time budget in seconds from now, none if not positive
+    static SolveLimits within(double seconds, const std::atomic_bool* cancel = nullptr);
+};
+
 struct IterationCounter
 {
     // use long to avoid overflow
     unsigned long current;
     unsigned long limit;
     unsigned long n_guesses;
+    // the guesses made and not taken back, and the deepest chain of them in the solve
+    unsigned int depth;
+    unsigned int max_depth;
+    SolveLimits limits;
+    SolveStatus stop_reason;
 
-    IterationCounter(): current(0), limit(MAX_ITER), n_guesses(0) {};
+    IterationCounter(): current(0), limit(MAX_ITER), n_guesses(0), depth(0), max_depth(0), stop_reason(SolveStatus::UNSOLVED) {};
 
     void load(const IterationCounter& other)
     {
         current = other.current;
         limit = other.limit;
         n_guesses = other.n_guesses;
+        depth = other.depth;
+        max_depth = other.max_depth;
+        limits = other.limits;
+        stop_reason = other.stop_reason;
+    }
+
+    // the cancellation token is read every time, the clock only when check_clock is set
+    bool interrupted(bool check_clock)
+    {
+        if (stop_reason != SolveStatus::UNSOLVED) return true;
+        if (limits.cancel && limits.cancel->load(std::memory_order_relaxed)){
+            stop_reason = SolveStatus::CANCELLED;
+        }
+        else if (check_clock && limits.has_deadline && std::chrono::steady_clock::now() >= limits.deadline){
+            stop_reason = SolveStatus::TIMEOUT;
+        }
+        return stop_reason != SolveStatus::UNSOLVED;
     }
 };
 
@@ -29,11 +82,21 @@ public:
 
     SolverBase(const Board& board);
     virtual ~SolverBase() = default;
+    // a step of the search, false if it is stuck, it counts its own iterations
     virtual bool step() = 0;
+    // take back the guesses up to one with a candidate left and try it, false if there is none
+    virtual bool backtrack() { return false; }
+    // no empty cell left, checked at every iteration: the solvers counting their filled cells answer without a scan
+    virtual bool is_filled() const { return m_board->is_filled(); }
     bool solve(bool verbose = false);
+    // solve within the limits, which only apply to this call
+    SolveStatus solve(const SolveLimits& limits, bool verbose = false);
+    // the result of check_puzzle on the givens, a solve fails at once unless it is UNSOLVED
+    SolveStatus precheck() const { return m_precheck; }
     Board& board();
     IterationCounter& iteration_counter();
 protected:
     std::unique_ptr<IterationCounter> m_iteration_counter;
     std::unique_ptr<Board> m_board;
+    SolveStatus m_precheck;
 };
\ No newline at end of file
@@ -64,5 +64,84 @@ int main(){
             std::cout << "Failed." << std::endl;
         }
     }
+
+    // the resumable search, one step per call, finds the same solutions as the recursive one
+    std::unique_ptr<Solver> resumable;
+    for (const auto& c : cases){
+        auto [input, expected] = parse_case(c);
+        Board board;
+        board.load_data(input);
+        if (!resumable) resumable.reset(new Solver(board));
+        else resumable->reset(board);
+        SolveStatus status;
+        unsigned long n_calls = 0;
+        while ((status = resumable->resume(1)) == SolveStatus::YIELDED) n_calls++;
+
+        Solver solver(board);
+        solver.solve();
+        bool same = status == SolveStatus::SOLVED && n_calls > 0 && resumable->board() == solver.board()
+            && resumable->resume(1) == SolveStatus::SOLVED;
+        std::cout << (same ? "Passed." : "Failed.") << std::endl;
+    }
+
+    // the limits stop the search on the empty board, and only apply to the call they are given to
+    Board empty;
+    empty.clear(0);
+    Solver solver(empty);
+    std::atomic_bool cancel(true);
+    bool stopped = solver.solve(SolveLimits::within(0, &cancel)) == SolveStatus::CANCELLED && !solver.board().is_filled();
+    solver.reset(empty);
+    SolveLimits expired;
+    expired.has_deadline = true;
+    expired.deadline = std::chrono::steady_clock::now();
+    stopped = stopped && solver.solve(expired) == SolveStatus::TIMEOUT;
+    solver.reset(empty);
+    stopped = stopped && solver.solve(SolveLimits::within(10)) == SolveStatus::SOLVED && solver.board().is_solved();
+    std::cout << (stopped ? "Passed." : "Failed.") << std::endl;
+
+    // a time budget, with the guesses of the empty board on the stack between the calls
+    solver.reset(empty);
+    SolveStatus status;
+    while ((status = solver.resume(0, 50)) == SolveStatus::YIELDED);
+    std::cout << (status == SolveStatus::SOLVED && solver.board().is_solved() ? "Passed." : "Failed.") << std::endl;
+
+    // the guesses of the empty board are stacked, and all taken back on a board without solution
+    solver.reset(empty);
+    solver.solve();
+    bool deep = solver.iteration_counter().max_depth > 0 && solver.iteration_counter().depth <= solver.iteration_counter().max_depth;
+#if SIZE == 9
+    // passes the precheck, the contradiction is only found two guesses deep
+    std::string unsolvable_str = ".....7...6...5.........2......................8.......2.3...1.71.....26.....68...";
+    Board unsolvable;
+    for (unsigned int i = 0; i < CELL_COUNT; i++) unsolvable.set(i, unsolvable_str[i] == '.' ? 0 : unsolvable_str[i] - '0');
+    solver.reset(unsolvable);
+    deep = deep && solver.precheck() == SolveStatus::UNSOLVED && solver.solve(SolveLimits()) == SolveStatus::UNSOLVED
+        && solver.iteration_counter().max_depth >= 2 && solver.iteration_counter().depth == 0;
+#endif
+    std::cout << (deep ? "Passed." : "Failed.") << std::endl;
+
+    // the givens are checked before any search: a duplicate is invalid, a cell without candidate is a contradiction
+    Board duplicate = empty;
+    duplicate.set(0, 0, 1);
+    duplicate.set(BOARD_SIZE - 1, 0, 1);
+    Board no_candidate = empty;
+    for (unsigned int c = 0; c + 1 < BOARD_SIZE; c++) no_candidate.set(0, c, c + 1);
+    no_candidate.set(BOARD_SIZE - 1, BOARD_SIZE - 1, BOARD_SIZE);
+    // every cell keeps a candidate, but the 1 has no place left in the top left grid
+    Board no_place = empty;
+    for (unsigned int k = 1; k < GRID_SIZE; k++){
+        no_place.set(k, k * GRID_SIZE, 1);
+        no_place.set(k * GRID_SIZE, k, 1);
+    }
+    no_place.set(0, 0, 2);
+    bool checked = check_puzzle(empty) == SolveStatus::UNSOLVED && check_puzzle(duplicate) == SolveStatus::INVALID
+        && check_puzzle(no_candidate) == SolveStatus::CONTRADICTION && check_puzzle(no_place) == SolveStatus::CONTRADICTION;
+    for (const Board* puzzle : {&duplicate, &no_candidate, &no_place}){
+        solver.reset(*puzzle);
+        checked = checked && solver.precheck() == check_puzzle(*puzzle) && solver.solve(SolveLimits()) == solver.precheck()
+            && !solver.solve() && solver.iteration_counter().current == 0 && solver.board() == *puzzle
+            && solver.resume(1) == solver.precheck();
+    }
+    std::cout << (checked ? "Passed." : "Failed.") << std::endl;
     return 0;
 }
\ No newline at end of file
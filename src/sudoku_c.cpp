@@ -0,0 +1,285 @@
+#include "sudoku_c.h"
+#include "board.h"
+#include "generate.h"
+#include "solver.h"
+#include "util.h"
+#include "config.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+
+static_assert(sizeof(val_t) == sizeof(uint16_t), "the cells are exchanged as uint16_t");
+
+// the solver is created on the first solve, then reset for the next ones
+struct sudoku_context
+{
+    std::unique_ptr<Solver> solver;
+    Board board;
+    std::atomic_bool cancel{false};
+    // the resumable solve: the clues of the puzzle and the time spent in the calls so far
+    bool started = false;
+    uint32_t n_clues = 0;
+    uint64_t time_us = 0;
+};
+
+static void clear_result(sudoku_result* result, int32_t status)
+{
+    if (!result) return;
+    std::memset(result, 0, sizeof(sudoku_result));
+    result->status = status;
+}
+
+static void fill_result(sudoku_result* result, int32_t status, sudoku_context* context, uint64_t time_us)
+{
+    if (!result) return;
+    IterationCounter& counter = context->solver->iteration_counter();
+    result->status = status;
+    result->n_clues = context->n_clues;
+    result->iterations = counter.current;
+    result->iteration_limit = counter.limit;
+    result->n_guesses = counter.n_guesses;
+    result->time_us = time_us;
+}
+
+// check the puzzle and reset the solver of the context on it
+static int32_t load_puzzle(sudoku_context* context, const uint16_t* puzzle)
+{
+    Board& board = context->board;
+    uint32_t n_clues = 0;
+    for (unsigned int i = 0; i < CELL_COUNT; i++){
+        if (puzzle[i] > CANDIDATE_SIZE) return SUDOKU_INVALID;
+        n_clues += puzzle[i] != 0;
+    }
+    std::memcpy(board.data(), puzzle, CELL_COUNT * sizeof(val_t));
+    // the puzzles without solution are rejected here, before allocating a solver
+    SolveStatus check = check_puzzle(board);
+    if (check == SolveStatus::INVALID) return SUDOKU_INVALID;
+    if (check == SolveStatus::CONTRADICTION) return SUDOKU_CONTRADICTION;
+
+    if (!context->solver) context->solver.reset(new Solver(board));
+    else context->solver->reset(board);
+    context->n_clues = n_clues;
+    return SUDOKU_OK;
+}
+
+static unsigned int pool_size(uint32_t n_threads)
+{
+    return n_threads > 0 ? n_threads : std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+// run task(context, i) for i in [0, n) on a pool, each thread working on a contiguous slice with its own context
+template <typename Task>
+static void run_slices(uint64_t n, uint32_t n_threads, Task task)
+{
+    unsigned int n_slices = static_cast<unsigned int>(std::min<uint64_t>(pool_size(n_threads), n));
+    if (n_slices == 0) return;
+    std::vector<sudoku_context> contexts(n_slices);
+    util::ThreadPool pool(n_slices);
+    for (unsigned int s = 0; s < n_slices; s++){
+        pool.submit([&, s](){
+            for (uint64_t i = n * s / n_slices; i < n * (s + 1) / n_slices; i++){
+                task(contexts[s], i);
+            }
+        });
+    }
+    pool.wait();
+}
+
+extern "C" {
+
+uint32_t sudoku_abi_version(void)
+{
+    return SUDOKU_ABI_VERSION;
+}
+
+uint32_t sudoku_board_size(void)
+{
+    return BOARD_SIZE;
+}
+
+const char* sudoku_status_name(int32_t status)
+{
+    switch (status){
+        case SUDOKU_OK: return "ok";
+        case SUDOKU_UNSOLVED: return "unsolved";
+        case SUDOKU_INVALID: return "invalid";
+        case SUDOKU_TIMEOUT: return "timeout";
+        case SUDOKU_CANCELLED: return "cancelled";
+        case SUDOKU_YIELDED: return "yielded";
+        case SUDOKU_CONTRADICTION: return "contradiction";
+        default: return "error";
+    }
+}
+
+sudoku_context* sudoku_context_create(void)
+{
+    return new (std::nothrow) sudoku_context();
+}
+
+void sudoku_context_destroy(sudoku_context* context)
+{
+    delete context;
+}
+
+void sudoku_context_cancel(sudoku_context* context)
+{
+    if (context) context->cancel = true;
+}
+
+int32_t sudoku_solve(sudoku_context* context, const uint16_t* puzzle, uint16_t* solution, sudoku_result* result)
+{
+    return sudoku_solve_timed(context, puzzle, solution, 0, result);
+}
+
+int32_t sudoku_solve_timed(sudoku_context* context, const uint16_t* puzzle, uint16_t* solution, double timeout,
+    sudoku_result* result)
+{
+    if (!context || !puzzle || !solution){
+        clear_result(result, SUDOKU_ERROR);
+        return SUDOKU_ERROR;
+    }
+    try{
+        auto start_time = std::chrono::high_resolution_clock::now();
+        context->started = false;
+        int32_t status = load_puzzle(context, puzzle);
+        if (status != SUDOKU_OK){
+            std::memmove(solution, puzzle, CELL_COUNT * sizeof(val_t));
+            context->cancel = false;
+            clear_result(result, status);
+            return status;
+        }
+        Solver& solver = *context->solver;
+        // a cancel made before the solve starts stops it too, the request is consumed when the solve returns
+        SolveStatus solve_status = solver.solve(SolveLimits::within(timeout, &context->cancel));
+        context->cancel = false;
+        bool solved = solve_status == SolveStatus::SOLVED && solver.board().is_solved();
+        std::memmove(solution, solved ? solver.board().data() : context->board.data(), CELL_COUNT * sizeof(val_t));
+        auto end_time = std::chrono::high_resolution_clock::now();
+
+        status = solved ? SUDOKU_OK : SUDOKU_UNSOLVED;
+        if (solve_status == SolveStatus::TIMEOUT) status = SUDOKU_TIMEOUT;
+        else if (solve_status == SolveStatus::CANCELLED) status = SUDOKU_CANCELLED;
+        fill_result(result, status, context, std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time).count());
+        return status;
+    } catch (...){
+        std::memmove(solution, puzzle, CELL_COUNT * sizeof(val_t));
+        context->cancel = false;
+        clear_result(result, SUDOKU_ERROR);
+        return SUDOKU_ERROR;
+    }
+}
+
+int32_t sudoku_solve_start(sudoku_context* context, const uint16_t* puzzle)
+{
+    if (!context || !puzzle) return SUDOKU_ERROR;
+    try{
+        context->started = false;
+        int32_t status = load_puzzle(context, puzzle);
+        context->started = status == SUDOKU_OK;
+        context->time_us = 0;
+        return status;
+    } catch (...){
+        return SUDOKU_ERROR;
+    }
+}
+
+int32_t sudoku_solve_resume(sudoku_context* context, uint64_t max_steps, uint64_t max_us, uint16_t* solution,
+    sudoku_result* result)
+{
+    if (!context || !context->started || !solution){
+        clear_result(result, SUDOKU_ERROR);
+        return SUDOKU_ERROR;
+    }
+    try{
+        auto start_time = std::chrono::high_resolution_clock::now();
+        Solver& solver = *context->solver;
+        SolveStatus solve_status = solver.resume(max_steps, max_us);
+        auto end_time = std::chrono::high_resolution_clock::now();
+        context->time_us += std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time).count();
+
+        int32_t status = SUDOKU_YIELDED;
+        if (solve_status == SolveStatus::SOLVED) status = SUDOKU_OK;
+        else if (solve_status != SolveStatus::YIELDED) status = SUDOKU_UNSOLVED;
+        if (status != SUDOKU_YIELDED){
+            std::memcpy(solution, status == SUDOKU_OK ? solver.board().data() : context->board.data(), CELL_COUNT * sizeof(val_t));
+        }
+        fill_result(result, status, context, context->time_us);
+        return status;
+    } catch (...){
+        clear_result(result, SUDOKU_ERROR);
+        return SUDOKU_ERROR;
+    }
+}
+
+int32_t sudoku_generate(sudoku_context* context, uint32_t n_clues, uint32_t max_retries, double timeout,
+    uint16_t* puzzle, sudoku_result* result)
+{
+    if (!context || !puzzle || n_clues > CELL_COUNT){
+        clear_result(result, SUDOKU_ERROR);
+        return SUDOKU_ERROR;
+    }
+    try{
+        auto start_time = std::chrono::high_resolution_clock::now();
+        auto [generated, board, n_clues_found] = gen::generate_board(n_clues, std::max(max_retries, 1u), false, false, timeout);
+        auto end_time = std::chrono::high_resolution_clock::now();
+        int32_t status = generated ? SUDOKU_OK : (n_clues_found > 0 ? SUDOKU_TIMEOUT : SUDOKU_UNSOLVED);
+        if (status != SUDOKU_UNSOLVED){
+            std::memcpy(puzzle, board.data(), CELL_COUNT * sizeof(val_t));
+        }
+        clear_result(result, status);
+        if (result){
+            result->n_clues = n_clues_found;
+            result->time_us = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time).count();
+        }
+        return status;
+    } catch (...){
+        clear_result(result, SUDOKU_ERROR);
+        return SUDOKU_ERROR;
+    }
+}
+
+// the n boards of a batch can be addressed
+static bool batch_fits(uint64_t n)
+{
+    return n <= std::numeric_limits<size_t>::max() / (CELL_COUNT * sizeof(uint16_t));
+}
+
+uint64_t sudoku_solve_batch(const uint16_t* puzzles, uint16_t* solutions, sudoku_result* results,
+    uint64_t n, uint32_t n_threads)
+{
+    if (!puzzles || !solutions || !batch_fits(n)) return 0;
+    try{
+        std::vector<char> solved(n, 0);
+        run_slices(n, n_threads, [&](sudoku_context& context, uint64_t i){
+            int32_t status = sudoku_solve(&context, puzzles + i * CELL_COUNT, solutions + i * CELL_COUNT, results ? results + i : nullptr);
+            solved[i] = status == SUDOKU_OK;
+        });
+        return std::count(solved.begin(), solved.end(), 1);
+    } catch (...){
+        return 0;
+    }
+}
+
+uint64_t sudoku_generate_batch(uint32_t n_clues, uint32_t max_retries, uint16_t* puzzles, sudoku_result* results,
+    uint64_t n, uint32_t n_threads)
+{
+    if (!puzzles || !batch_fits(n)) return 0;
+    try{
+        std::vector<char> generated(n, 0);
+        run_slices(n, n_threads, [&](sudoku_context& context, uint64_t i){
+            int32_t status = sudoku_generate(&context, n_clues, max_retries, 0, puzzles + i * CELL_COUNT, results ? results + i : nullptr);
+            generated[i] = status == SUDOKU_OK;
+        });
+        return std::count(generated.begin(), generated.end(), 1);
+    } catch (...){
+        return 0;
+    }
+}
+
+}
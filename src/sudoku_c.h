@@ -0,0 +1,102 @@
+/*
+A stable C interface to the solver and the generator, built into bin/libsudoku.so (make shared),
+for embedding in other runtimes without going through the command line.
+
+- A board is a flat buffer of N * N uint16_t cells in row-major order, 0 for an empty cell,
+  with N = sudoku_board_size() fixed when the library is built (SIZE).
+- A context holds the preallocated solver state, it is reused by every call made with it.
+  The calls are reentrant: a context must not be used by two threads at once,
+  but any number of threads can each use their own context.
+- The batch calls run on a pool of threads of their own, with a context per thread,
+  and can be called from any thread.
+- A solve is bounded by a time budget and can be cancelled from another thread (sudoku_solve_timed).
+- No C++ exception crosses the interface, errors are reported as SUDOKU_ERROR.
+The layout of the structs and the meaning of the statuses only change with SUDOKU_ABI_VERSION,
+which is also the version of the library soname (libsudoku.so.<version>).
+*/
+
+#pragma once
+#include <stdint.h>
+
+#if defined(_WIN32)
+#define SUDOKU_API __declspec(dllexport)
+#else
+#define SUDOKU_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SUDOKU_ABI_VERSION 1
+
+typedef enum
+{
+    SUDOKU_OK = 0,          /* solved, or generated with the exact clue count */
+    SUDOKU_UNSOLVED = 1,    /* no solution found, the output is the input board */
+    SUDOKU_INVALID = 2,     /* a value out of range, or the givens conflict */
+    SUDOKU_TIMEOUT = 3,     /* the time ran out: a solve returns the input board,
+                               a generation the board with the fewest clues found */
+    SUDOKU_ERROR = 4,       /* invalid argument or internal error */
+    SUDOKU_CANCELLED = 5,   /* sudoku_context_cancel was called during the solve */
+    SUDOKU_YIELDED = 6,     /* sudoku_solve_resume: the budget ran out, call it again to go on */
+    SUDOKU_CONTRADICTION = 7 /* the givens leave a cell without candidate, or a value without place in a unit */
+} sudoku_status;
+
+typedef struct
+{
+    int32_t status;         /* a sudoku_status */
+    uint32_t n_clues;       /* clues of the input puzzle, or of the generated one */
+    uint64_t iterations;    /* IterationCounter of the solver */
+    uint64_t iteration_limit;
+    uint64_t n_guesses;
+    uint64_t time_us;
+} sudoku_result;
+
+typedef struct sudoku_context sudoku_context;
+
+SUDOKU_API uint32_t sudoku_abi_version(void);
+SUDOKU_API uint32_t sudoku_board_size(void);
+SUDOKU_API const char* sudoku_status_name(int32_t status);
+
+/* returns NULL if the allocation fails */
+SUDOKU_API sudoku_context* sudoku_context_create(void);
+SUDOKU_API void sudoku_context_destroy(sudoku_context* context);
+
+/* solve a puzzle into solution (may be the same buffer), result may be NULL, returns the status.
+   on every status but SUDOKU_OK the solution buffer receives a copy of the puzzle,
+   except for the SUDOKU_ERROR of a NULL argument */
+SUDOKU_API int32_t sudoku_solve(sudoku_context* context, const uint16_t* puzzle, uint16_t* solution, sudoku_result* result);
+
+/* sudoku_solve within timeout seconds (0 for none), stopped early by sudoku_context_cancel */
+SUDOKU_API int32_t sudoku_solve_timed(sudoku_context* context, const uint16_t* puzzle, uint16_t* solution, double timeout,
+    sudoku_result* result);
+
+/* resumable solving, for interleaving many solves on few threads: sudoku_solve_start checks the puzzle
+   and keeps it in the context, then each sudoku_solve_resume runs at most max_steps steps and about max_us
+   microseconds (0 for no bound) and returns SUDOKU_YIELDED until the search ends, the solution is written then.
+   the search state stays in the context between the calls, a context holds one such solve at a time */
+SUDOKU_API int32_t sudoku_solve_start(sudoku_context* context, const uint16_t* puzzle);
+SUDOKU_API int32_t sudoku_solve_resume(sudoku_context* context, uint64_t max_steps, uint64_t max_us, uint16_t* solution,
+    sudoku_result* result);
+
+/* stop the solve running on the context, the only call allowed from another thread than the one using it.
+   called while no solve runs, it stops the next sudoku_solve_timed on the context: the request is only
+   cleared when a solve returns, so a cancel racing the start of a solve is never lost */
+SUDOKU_API void sudoku_context_cancel(sudoku_context* context);
+
+/* generate a uniquely solvable puzzle with n_clues clues, timeout in seconds (0 for none), returns the status */
+SUDOKU_API int32_t sudoku_generate(sudoku_context* context, uint32_t n_clues, uint32_t max_retries, double timeout,
+    uint16_t* puzzle, sudoku_result* result);
+
+/* n puzzles of N * N cells each, results may be NULL, n_threads 0 for all the cores, returns the number solved */
+SUDOKU_API uint64_t sudoku_solve_batch(const uint16_t* puzzles, uint16_t* solutions, sudoku_result* results,
+    uint64_t n, uint32_t n_threads);
+
+/* n puzzles of N * N cells each, results may be NULL, returns the number generated with the exact clue count */
+SUDOKU_API uint64_t sudoku_generate_batch(uint32_t n_clues, uint32_t max_retries, uint16_t* puzzles, sudoku_result* results,
+    uint64_t n, uint32_t n_threads);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,86 @@
+#include "sudoku_c.h"
+#include "testing.h"
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+// only the C interface is used, as a client of libsudoku would
+int main(){
+    ASSERT_TRUE(sudoku_abi_version() == SUDOKU_ABI_VERSION);
+    const uint32_t n = sudoku_board_size();
+    const uint32_t n_cells = n * n;
+    ASSERT_TRUE(std::strcmp(sudoku_status_name(SUDOKU_TIMEOUT), "timeout") == 0);
+
+    sudoku_context* context = sudoku_context_create();
+    ASSERT_TRUE(context != nullptr);
+
+    // generate a puzzle with the clues of an easy one, then solve it
+    const uint32_t n_clues = n_cells / 2;
+    std::vector<uint16_t> puzzle(n_cells), solution(n_cells);
+    sudoku_result result;
+    int32_t status = sudoku_generate(context, n_clues, 10, 0, puzzle.data(), &result);
+    ASSERT_TRUE(status == SUDOKU_OK && result.status == SUDOKU_OK && result.n_clues == n_clues);
+
+    status = sudoku_solve(context, puzzle.data(), solution.data(), &result);
+    bool keeps_clues = true;
+    for (uint32_t i = 0; i < n_cells; i++){
+        keeps_clues = keeps_clues && solution[i] != 0 && (puzzle[i] == 0 || puzzle[i] == solution[i]);
+    }
+    ASSERT_TRUE(status == SUDOKU_OK && result.n_clues == n_clues && keeps_clues);
+
+    // the context is reused, and the solution may overwrite the puzzle
+    std::vector<uint16_t> in_place = puzzle;
+    status = sudoku_solve(context, in_place.data(), in_place.data(), nullptr);
+    ASSERT_TRUE(status == SUDOKU_OK && in_place == solution);
+
+    // conflicting givens and out of range values are rejected without solving
+    std::vector<uint16_t> invalid(n_cells, 0);
+    invalid[0] = invalid[1] = 1;
+    ASSERT_TRUE(sudoku_solve(context, invalid.data(), solution.data(), &result) == SUDOKU_INVALID && result.status == SUDOKU_INVALID);
+    // the output is the input board on every status but SUDOKU_OK
+    ASSERT_TRUE(solution == invalid);
+    std::vector<uint16_t> contradiction(n_cells, 0);
+    for (uint32_t c = 0; c + 1 < n; c++) contradiction[c] = static_cast<uint16_t>(c + 1);
+    contradiction[n_cells - 1] = static_cast<uint16_t>(n);
+    ASSERT_TRUE(sudoku_solve(context, contradiction.data(), solution.data(), &result) == SUDOKU_CONTRADICTION);
+    ASSERT_TRUE(solution == contradiction);
+    invalid[1] = static_cast<uint16_t>(n + 1);
+    ASSERT_TRUE(sudoku_solve(context, invalid.data(), solution.data(), &result) == SUDOKU_INVALID);
+    ASSERT_TRUE(sudoku_solve(nullptr, puzzle.data(), solution.data(), &result) == SUDOKU_ERROR);
+
+    // a budget too short for the search of the empty board, then one large enough
+    std::vector<uint16_t> empty(n_cells, 0);
+    ASSERT_TRUE(sudoku_solve_timed(context, empty.data(), solution.data(), 1e-9, &result) == SUDOKU_TIMEOUT && solution == empty);
+    ASSERT_TRUE(sudoku_solve_timed(context, empty.data(), solution.data(), 10, &result) == SUDOKU_OK);
+
+    // a cancel made before the solve is not dropped, and only stops that one
+    sudoku_context_cancel(context);
+    ASSERT_TRUE(sudoku_solve(context, empty.data(), solution.data(), &result) == SUDOKU_CANCELLED && solution == empty);
+    ASSERT_TRUE(sudoku_solve(context, empty.data(), solution.data(), &result) == SUDOKU_OK);
+
+    // the resumable solve yields after each step, and ends on the solution of the plain solve
+    std::vector<uint16_t> resumed(n_cells, 0);
+    ASSERT_TRUE(sudoku_solve_start(context, empty.data()) == SUDOKU_OK);
+    unsigned int n_yields = 0;
+    while ((status = sudoku_solve_resume(context, 1, 0, resumed.data(), &result)) == SUDOKU_YIELDED) n_yields++;
+    ASSERT_TRUE(status == SUDOKU_OK && n_yields > 0 && resumed == solution && result.n_clues == 0);
+    ASSERT_TRUE(sudoku_solve_start(context, invalid.data()) == SUDOKU_INVALID);
+    ASSERT_TRUE(sudoku_solve_resume(context, 1, 0, resumed.data(), &result) == SUDOKU_ERROR);
+    sudoku_context_destroy(context);
+
+    // batches: the invalid puzzle is reported in its own result, the others are solved.
+    // a half filled puzzle of the large boards takes seconds to generate, their batch is smaller and keeps more clues
+    const uint64_t n_puzzles = n <= 9 ? 6 : 3;
+    const uint32_t batch_clues = n <= 9 ? n_clues : n_cells * 3 / 4;
+    std::vector<uint16_t> puzzles(n_puzzles * n_cells), solutions(n_puzzles * n_cells);
+    std::vector<sudoku_result> results(n_puzzles);
+    uint64_t n_generated = sudoku_generate_batch(batch_clues, 10, puzzles.data(), results.data(), n_puzzles, 2);
+    ASSERT_TRUE(n_generated == n_puzzles);
+    std::memcpy(puzzles.data() + 1 * n_cells, invalid.data(), n_cells * sizeof(uint16_t));
+    uint64_t n_solved = sudoku_solve_batch(puzzles.data(), solutions.data(), results.data(), n_puzzles, 2);
+    ASSERT_TRUE(n_solved == n_puzzles - 1 && results[1].status == SUDOKU_INVALID && results[n_puzzles - 1].status == SUDOKU_OK);
+    // a count of boards that can not be addressed is rejected before touching the buffers
+    ASSERT_TRUE(sudoku_solve_batch(puzzles.data(), solutions.data(), nullptr, UINT64_MAX / 2, 2) == 0);
+    ASSERT_TRUE(sudoku_generate_batch(batch_clues, 10, puzzles.data(), nullptr, UINT64_MAX / 2, 2) == 0);
+    return testing::exit_code();
+}
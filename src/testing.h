@@ -0,0 +1,39 @@
+/*
+The checks shared by the tests: each prints its outcome and counts the failures,
+main returns testing::exit_code() so that a failed check fails the test binary.
+*/
+
+#pragma once
+#include <iostream>
+#include <string>
+
+namespace testing
+{
+    inline unsigned int n_failures = 0;
+
+    // prints "<label>: PASS" or "<label>: FAIL"
+    inline bool check(bool passed, const std::string& label)
+    {
+        if (!passed) n_failures++;
+        std::cout << label << ": " << (passed ? "PASS" : "FAIL") << std::endl;
+        return passed;
+    }
+
+    // prints "PASS" or "FAIL: <expression>"
+    inline bool check_expression(bool passed, const char* expression)
+    {
+        if (!passed) n_failures++;
+        if (passed) std::cout << "PASS" << std::endl;
+        else std::cout << "FAIL: " << expression << std::endl;
+        return passed;
+    }
+
+    inline int exit_code()
+    {
+        if (n_failures > 0) std::cout << n_failures << " check(s) failed" << std::endl;
+        return n_failures > 0 ? 1 : 0;
+    }
+}
+
+// a single expression, safe in any statement position
+#define ASSERT_TRUE(cond) testing::check_expression(static_cast<bool>(cond), #cond)
@@ -1,5 +1,14 @@
 #include "util.h"
 #include "config.h"
+#include <fstream>
+#include <stdexcept>
+#ifndef _WIN32
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace util{
 
@@ -22,4 +31,120 @@ std::vector<std::string> split_string(const std::string& str, const std::string&
     return result;
 }
 
+MappedFile::MappedFile(const std::string& path): m_data(nullptr), m_size(0), m_mapped(false)
+{
+#ifndef _WIN32
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0){
+        throw std::runtime_error("Failed to open file: " + path);
+    }
+    struct stat st{};
+    bool regular = fstat(fd, &st) == 0 && S_ISREG(st.st_mode);
+    if (regular && st.st_size > 0){
+        void* addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr != MAP_FAILED){
+            // the file is read front to back
+            madvise(addr, st.st_size, MADV_SEQUENTIAL);
+            m_data = static_cast<const char*>(addr);
+            m_size = st.st_size;
+            m_mapped = true;
+        }
+    }
+    if (!regular){
+        // a pipe, a FIFO or a terminal has no size to map, the stream is read to its end from the same descriptor
+        char chunk[1 << 16];
+        ssize_t n;
+        while ((n = ::read(fd, chunk, sizeof(chunk))) != 0){
+            if (n < 0){
+                if (errno == EINTR) continue;
+                ::close(fd);
+                throw std::runtime_error("Failed to read file: " + path);
+            }
+            m_buffer.insert(m_buffer.end(), chunk, chunk + n);
+        }
+        ::close(fd);
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+        return;
+    }
+    ::close(fd);
+    if (m_mapped || st.st_size == 0) return;
+#endif
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()){
+        throw std::runtime_error("Failed to open file: " + path);
+    }
+    m_buffer.assign((std::istreambuf_iterator<char>(file)), (std::istreambuf_iterator<char>()));
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+}
+
+MappedFile::~MappedFile()
+{
+#ifndef _WIN32
+    if (m_mapped){
+        munmap(const_cast<char*>(m_data), m_size);
+    }
+#endif
+}
+
+ThreadPool::ThreadPool(unsigned int n_threads): m_n_active(0), m_stop(false)
+{
+    if (n_threads == 0) n_threads = 1;
+    for (unsigned int i = 0; i < n_threads; i++){
+        m_workers.emplace_back(&ThreadPool::worker, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv_task.notify_all();
+    for (auto& t : m_workers){
+        t.join();
+    }
+}
+
+void ThreadPool::submit(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tasks.push_back(std::move(task));
+    }
+    m_cv_task.notify_one();
+}
+
+void ThreadPool::wait()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv_idle.wait(lock, [this](){ return m_tasks.empty() && m_n_active == 0; });
+}
+
+void ThreadPool::worker()
+{
+    while (true){
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv_task.wait(lock, [this](){ return m_stop || !m_tasks.empty(); });
+            // finish the queued tasks before stopping
+            if (m_tasks.empty()) return;
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+            m_n_active++;
+        }
+        task();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_n_active--;
+            if (m_tasks.empty() && m_n_active == 0){
+                m_cv_idle.notify_all();
+            }
+        }
+    }
+}
+
 }
@@ -5,10 +5,54 @@
 #include <array>
 #include <string>
 #include <random>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
 
 namespace util{
     std::vector<std::string> split_string(const std::string& str, const std::string& delimiter);
 
+    // read-only view of a whole file, memory mapped where the platform supports it,
+    // a pipe or a FIFO (such as /dev/stdin) is read to its end into memory instead,
+    // throws std::runtime_error if the file can not be opened or read
+    class MappedFile
+    {
+    public:
+        MappedFile(const std::string& path);
+        ~MappedFile();
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        const char* data() const { return m_data; }
+        size_t size() const { return m_size; }
+    private:
+        const char* m_data;
+        size_t m_size;
+        bool m_mapped;
+        std::vector<char> m_buffer;     // fallback when the file can not be mapped
+    };
+
+    // a fixed set of worker threads executing the submitted tasks in order
+    class ThreadPool
+    {
+    public:
+        ThreadPool(unsigned int n_threads);
+        ~ThreadPool();
+        void submit(std::function<void()> task);
+        void wait();        // block until all submitted tasks are finished
+        unsigned int size() const { return m_workers.size(); }
+    private:
+        std::vector<std::thread> m_workers;
+        std::deque<std::function<void()>> m_tasks;
+        std::mutex m_mutex;
+        std::condition_variable m_cv_task;
+        std::condition_variable m_cv_idle;
+        unsigned int m_n_active;
+        bool m_stop;
+        void worker();
+    };
+
     template <typename T, unsigned int size_>
     class SizedArray
     {
@@ -69,24 +113,35 @@ namespace util{
         }
     }
 
-    static std::random_device dev;
-    static std::mt19937 rng(dev());
+    // random engine owned by the calling thread, 
+    // so that the generator threads do not race on a shared state
+    inline std::mt19937& thread_rng()
+    {
+        static thread_local std::mt19937 rng(std::random_device{}());
+        return rng;
+    }
+
     // suffle the first size elements of an array 
     // using the Fisher-Yates algorithm
     // use this for very small arrays
     template <typename T>
     void shuffle_array(T* arr, unsigned int size)
     {
-        std::uniform_int_distribution<std::mt19937::result_type> dist(0, size - 1);
-        for (unsigned int i = 0; i < size; i++)
+        std::mt19937& rng = thread_rng();
+        for (unsigned int i = size; i > 1; i--)
         {
+            std::uniform_int_distribution<unsigned int> dist(0, i - 1);
             unsigned int j = dist(rng);
-            T temp = arr[i];
-            arr[i] = arr[j];
+            T temp = arr[i - 1];
+            arr[i - 1] = arr[j];
             arr[j] = temp;
         }
     }
 
+    // bit helpers for the candidate masks
+    inline unsigned int popcount(unsigned long long x){ return __builtin_popcountll(x); }
+    inline unsigned int count_trailing_zeros(unsigned long long x){ return __builtin_ctzll(x); }
+
     template <unsigned int N>
     struct Factorial
     {
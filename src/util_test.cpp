@@ -1,5 +1,10 @@
 #include "util.h"
+#include "testing.h"
 #include <iostream>
+#include <fstream>
+#include <thread>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #define ASSERT_EQ(a, b) if (a != b) { std::cout << "FAIL" << std::endl; } else { std::cout << "PASS" << std::endl; }
 
@@ -28,4 +33,20 @@ int main(){
         }
         std::cout << std::endl;
     }
+
+    // a FIFO has no size, it is read to its end instead of mapped as empty
+    const std::string fifo_path = "output/util_test.fifo";
+    ::unlink(fifo_path.c_str());
+    if (::mkfifo(fifo_path.c_str(), 0600) == 0){
+        const std::string content(100000, 'x');
+        std::thread writer([&](){
+            std::ofstream fifo(fifo_path, std::ios::binary);
+            fifo << content;
+        });
+        util::MappedFile file(fifo_path);
+        writer.join();
+        testing::check(std::string(file.data(), file.size()) == content, "Read a FIFO");
+        ::unlink(fifo_path.c_str());
+    }
+    return testing::exit_code();
 };
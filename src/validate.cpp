@@ -0,0 +1,89 @@
+#include "validate.h"
+#include "board.h"
+#include "dataset.h"
+#include "util.h"
+#include "config.h"
+#include <algorithm>
+#include <cstring>
+
+namespace validate
+{
+    // ranges per thread, so that a range of slow lines does not hold the others back
+    static const unsigned int RANGES_PER_THREAD = 8;
+
+    struct Range
+    {
+        const char* begin;
+        const char* end;
+        unsigned long n_newlines = 0;       // to number the lines of the next ranges
+        ValidateStats stats;
+        std::vector<unsigned long> failed;  // the line indices in the range, from 0
+    };
+
+    static void validate_range(Range& range, bool keep_failed)
+    {
+        Board board;
+        unsigned long index = 0;
+        for (const char* line = range.begin; line < range.end; index++){
+            const char* newline = static_cast<const char*>(std::memchr(line, '\n', range.end - line));
+            const char* line_end = newline ? newline : range.end;
+            if (static_cast<size_t>(line_end - line) >= CELL_COUNT){
+                range.stats.n_lines++;
+                bool decoded = CompactDataset::decode(line, board);
+                if (decoded && board.is_solved()){
+                    range.stats.n_valid++;
+                }
+                else{
+                    if (decoded) range.stats.n_invalid++;
+                    else range.stats.n_malformed++;
+                    if (keep_failed) range.failed.push_back(index);
+                }
+            }
+            if (!newline) break;
+            range.n_newlines++;
+            line = newline + 1;
+        }
+    }
+
+    ValidateStats validate_file(const std::string& path, unsigned int n_threads, std::vector<unsigned long>* failed_lines)
+    {
+        util::MappedFile file(path);
+        util::ThreadPool pool(n_threads);
+        const char* data = file.data();
+        const char* end = data + file.size();
+
+        // each range starts at the first line starting at or after an even split of the bytes
+        size_t n_ranges = std::max<size_t>(1, std::min<size_t>(pool.size() * RANGES_PER_THREAD, file.size() / (CELL_COUNT + 1)));
+        std::vector<Range> ranges(n_ranges);
+        const char* cursor = data;
+        for (size_t r = 0; r < n_ranges; r++){
+            ranges[r].begin = cursor;
+            cursor = r + 1 < n_ranges ? std::max(cursor, data + file.size() * (r + 1) / n_ranges) : end;
+            if (cursor > data && cursor < end && cursor[-1] != '\n'){
+                const char* newline = static_cast<const char*>(std::memchr(cursor, '\n', end - cursor));
+                cursor = newline ? newline + 1 : end;
+            }
+            ranges[r].end = cursor;
+        }
+
+        bool keep_failed = failed_lines != nullptr;
+        for (auto& range: ranges){
+            pool.submit([&range, keep_failed](){ validate_range(range, keep_failed); });
+        }
+        pool.wait();
+
+        ValidateStats stats;
+        unsigned long first_line = 1;
+        for (auto& range: ranges){
+            stats.n_lines += range.stats.n_lines;
+            stats.n_valid += range.stats.n_valid;
+            stats.n_invalid += range.stats.n_invalid;
+            stats.n_malformed += range.stats.n_malformed;
+            if (keep_failed){
+                for (unsigned long index: range.failed) failed_lines->push_back(first_line + index);
+            }
+            first_line += range.n_newlines;
+        }
+        return stats;
+    }
+}
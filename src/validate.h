@@ -0,0 +1,29 @@
+/*
+Batch validation of solved grids, one per line in the compact format, as written by `solve --batch`
+or stored in the solution column of a dataset: the first CELL_COUNT characters of a line must be
+a complete grid with each value once in every row, column and grid, the rest of the line is ignored.
+Lines shorter than CELL_COUNT are skipped, as by the dataset reader.
+
+The file is memory mapped and cut into byte ranges at line boundaries, the ranges are checked
+on a pool of threads, each line decoded in place and checked with the unit masks of Board::is_solved,
+without allocation.
+*/
+
+#pragma once
+#include <string>
+#include <vector>
+
+namespace validate
+{
+    struct ValidateStats
+    {
+        unsigned long n_lines = 0;          // the lines checked, the short ones excluded
+        unsigned long n_valid = 0;
+        unsigned long n_invalid = 0;        // a cell empty, or a value repeated in a unit
+        unsigned long n_malformed = 0;      // a character that is not a cell
+    };
+
+    // throws std::runtime_error if the file can not be opened,
+    // the numbers (from 1) of the lines that are not valid grids are added in order to failed_lines if given
+    ValidateStats validate_file(const std::string& path, unsigned int n_threads, std::vector<unsigned long>* failed_lines = nullptr);
+}
@@ -0,0 +1,77 @@
+#include "validate.h"
+#include "generate.h"
+#include "config.h"
+#include "testing.h"
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+int main(){
+    // more lines than the ranges of the threads, with broken grids, malformed and short lines at random places
+    const unsigned int n_lines = 20000;
+    std::vector<std::string> grids;
+    for (unsigned int i = 0; i < 50; i++){
+        Board grid;
+        gen::fill_valid_board(grid, gen::FillStrategy::RANDOM);
+        std::string line = grid.to_string(BoardFormat::COMPACT);
+        line.pop_back();
+        grids.push_back(line);
+    }
+    std::mt19937 rng(5);
+    std::vector<unsigned long> expected_failed;
+    unsigned long n_invalid = 0, n_malformed = 0, n_short = 0;
+    {
+        std::ofstream file("output/validate_test.txt");
+        for (unsigned int i = 1; i <= n_lines; i++){
+            std::string line = grids[rng() % grids.size()];
+            switch (rng() % 16){
+                case 0:     // a cell emptied
+                    line[rng() % CELL_COUNT] = '.';
+                    expected_failed.push_back(i);
+                    n_invalid++;
+                    break;
+                case 1:     // two different cells of a row swapped, the row stays full
+                {
+                    unsigned int row = rng() % BOARD_SIZE;
+                    unsigned int a = rng() % BOARD_SIZE, b = (a + 1 + rng() % (BOARD_SIZE - 1)) % BOARD_SIZE;
+                    std::swap(line[row * BOARD_SIZE + a], line[row * BOARD_SIZE + b]);
+                    expected_failed.push_back(i);
+                    n_invalid++;
+                    break;
+                }
+                case 2:
+                    line[rng() % CELL_COUNT] = '#';
+                    expected_failed.push_back(i);
+                    n_malformed++;
+                    break;
+                case 3:     // skipped, but numbered
+                    line.resize(CELL_COUNT / 2);
+                    n_short++;
+                    break;
+                case 4:     // the rest of a line is ignored
+                    line += " solved\r";
+                    break;
+            }
+            file << line << (i < n_lines ? "\n" : "");
+        }
+    }
+
+    std::vector<unsigned long> failed;
+    auto stats = validate::validate_file("output/validate_test.txt", 3, &failed);
+    ASSERT_TRUE(stats.n_lines == n_lines - n_short && stats.n_invalid == n_invalid && stats.n_malformed == n_malformed);
+    ASSERT_TRUE(stats.n_valid == stats.n_lines - n_invalid - n_malformed);
+    ASSERT_TRUE(failed == expected_failed);
+
+    // the same counts on one thread, and on a file of a single line without newline
+    auto single = validate::validate_file("output/validate_test.txt", 1);
+    ASSERT_TRUE(single.n_lines == stats.n_lines && single.n_valid == stats.n_valid);
+    {
+        std::ofstream file("output/validate_test_one.txt");
+        file << grids[0];
+    }
+    auto one = validate::validate_file("output/validate_test_one.txt", 4, &failed);
+    ASSERT_TRUE(one.n_lines == 1 && one.n_valid == 1);
+    return testing::exit_code();
+}